@@ -0,0 +1,104 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Configuración de FreeRTOS para el build con tareas de tarjeta Control (port GCC/ARM_CM4F)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Solo se usa con USE_FREERTOS_FEATURE (ver app_rtos.h). El build de host sobre el port POSIX tiene su propia
+ * configuración en Host/Stubs/FreeRTOSConfig.h con los mismos parámetros de la aplicación.
+ *
+ * SysTick es a la vez el tick de la HAL y el de FreeRTOS (1 kHz, stm32f4xx_it.c). Al iniciar el scheduler el
+ * port baja SysTick y PendSV a configKERNEL_INTERRUPT_PRIORITY; las ISRs que usan la API ...FromISR (CAN1_RX0 y
+ * TIM7) deben tener prioridad numérica mayor o igual a configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, lo que se
+ * verifica en irq_priority.h.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Global variables declarations
+ **********************************************************************************************************************/
+
+extern uint32_t SystemCoreClock;
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/* ---------------------------------------------------- Kernel ---------------------------------------------------- */
+
+#define configUSE_PREEMPTION                        1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     1
+#define configCPU_CLOCK_HZ                          (SystemCoreClock)
+#define configTICK_RATE_HZ                          ((TickType_t)1000)
+#define configMAX_PRIORITIES                        7
+#define configMINIMAL_STACK_SIZE                    ((uint16_t)128)
+#define configMAX_TASK_NAME_LEN                     16
+#define configUSE_16_BIT_TICKS                      0
+#define configIDLE_SHOULD_YIELD                     1
+#define configUSE_MUTEXES                           0
+#define configUSE_COUNTING_SEMAPHORES               0
+#define configQUEUE_REGISTRY_SIZE                   0
+#define configUSE_TIMERS                            0
+#define configUSE_CO_ROUTINES                       0
+
+/* ---------------------------------------------------- Memoria --------------------------------------------------- */
+
+#define configSUPPORT_STATIC_ALLOCATION             0
+#define configSUPPORT_DYNAMIC_ALLOCATION            1
+#define configTOTAL_HEAP_SIZE                       ((size_t)16384)
+
+/* ------------------------------------------------- Diagnóstico -------------------------------------------------- */
+
+#define configUSE_IDLE_HOOK                         0
+#define configUSE_TICK_HOOK                         0
+#define configCHECK_FOR_STACK_OVERFLOW              2
+#define configUSE_MALLOC_FAILED_HOOK                1
+#define configUSE_TRACE_FACILITY                    1
+
+/** @brief Tiempo de ejecución por tarea con la base de tiempo en us (TIM2, iniciada en MX_APP_Init) */
+#define configGENERATE_RUN_TIME_STATS               1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()            TIMEBASE_Get_Us()
+uint32_t TIMEBASE_Get_Us(void);
+
+#define configASSERT(x)                             if ((x) == 0) { taskDISABLE_INTERRUPTS(); for (;;); }
+
+/* -------------------------------------------------- API incluida ------------------------------------------------ */
+
+#define INCLUDE_vTaskDelay                          1
+#define INCLUDE_vTaskDelayUntil                     1
+#define INCLUDE_vTaskSuspend                        1
+#define INCLUDE_xTaskGetSchedulerState              1
+#define INCLUDE_uxTaskGetStackHighWaterMark         1
+
+/* ------------------------------------------------- Interrupciones ----------------------------------------------- */
+
+/** @brief Bits de prioridad del NVIC del STM32F446 */
+#define configPRIO_BITS                             4
+
+/** @brief Prioridad de SysTick y PendSV con el scheduler iniciado (la más baja) */
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY     15
+
+/** @brief Prioridad más alta (número más bajo) desde la que se puede llamar a la API ...FromISR */
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 1
+
+#define configKERNEL_INTERRUPT_PRIORITY             (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY        (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+/** @brief Handlers del port (stm32f4xx_it.c no los genera; SysTick_Handler llama a xPortSysTickHandler) */
+#define vPortSVCHandler                             SVC_Handler
+#define xPortPendSVHandler                          PendSV_Handler
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,275 @@
+/**
+ * @file app_context.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Contexto de la aplicación de Control: estado completo de una instancia y su configuración
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Todo el estado de la aplicación (buses, objeto CAN, banderas y máquinas de estado) vive en una estructura
+ * app_context_t que se pasa a cada bloque *_Process. En el target existe una única instancia estática
+ * (app_control.c), por lo que cada acceso sigue siendo base más offset constante; en el build de host se
+ * pueden crear tantas instancias independientes como se necesite.
+ *
+ * Los parámetros que se quieren barrer en simulación (ventanas de persistencia de fallas, rampas de pedal y
+ * políticas de transmisión por cambio) se leen de la configuración app_config_t a la que apunta el contexto.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _APP_CONTEXT_H_
+#define _APP_CONTEXT_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* C includes */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Application includes */
+#include "buses.h"
+
+/* CAN driver include */
+#include "can_api.h"
+
+/* CAN application includes */
+#include "can_def.h"
+#include "tx_policy.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Número de tramos lineales de una rampa de pedal */
+#define RAMPA_PEDAL_NUM_OF_SEGMENTS         5
+
+/** @brief Ancho de cada tramo de la rampa de pedal (pedal en [0:100)) */
+#define RAMPA_PEDAL_SEGMENT_WIDTH           20
+
+/** @brief Número de estados de la máquina de fallas (OK, CAUTION1, CAUTION2, AUTOKILL) */
+#define FAILURES_NUM_OF_STATES              4
+
+/** @brief Define si usar camino rápido de hombre muerto en la ISR de recepción CAN o no */
+#ifndef USE_DEADMAN_FAST_PATH_FEATURE
+#define USE_DEADMAN_FAST_PATH_FEATURE       1
+#endif
+
+/**
+ * @brief Define si transmitir nivel de velocidad por evento (llegada de pedal) o en el turno de CAN_APP_Send_BusData
+ *
+ * Sin efecto con USE_CAN_TX_POLICY_FEATURE: la política ya envía nivel de velocidad en la pasada en que cambia.
+ */
+#ifndef USE_PEDAL_EVENT_TX_FEATURE
+#define USE_PEDAL_EVENT_TX_FEATURE          1
+#endif
+
+/**
+ * @brief Define si agregar contador de secuencia (CAN_SEQUENCE_BYTE) a las tramas de un byte de Control o no
+ *
+ * Cambia el formato de esas tramas (IDs hasta CAN_SEQUENCE_MAX_TX_ID): el DLC pasa de 1 a 2, el valor sigue en el
+ * byte 0 y el contador va en el byte 1. Deshabilitado hasta que los receptores de esas tramas acepten DLC 2.
+ */
+#ifndef USE_CAN_TX_SEQUENCE_FEATURE
+#define USE_CAN_TX_SEQUENCE_FEATURE         0
+#endif
+
+/** @brief Define si transmitir las señales del bus de salida CAN por cambio (CAN_APP_Send_Changes) o por turnos */
+#ifndef USE_CAN_TX_POLICY_FEATURE
+#define USE_CAN_TX_POLICY_FEATURE           1
+#endif
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato can_rx_status_t para estado de recepción de mensaje CAN
+ *
+ */
+typedef enum
+{
+	CAN_MSG_RECEIVED = 0, 		/**< Mensaje CAN recibido */
+    CAN_MSG_NOT_RECEIVED   		/**< Mensaje CAN no recibido */
+} can_rx_status_t;
+
+/**
+ * @brief Tipo de dato can_tx_status_t para estado de transmisión de mensaje CAN
+ *
+ */
+typedef enum
+{
+    CAN_TX_READY = 0, 		/**< Listo para transmitir mensaje CAN */
+    CAN_TX_NOT_READY   		/**< No listo para transmitir mensaje CAN */
+} can_tx_status_t;
+
+/**
+ * @brief Tipo de dato decode_status_t para bandera de decodificación
+ *
+ */
+typedef enum
+{
+    DECODIFICA = 0, 	/**< Valor para decodificar */
+    NO_DECODIFICA   	/**< Valor para no decodificar */
+} decode_status_t;
+
+/**
+ * @brief Señales del bus de salida CAN con política de transmisión por cambio (orden de envío en una pasada)
+ *
+ */
+typedef enum
+{
+    kCAN_TX_ESTADO_MANEJO = 0,      /**< CAN_ID_CONTROL_ESTADO_MANEJO */
+    kCAN_TX_ESTADO_FALLA,           /**< CAN_ID_CONTROL_ESTADO_FALLA */
+    kCAN_TX_NIVEL_VELOCIDAD,        /**< CAN_ID_CONTROL_NIVEL_VELOCIDAD (antes que hombre muerto) */
+    kCAN_TX_HOMBRE_MUERTO,          /**< CAN_ID_CONTROL_HOMBRE_MUERTO */
+    kCAN_TX_NUM_OF_SIGNALS
+} can_tx_signal_t;
+
+/**
+ * @brief Tipo de dato para ventana de persistencia de una transición de fallas
+ *
+ */
+typedef struct
+{
+    uint16_t min_count;         /**< Muestras recibidas mínimas con la condición presente (0 = no se usa) */
+    uint16_t min_time_ms;       /**< Tiempo mínimo en ms con la condición presente (0 = no se usa) */
+} failures_persistence_t;
+
+/**
+ * @brief Configuración de la máquina de fallas
+ *
+ */
+typedef struct
+{
+    failures_persistence_t  escalate;   /**< Hacia una falla más severa (OK -> CAUTION1, OK/CAUTION1 -> CAUTION2) */
+    failures_persistence_t  recover;    /**< Hacia una falla menos severa (CAUTION2 -> CAUTION1, CAUTION1 -> OK) */
+    failures_persistence_t  autokill;   /**< Hacia AUTOKILL */
+    failures_persistence_t  critical;   /**< Hacia AUTOKILL por condición crítica (camino rápido) */
+} failures_config_t;
+
+/**
+ * @brief Filtro de persistencia de un nivel de severidad de la máquina de fallas
+ *
+ */
+typedef struct
+{
+    bool        active;         /**< La condición de llegar a este nivel está presente */
+    uint16_t    count;          /**< Muestras recibidas desde que la condición está presente */
+    uint32_t    tickstart;      /**< Tick en que se observó la condición por primera vez */
+} failures_level_filter_t;
+
+/**
+ * @brief Filtro de persistencia de la máquina de fallas, un nivel por estado destino
+ *
+ */
+typedef struct
+{
+    failures_level_filter_t level[FAILURES_NUM_OF_STATES];  /**< Por estado destino */
+} failures_filter_t;
+
+/**
+ * @brief Tramo lineal de una rampa de pedal: velocidad = slope * pedal + offset
+ *
+ */
+typedef struct
+{
+    float slope;                /**< Pendiente */
+    float offset;               /**< Ordenada */
+} rampa_pedal_segment_t;
+
+/**
+ * @brief Rampa de pedal de un modo de manejo, un tramo por cada RAMPA_PEDAL_SEGMENT_WIDTH de pedal
+ *
+ */
+typedef struct
+{
+    rampa_pedal_segment_t segment[RAMPA_PEDAL_NUM_OF_SEGMENTS];     /**< Tramos */
+} rampa_pedal_map_t;
+
+/**
+ * @brief Configuración de una instancia de la aplicación
+ *
+ */
+typedef struct
+{
+    failures_config_t   failures;       /**< Ventanas de persistencia de la máquina de fallas */
+    rampa_pedal_map_t   pedal_eco;      /**< Rampa de pedal modo ECO */
+    rampa_pedal_map_t   pedal_normal;   /**< Rampa de pedal modo NORMAL */
+    rampa_pedal_map_t   pedal_sport;    /**< Rampa de pedal modo SPORT */
+    tx_policy_config_t  can_tx_policy[kCAN_TX_NUM_OF_SIGNALS];  /**< Política de transmisión por señal */
+} app_config_t;
+
+/**
+ * @brief Contexto de la aplicación: estado completo de una instancia de Control
+ *
+ */
+typedef struct app_context
+{
+    /* ---------------------------------- Buses ---------------------------------- */
+
+    typedef_bus1_t                  bus_data;               /**< Bus 1: Bus de datos */
+    typedef_bus2_t                  bus_can_output;         /**< Bus 2: Bus de transmisión de datos CAN */
+    typedef_bus3_t                  bus_can_input;          /**< Bus 3: snapshot del bus de recepción CAN */
+    typedef_bus3_shared_t           bus_can_input_shared;   /**< Bus 3 compartido, escrito desde la ISR */
+
+    /* ----------------------------------- CAN ----------------------------------- */
+
+    CAN_t                           can_obj;                /**< Objeto CAN de transmisión */
+    volatile can_rx_status_t        flag_rx_can;            /**< Bandera mensaje recibido CAN */
+    volatile can_tx_status_t        flag_tx_can;            /**< Bandera transmisión CAN */
+    uint8_t                         can_tx_index;           /**< Próximo mensaje de CAN_APP_Send_BusData */
+    uint8_t                         can_tx_flag_count;      /**< Triggers de transmisión desde el último envío */
+    volatile uint8_t                can_tx_priority;        /**< Tramas de camino rápido pendientes (bits) */
+    volatile hm_state_t             hombre_muerto_isr;      /**< Último estado de hombre muerto visto por la ISR */
+    volatile can_rx_status_t        flag_rx_pedal;          /**< Bandera muestra de pedal recibida */
+    bool                            velocidad_tx_pending;   /**< Nivel de velocidad por evento pendiente */
+    uint32_t                        velocidad_tx_last_us;   /**< Último envío de nivel de velocidad por evento */
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+    uint8_t                         can_tx_sequence[CAN_SEQUENCE_MAX_TX_ID + 1];    /**< Próximo contador por ID */
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+#if USE_CAN_TX_POLICY_FEATURE == 1
+    tx_policy_state_t               can_tx_policy[kCAN_TX_NUM_OF_SIGNALS];          /**< Estado de transmisión */
+    bool                            can_tx_policy_started;  /**< Estados de transmisión iniciados */
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+    /* ---------------------------- Máquinas de estado --------------------------- */
+
+    decode_status_t                 flag_decodificar;       /**< Bandera para ejecutar decodificación de datos */
+    uint8_t                         app_state;              /**< Estado de app_control.c */
+    uint32_t                        app_timestart_us;       /**< Inicio de espera de echo (base de tiempo en us) */
+    uint8_t                         failures_state;         /**< Estado de la máquina de fallas */
+    failures_filter_t               failures_filter;        /**< Filtro de persistencia de la máquina de fallas */
+    bool                            failures_sample;        /**< Datos recibidos nuevos para la máquina de fallas */
+    uint8_t                         driving_modes_state;    /**< Estado de la máquina de modos de manejo */
+
+    /* ------------------------------ Configuración ------------------------------ */
+
+    const app_config_t*             config;                 /**< Configuración de la instancia */
+
+} app_context_t;
+
+/***********************************************************************************************************************
+ * Global variables declarations
+ **********************************************************************************************************************/
+
+/** @brief Configuración por defecto (la del vehículo) */
+extern const app_config_t app_config_default;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa un contexto con los valores iniciales de buses y máquinas de estado.
+ *
+ * No inicializa el objeto CAN (ver CAN_HW_Init).
+ *
+ * @param ctx       Contexto
+ * @param config    Configuración de la instancia (debe seguir válida mientras se use el contexto)
+ * @retval None
+ */
+void APP_CONTEXT_Init(app_context_t* ctx, const app_config_t* config);
+
+#endif /* _APP_CONTEXT_H_ */
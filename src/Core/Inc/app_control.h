@@ -19,6 +19,22 @@
 /* BSP (board support package) include */
 #include "stm32f4xx_control.h"
 
+/* Application includes */
+#include "app_context.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Espera antes del primer echo en ms */
+#define MX_APP_ECHO_DELAY_MS                2000U
+
+/** @brief Sin respuesta de todos los módulos, el echo se reenvía cada este tiempo en us */
+#define MX_APP_ECHO_TIMEOUT_US              5000000U
+
+/** @brief Espera entre la respuesta de todos los módulos y el estado kRUNNING en ms */
+#define MX_APP_READY_DELAY_MS               500U
+
 /***********************************************************************************************************************
  * Public function prototypes
  **********************************************************************************************************************/
@@ -26,4 +42,47 @@
 void MX_APP_Init(void);
 void MX_APP_Process(void);
 
+/**
+ * @brief Ejecuta una pasada del estado kRUNNING sobre un contexto.
+ *
+ * MX_APP_Process la llama con la instancia del target; el build de host puede llamarla sobre otras instancias.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void MX_APP_Run_Pass(app_context_t* ctx);
+
+/**
+ * @brief Envía echo (Control OK) a las demás tarjetas.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void MX_APP_Send_Echo(app_context_t* ctx);
+
+/**
+ * @brief Indica si todos los módulos respondieron OK al echo (según el snapshot del bus de recepción).
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval true     BMS, DCDC, inversor y Periféricos OK
+ * @retval false    Falta alguno
+ */
+bool MX_APP_Modules_Ok(const app_context_t* ctx);
+
+/**
+ * @brief Pasa un contexto al estado kRUNNING.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void MX_APP_Enter_Running(app_context_t* ctx);
+
+/**
+ * @brief Retorna el contexto de la instancia de la aplicación (la del target).
+ *
+ * @param None
+ * @return app_context_t* Contexto
+ */
+app_context_t* MX_APP_Get_Context(void);
+
 #endif /* _APP_CONTROL_H_ */
@@ -0,0 +1,157 @@
+/**
+ * @file app_rtos.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para app_rtos.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Build alternativo de la aplicación sobre FreeRTOS (USE_FREERTOS_FEATURE): en vez de la superloop de
+ * MX_APP_Process, las etapas corren en tareas con prioridad propia, conectadas por colas:
+ *
+ *   Prioridad  Tarea        Etapas                                         Entrada
+ *   5          CAN_RX       CAN_APP_Store_ReceivedMessage                  Cola de tramas (ISR de recepción CAN)
+ *   4          CONTROL      CAN_APP, DECODE_DATA, DRIVING_MODES,           Cola de eventos (recepción, TIM7, falla)
+ *                           RAMPA_PEDAL y nivel de velocidad por evento
+ *   3          FAILURES     FAILURES                                       Bus de datos monitoreado
+ *   2          MONITORING   MONITORING                                     Bus de datos decodificado
+ *   1          INDICATORS   INDICATORS (y fin de inicialización)           Estado de indicadores
+ *
+ * Las colas de bus de datos, falla e indicadores tienen largo 1 y se escriben con xQueueOverwrite: el lector
+ * siempre toma el último valor. MONITORING, FAILURES e INDICATORS trabajan sobre su propio contexto; solo
+ * CAN_RX y CONTROL comparten el de la aplicación (bus de recepción con seqlock y camino rápido de hombre
+ * muerto, como la ISR en la superloop). INDICATORS_Finish_StartUp corre en la tarea de menor prioridad, por lo
+ * que ya no retrasa al camino de pedal.
+ *
+ * En la tarjeta, el kernel (Middlewares/Third_Party/FreeRTOS: tasks.c, queue.c, list.c, port GCC/ARM_CM4F y
+ * heap_4.c) no es parte del repositorio: se agrega al proyecto junto con -DUSE_FREERTOS_FEATURE=1. USE_RTOS de
+ * stm32f4xx_hal_conf.h sigue en 0 (la HAL del F4 no lo soporta). En host, "make rtos FREERTOS_DIR=<kernel>"
+ * compila el mismo grafo de tareas contra el port POSIX de FreeRTOS.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _APP_RTOS_H_
+#define _APP_RTOS_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* Application includes */
+#include "app_context.h"
+
+/* CAN driver include */
+#include "can_api.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si ejecutar la aplicación como tareas de FreeRTOS o en la superloop */
+#ifndef USE_FREERTOS_FEATURE
+#define USE_FREERTOS_FEATURE                0
+#endif
+
+#if USE_FREERTOS_FEATURE == 1
+
+/** @brief Prioridades de las tareas (configMAX_PRIORITIES - 1 queda libre para el build de host) */
+#define APP_RTOS_PRIORITY_CAN_RX            5U
+#define APP_RTOS_PRIORITY_CONTROL           4U
+#define APP_RTOS_PRIORITY_FAILURES          3U
+#define APP_RTOS_PRIORITY_MONITORING        2U
+#define APP_RTOS_PRIORITY_INDICATORS        1U
+
+/** @brief Stack de las tareas en palabras (StackType_t) sobre configMINIMAL_STACK_SIZE */
+#define APP_RTOS_STACK_CAN_RX               (configMINIMAL_STACK_SIZE + 128U)
+#define APP_RTOS_STACK_CONTROL              (configMINIMAL_STACK_SIZE + 256U)
+#define APP_RTOS_STACK_FAILURES             (configMINIMAL_STACK_SIZE + 128U)
+#define APP_RTOS_STACK_MONITORING           (configMINIMAL_STACK_SIZE + 128U)
+#define APP_RTOS_STACK_INDICATORS           (configMINIMAL_STACK_SIZE + 128U)
+
+/** @brief Largo de la cola de tramas recibidas (la FIFO 0 del bxCAN tiene 3) */
+#define APP_RTOS_CAN_RX_QUEUE_LENGTH        16U
+
+/** @brief Largo de la cola de eventos de la tarea de control */
+#define APP_RTOS_EVENT_QUEUE_LENGTH         16U
+
+/** @brief Sin eventos, la tarea de control hace una pasada cada este periodo en ms (keep-alive y autokill) */
+#define APP_RTOS_CONTROL_PERIOD_MS          10U
+
+/** @brief Sin datos nuevos, la tarea de fallas reevalúa cada este periodo en ms (ventanas por tiempo) */
+#define APP_RTOS_FAILURES_PERIOD_MS         10U
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Eventos de la tarea de control
+ *
+ */
+typedef enum
+{
+    kAPP_RTOS_EVENT_CAN_RX = 0,     /**< Tramas nuevas en el bus de recepción CAN compartido */
+    kAPP_RTOS_EVENT_CAN_TX,         /**< Trigger de transmisión (TIM7) */
+    kAPP_RTOS_EVENT_FAILURE         /**< Resultado nuevo de la máquina de fallas */
+} app_rtos_event_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Crea las colas y las tareas de la aplicación.
+ *
+ * Se llama desde MX_APP_Init antes de CAN_HW_Init: la ISR de recepción ya usa la cola de tramas. Hasta
+ * APP_RTOS_Start, FreeRTOS deja enmascaradas las interrupciones que usan su API.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (el de CAN_RX y CONTROL)
+ * @retval None
+ */
+void APP_RTOS_Init(app_context_t* ctx);
+
+/**
+ * @brief Inicia el scheduler. No retorna.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void APP_RTOS_Start(void);
+
+/**
+ * @brief Entrega una trama recibida a la tarea de recepción. Se llama desde la ISR de recepción CAN.
+ *
+ * Si la cola está llena la trama se descarta y se cuenta (APP_RTOS_Get_Rx_Overruns).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param frame Trama recibida
+ * @retval None
+ */
+void APP_RTOS_Can_Rx_FromISR(const can_frame_t* frame);
+
+/**
+ * @brief Avisa a la tarea de control el trigger de transmisión. Se llama desde la ISR de TIM7.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void APP_RTOS_Can_Tx_Trigger_FromISR(void);
+
+/**
+ * @brief Retorna el número de tramas descartadas con la cola de recepción llena.
+ *
+ * @return uint32_t
+ */
+uint32_t APP_RTOS_Get_Rx_Overruns(void);
+
+#endif /* USE_FREERTOS_FEATURE */
+
+#endif /* _APP_RTOS_H_ */
@@ -0,0 +1,146 @@
+/**
+ * @file bus_load.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para bus_load.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Medidor de carga del bus CAN de Control: cada trama recibida (ISR de recepción) y cada trama propia dejada en
+ * mailbox suma su largo en bits, y la pasada principal cierra ventanas de BUS_LOAD_WINDOW_US. La carga se
+ * reporta en ventanas de 100 ms, 1 s y 10 s (deslizantes sobre las ventanas de 100 ms), sobre el bitrate de
+ * MX_CAN1_Init (CAN_HW_Get_Bitrate).
+ *
+ * El largo de una trama estándar de datos es el del peor caso de bit stuffing:
+ * 47 + 8 * DLC + floor((34 + 8 * DLC - 1) / 4) bits (SOF a CRC con stuffing, más delimitadores, ACK, EOF y
+ * espacio entre tramas). Es una cota superior: con los datos reales el stuffing suele ser menor. Las tramas que
+ * descartan los filtros de hardware no se ven, por lo que la carga de otros IDs del bus no se cuenta.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _BUS_LOAD_H_
+#define _BUS_LOAD_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature medidor de carga del bus CAN o no */
+#ifndef USE_BUS_LOAD_FEATURE
+#define USE_BUS_LOAD_FEATURE                1
+#endif
+
+/** @brief Largo de la ventana base en us */
+#define BUS_LOAD_WINDOW_US                  100000U
+
+/** @brief Ventanas base en la ventana de 1 s */
+#define BUS_LOAD_WINDOWS_1S                 10U
+
+/** @brief Ventanas base en la ventana de 10 s (historia guardada) */
+#define BUS_LOAD_WINDOWS_10S                100U
+
+/** @brief Escala de la carga reportada: centésimas de % (10000 = 100 %) */
+#define BUS_LOAD_SCALE                      10000U
+
+/** @brief Largo de trama de carga del bus */
+#define BUS_LOAD_FRAME_LENGTH               8
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para reporte de carga del bus (cargas en centésimas de %)
+ *
+ */
+typedef struct
+{
+    uint16_t    load_100ms;                 /**< Carga de la última ventana de 100 ms */
+    uint16_t    load_1s;                    /**< Carga del último segundo */
+    uint16_t    load_10s;                   /**< Carga de los últimos 10 s (o desde el inicio, si es menos) */
+    uint16_t    load_100ms_max;             /**< Máxima carga de 100 ms en el último segundo */
+    uint32_t    frames_1s;                  /**< Tramas (recibidas y propias) en el último segundo */
+
+} bus_load_report_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+#if USE_BUS_LOAD_FEATURE == 1
+
+/**
+ * @brief Inicializa el medidor de carga del bus.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param bitrate   Bitrate del bus en bit/s
+ * @param now_us    Valor actual de la base de tiempo en us (inicio de la primera ventana)
+ * @retval None
+ */
+void BUS_LOAD_Init(uint32_t bitrate, uint32_t now_us);
+
+/**
+ * @brief Suma una trama observada (recibida o propia) a la ventana actual.
+ *
+ * Puede llamarse desde ISRs y desde la pasada principal (sección crítica con PRIMASK).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param dlc       Largo de la trama (DLC, se satura en 8)
+ * @retval None
+ */
+void BUS_LOAD_Record(uint8_t dlc);
+
+/**
+ * @brief Cierra las ventanas de BUS_LOAD_WINDOW_US vencidas, desde la pasada principal.
+ *
+ * Marca un reporte nuevo cada BUS_LOAD_WINDOWS_1S ventanas.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval None
+ */
+void BUS_LOAD_Process(uint32_t now_us);
+
+/**
+ * @brief Retorna si hay un reporte nuevo desde la última llamada (y lo marca como leído).
+ *
+ * @param report    Reporte a completar
+ * @retval true     Hay reporte nuevo
+ * @retval false    No hay reporte nuevo
+ */
+bool BUS_LOAD_Get_Report(bus_load_report_t* report);
+
+#endif /* USE_BUS_LOAD_FEATURE */
+
+/**
+ * @brief Largo en bits de una trama estándar de datos con el peor caso de bit stuffing.
+ *
+ * @param dlc       Largo de la trama (DLC, se satura en 8)
+ * @return uint32_t Bits en el bus, incluido el espacio entre tramas
+ */
+uint32_t BUS_LOAD_Frame_Bits(uint8_t dlc);
+
+/**
+ * @brief Codifica un reporte en la trama de carga del bus.
+ *
+ * Formato (little-endian, centésimas de %): bytes 0-1 carga de 100 ms, bytes 2-3 carga de 1 s, bytes 4-5 carga
+ * de 10 s, bytes 6-7 máxima carga de 100 ms en el último segundo.
+ *
+ * @param report    Reporte a codificar
+ * @param payload   Buffer de BUS_LOAD_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t BUS_LOAD_Encode_Frame(const bus_load_report_t* report, uint8_t* payload);
+
+#endif /* _BUS_LOAD_H_ */
@@ -16,6 +16,9 @@
  * Included files
  **********************************************************************************************************************/
 
+/* C includes */
+#include <stddef.h>
+
 /* Application includes */
 #include "types.h"
 #include "can_def.h"
@@ -27,18 +30,36 @@
 /**
  * @brief Bus 1: bus de variables internas
  *
+ * Las variables que se leen o escriben en cada pasada del estado kRUNNING (pedal, hombre muerto,
+ * modo de manejo, falla y estado de módulos) se agrupan al inicio de la estructura. Las variables
+ * analógicas de BMS, DCDC e inversor, de uso ocasional, van después.
+ *
  */
 typedef struct bus1
 {
+    /* ------------------------- Variables de cada pasada ------------------------- */
+
+    /* Variable velocidad [0:100] */
+    float 				    velocidad_inversor;
+
+    /* Marca de tiempo de llegada de la muestra de pedal (ver latency.h) */
+    uint32_t                pedal_timestamp;
+
+    /* Estructura con variables decodificadas de periféricos */
+    rx_peripherals_vars_t   Rx_Peripherals;
+
     /* Variables modo de manejo y fallas */
     driving_mode_t          driving_mode;
     failure_t               failure;
 
-    /* Variable velocidad [0:100] */
-    float 				    velocidad_inversor;
+    /* Variables estado general de cada módulo */
+    module_status_t         bms_status;
+    module_status_t         dcdc_status;
+    module_status_t         inversor_status;
+
+    /* --------------------------- Variables ocasionales -------------------------- */
 
     /* Estructuras con variables decodificadas de los módulos */
-    rx_peripherals_vars_t   Rx_Peripherals;
     rx_bms_vars_t           Rx_Bms;
     rx_dcdc_vars_t          Rx_Dcdc;
     rx_inversor_vars_t      Rx_Inversor;
@@ -48,11 +69,6 @@ typedef struct bus1
     st_dcdc_vars_t          St_Dcdc;
     st_inversor_vars_t      St_Inversor;
 
-    /* Variables estado general de cada módulo */
-    module_status_t         bms_status;
-    module_status_t         dcdc_status;
-    module_status_t         inversor_status;
-
 } typedef_bus1_t;
 
 /**
@@ -68,6 +84,8 @@ typedef struct bus2
     uint8_t  hombre_muerto;		        /**< CAN  0x013 */
     uint8_t  control_ok;		        /**< CAN  0x014 */
 
+    uint32_t nivel_velocidad_timestamp; /**< Llegada de la muestra de pedal que originó nivel_velocidad */
+
 } typedef_bus2_t;
 
 /**
@@ -103,19 +121,90 @@ typedef struct bus3
     uint8_t  potencia_inv;				/**< CAN 0x045 */
     uint8_t  inversor_ok;				/**< CAN 0x046 */
 
+    uint32_t pedal_timestamp;           /**< Llegada de CAN 0x002 (base de tiempo en us) */
+
 } typedef_bus3_t;
 
+/**
+ * @brief Bus 3 compartido: copia del bus de recepción CAN escrita desde la ISR de recepción
+ *
+ * Protegido con un contador de secuencia (seqlock): el escritor lo deja impar mientras modifica
+ * los datos y par al terminar. El lector copia los datos y reintenta si el contador cambió o era
+ * impar, por lo que el escritor nunca se bloquea.
+ *
+ */
+typedef struct bus3_shared
+{
+    volatile uint32_t   seq;            /**< Contador de secuencia */
+    typedef_bus3_t      data;           /**< Datos recibidos por CAN */
+
+} typedef_bus3_shared_t;
+
+/***********************************************************************************************************************
+ * Compile-time checks
+ **********************************************************************************************************************/
+
+/** @brief Fin de las variables de cada pasada en typedef_bus1_t */
+#define BUS1_HOT_SIZE                   21U
+
+_Static_assert(sizeof(rx_peripherals_vars_t) == 8, "rx_peripherals_vars_t cambió de tamaño");
+_Static_assert(sizeof(st_bms_vars_t) == 2, "st_bms_vars_t cambió de tamaño");
+_Static_assert(sizeof(st_dcdc_vars_t) == 1, "st_dcdc_vars_t cambió de tamaño");
+_Static_assert(sizeof(st_inversor_vars_t) == 2, "st_inversor_vars_t cambió de tamaño");
+
+_Static_assert(offsetof(typedef_bus1_t, velocidad_inversor) == 0, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, pedal_timestamp) == 4, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, Rx_Peripherals) == 8, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, driving_mode) == 16, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, failure) == 17, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, inversor_status) + 1 == BUS1_HOT_SIZE, "layout de typedef_bus1_t cambió");
+_Static_assert(offsetof(typedef_bus1_t, Rx_Bms) >= BUS1_HOT_SIZE, "variables ocasionales dentro de zona de cada pasada");
+_Static_assert(sizeof(typedef_bus1_t) == 108, "typedef_bus1_t cambió de tamaño");
+
 /***********************************************************************************************************************
  * Global variables declarations
  **********************************************************************************************************************/
 
-/** @brief Bus 1: Bus de datos */
-extern typedef_bus1_t bus_data;
+/** @brief Valores iniciales del bus 1 (bus de datos) */
+extern const typedef_bus1_t bus_data_init;
+
+/** @brief Valores iniciales del bus 2 (bus de transmisión de datos CAN) */
+extern const typedef_bus2_t bus_can_output_init;
 
-/** @brief Bus 2: Bus de transmisión de datos CAN */
-extern typedef_bus2_t bus_can_output;
+/** @brief Valores iniciales del bus 3 (bus de recepción de datos CAN y su copia compartida) */
+extern const typedef_bus3_t bus_can_input_init;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
 
-/** @brief Bus 3: Bus de recepción de datos CAN */
-extern typedef_bus3_t bus_can_input;
+/**
+ * @brief Inicio de escritura en bus de recepción CAN compartido.
+ *
+ * Solo debe llamarse desde el contexto que escribe el bus (ISR de recepción CAN).
+ *
+ * @param shared Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @retval None
+ */
+void BUSES_Input_Write_Begin(typedef_bus3_shared_t* shared);
+
+/**
+ * @brief Fin de escritura en bus de recepción CAN compartido.
+ *
+ * @param shared Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @retval None
+ */
+void BUSES_Input_Write_End(typedef_bus3_shared_t* shared);
+
+/**
+ * @brief Copia consistente del bus de recepción CAN compartido.
+ *
+ * Reintenta la copia hasta obtener una versión que no fue modificada durante la lectura.
+ *
+ * @param shared   Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @param snapshot Puntero a estructura de tipo typedef_bus3_t donde se guarda la copia
+ * @retval None
+ */
+void BUSES_Input_Snapshot(const typedef_bus3_shared_t* shared, typedef_bus3_t* snapshot);
 
 #endif /* _BUSES_H_ */
@@ -25,6 +25,7 @@
 #include "can_def.h"
 
 /* Application includes */
+#include "app_context.h"
 #include "decode_data.h"
 #include "buses.h"
 
@@ -34,6 +35,25 @@
 /* STM32 HAL include */
 #include "main.h"
 
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Separación mínima entre tramas de nivel de velocidad por evento en us (limita una ráfaga de pedal) */
+#define CAN_APP_VELOCIDAD_MIN_GAP_US        2000U
+
+/** @brief Sin muestras de pedal, nivel de velocidad se reenvía con este periodo en us */
+#define CAN_APP_VELOCIDAD_KEEPALIVE_US      100000U
+
+/** @brief Separación mínima entre envíos por cambio de estado de manejo en us (botones con rebote) */
+#define CAN_APP_ESTADO_MIN_INTERVAL_US      10000U
+
+/** @brief Sin cambios, estados y hombre muerto se reenvían con este periodo en us (el de la rotación, 7 x TIM7) */
+#define CAN_APP_ESTADO_MAX_INTERVAL_US      700000U
+
+/** @brief Desfase en us entre los primeros reenvíos de señales consecutivas de CAN_APP_Send_Changes */
+#define CAN_APP_TX_PHASE_US                 25000U
+
 /***********************************************************************************************************************
  * Public function prototypes
  **********************************************************************************************************************/
@@ -47,10 +67,10 @@
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void CAN_APP_Process(void);
+void CAN_APP_Process(app_context_t* ctx);
 
 /**
  * @brief Función de envío de datos de bus de salida CAN a módulo CAN.
@@ -59,22 +79,115 @@ void CAN_APP_Process(void);
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param bus_can_output Puntero a estructura de tipo typedef_bus2_t (bus de salida CAN)
+ * @param ctx Contexto de la aplicación (bus de salida CAN y objeto CAN)
+ * @retval None
+ */
+void CAN_APP_Send_BusData(app_context_t* ctx);
+
+#if USE_PEDAL_EVENT_TX_FEATURE == 1
+/**
+ * @brief Función de envío de nivel de velocidad por evento.
+ *
+ * Se llama al final de cada pasada, después de RAMPA_PEDAL_Process. Si en la pasada llegó una muestra de pedal,
+ * envía el nivel de velocidad recién calculado, respetando CAN_APP_VELOCIDAD_MIN_GAP_US desde el envío anterior;
+ * sin muestras, lo reenvía cada CAN_APP_VELOCIDAD_KEEPALIVE_US. Si los mailboxes están ocupados, reintenta en
+ * la próxima pasada.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (bus de salida CAN y objeto CAN)
+ * @retval None
+ */
+void CAN_APP_Send_Velocidad(app_context_t* ctx);
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+/**
+ * @brief Función de envío por cambio de las señales del bus de salida CAN.
+ *
+ * Se llama al final de cada pasada, después de RAMPA_PEDAL_Process. Envía, en el orden de can_tx_signal_t, cada
+ * señal cuya política (can_tx_policy de la configuración) lo pide: cambio fuera de la banda muerta con el
+ * intervalo mínimo cumplido, o intervalo máximo sin envíos. Reemplaza la rotación de CAN_APP_Send_BusData y el
+ * envío de nivel de velocidad por evento. Si los mailboxes están ocupados, la señal y las siguientes se
+ * reintentan en la próxima pasada. La política no ve los envíos del camino rápido de hombre muerto, por lo que
+ * ese flanco sale una vez más desde aquí.
+ *
+ * La primera llamada (primera pasada en kRUNNING) no envía: toma los valores actuales como enviados y escalona los
+ * primeros reenvíos cada CAN_APP_TX_PHASE_US, para que las señales no cumplan juntas su intervalo máximo en cada
+ * reenvío. Como con el envío por evento, nivel de velocidad sale recién con su primer cambio tras la espera de
+ * echo (el valor actual viene de muestras de pedal antiguas).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (bus de salida CAN, objeto CAN y estado de transmisión)
  * @retval None
  */
-void CAN_APP_Send_BusData(typedef_bus2_t *bus_can_output);
+void CAN_APP_Send_Changes(app_context_t* ctx);
+#endif /* USE_CAN_TX_POLICY_FEATURE */
 
 /**
  * @brief Función guardar mensaje CAN recibido en bus de entrada CAN.
  *
  * Según standard identifier que se recibió, guarda dato en la variable correspondiente
- * del bus de recepción CAN.
+ * del bus de recepción CAN compartido. Se llama desde la ISR de recepción; la escritura se
+ * protege con el contador de secuencia del bus compartido y nunca se bloquea.
+ * Con USE_DEADMAN_FAST_PATH_FEATURE, hombre muerto presionado dispara además el camino rápido
+ * (velocidad en cero y transmisión inmediata).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx   Contexto de la aplicación
+ * @param frame Puntero a trama CAN recibida
+ * @retval None
+ */
+void CAN_APP_Store_ReceivedMessage(app_context_t* ctx, const can_frame_t* frame);
+
+/**
+ * @brief Envío de la trama de un objeto CAN desde la pasada principal.
+ *
+ * Con el camino rápido de hombre muerto la ISR de recepción también transmite: el envío se hace con
+ * interrupciones enmascaradas para que ambos no elijan el mismo mailbox. Todo envío fuera de la ISR debe pasar
+ * por aquí.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param can_obj Objeto CAN de transmisión
+ * @return can_status_t
+ */
+can_status_t CAN_APP_Send_Message(CAN_t* can_obj);
+
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+/**
+ * @brief Función de envío de tramas de camino rápido pendientes.
+ *
+ * Deja en mailbox, en orden, nivel de velocidad y hombre muerto si el camino rápido de hombre muerto los marcó
+ * como pendientes. Las que no caben (mailboxes ocupados) quedan pendientes para la próxima llamada. Se llama
+ * desde la ISR de recepción y al inicio de CAN_APP_Process, con interrupciones enmascaradas durante el envío.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void CAN_APP_Send_Priority(app_context_t* ctx);
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+/**
+ * @brief Agrega el contador de secuencia de su ID a una trama de un byte de dato de Control.
+ *
+ * El contador (8 bits, uno por ID) va en CAN_SEQUENCE_BYTE y avanza con cada intento de envío: una trama que no
+ * entra en mailbox aparece en el receptor como un salto del contador, es decir, como pérdida. Tramas de otro
+ * largo (diagnóstico) o IDs sobre CAN_SEQUENCE_MAX_TX_ID no se modifican. Puede llamarse desde ISRs y desde la
+ * pasada principal (sección crítica con PRIMASK).
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx   Contexto de la aplicación (contadores por ID)
+ * @param frame Trama a transmitir (largo 1)
  * @retval None
  */
-void CAN_APP_Store_ReceivedMessage(void);
+void CAN_APP_Stamp_Sequence(app_context_t* ctx, can_frame_t* frame);
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
 
 #endif /* _CAN_APP_H_ */
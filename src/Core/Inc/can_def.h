@@ -28,6 +28,17 @@
 #define CAN_ID_CONTROL_NIVEL_VELOCIDAD		    	0x012
 #define CAN_ID_CONTROL_HOMBRE_MUERTO		    	0x013
 #define CAN_ID_CONTROL_OK			    			0x014
+#define CAN_ID_CONTROL_CARGA_CPU                    0x015
+#define CAN_ID_CONTROL_CARGA_BUS                    0x016
+
+/* ========================== Control (diagnóstico) ========================== */
+
+#define CAN_ID_CONTROL_DIAG_RECEPCION               0x01D
+#define CAN_ID_CONTROL_DIAG_LATENCIA                0x01E
+#define CAN_ID_CONTROL_DIAG_PROFILER                0x01F
+
+/* Petición de diagnóstico hacia Control (dentro del filtro de recepción 0x000-0x007) */
+#define CAN_ID_CONTROL_DIAG_PETICION                0x007
 
 /* =============================== Perifericos =============================== */
 
@@ -64,6 +75,17 @@
 #define CAN_ID_INVERSOR_POTENCIA					0x045
 #define CAN_ID_INVERSOR_OK							0x046
 
+/********************************************************************************
+ *                          Contador de secuencia                               *
+ *******************************************************************************/
+
+/* Tramas de un byte de dato con contador de secuencia (8 bits, uno por ID): el contador va en el byte 1, DLC 2 */
+#define CAN_SEQUENCE_BYTE                           1
+#define CAN_SEQUENCE_LENGTH                         (CAN_SEQUENCE_BYTE + 1)
+
+/* Mayor ID de Control con contador de secuencia */
+#define CAN_SEQUENCE_MAX_TX_ID                      0x01F
+
 /********************************************************************************
  *                                CAN values                                    *
  *******************************************************************************/
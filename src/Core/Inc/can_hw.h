@@ -24,6 +24,10 @@
 #include "can_api.h"
 #include "can_wrapper.h"
 
+/* Application includes */
+#include "app_context.h"
+#include "app_rtos.h"
+
 /* STM32 HAL include */
 #include "main.h"
 
@@ -31,44 +35,141 @@
  * Macros
  **********************************************************************************************************************/
 
-/***********************************************************************************************************************
- * Types declarations
- **********************************************************************************************************************/
+/** @brief Define si usar backend SocketCAN (Linux, build de host) en vez del wrapper HAL */
+#ifndef USE_SOCKETCAN_BACKEND
+#define USE_SOCKETCAN_BACKEND               0
+#endif
+
+#if USE_SOCKETCAN_BACKEND == 1
+#include "can_socketcan.h"
+#endif /* USE_SOCKETCAN_BACKEND */
+
+/** @brief Define si usar backend de registros bxCAN (can_ll.h) en vez del wrapper HAL para transmitir y recibir */
+#ifndef USE_CAN_LL_BACKEND
+#define USE_CAN_LL_BACKEND                  0
+#endif
+
+#if USE_CAN_LL_BACKEND == 1 && USE_SOCKETCAN_BACKEND == 0
+#include "can_ll.h"
+#endif /* USE_CAN_LL_BACKEND */
 
 /**
- * @brief Tipo de dato can_rx_status_t para estado de recepción de mensaje CAN
+ * @brief Define si usar recepción CAN adaptativa o no (sin ella, una interrupción por trama)
  *
+ * Con tasa de recepción baja, cada trama interrumpe (CAN_IT_RX_FIFO0_MSG_PENDING). Cuando la tasa de una ventana
+ * de CAN_HW_RX_RATE_WINDOW_US alcanza el umbral de entrada, se enmascara esa interrupción y la FIFO 0 se lee al
+ * inicio de cada pasada de la superloop (CAN_HW_Poll_Rx); la interrupción de FIFO llena queda activa para no
+ * perder tramas si una pasada se atrasa. Con la tasa bajo el umbral de salida vuelve la interrupción por trama.
+ * Solo para la superloop: con FreeRTOS la tarea de recepción ya agrupa las tramas.
  */
-typedef enum
-{
-	CAN_MSG_RECEIVED = 0, 		/**< Mensaje CAN recibido */
-    CAN_MSG_NOT_RECEIVED   		/**< Mensaje CAN no recibido */
-} can_rx_status_t;
+#ifndef USE_CAN_RX_COALESCING_FEATURE
+#if USE_FREERTOS_FEATURE == 1
+#define USE_CAN_RX_COALESCING_FEATURE       0
+#else
+#define USE_CAN_RX_COALESCING_FEATURE       1
+#endif /* USE_FREERTOS_FEATURE */
+#endif
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+
+/** @brief Ventana de medición de la tasa de recepción en us (el tráfico periódico de los módulos es de 100 ms) */
+#define CAN_HW_RX_RATE_WINDOW_US            100000U
+
+/** @brief Tasa de recepción desde la que se lee la FIFO por pasada en tramas/s (~25 % del bus a 250 kbit/s) */
+#define CAN_HW_RX_POLL_ENTER_FPS            1000U
+
+/** @brief Tasa de recepción bajo la que vuelve la interrupción por trama en tramas/s (histéresis) */
+#define CAN_HW_RX_POLL_EXIT_FPS             500U
+
+/** @brief Máximo de tramas leídas por interrupción o por pasada (profundidad de la FIFO 0 del bxCAN) */
+#define CAN_HW_RX_BUDGET                    3U
+
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
 
 /**
- * @brief Tipo de dato can_tx_status_t para estado de transmisión de mensaje CAN
+ * @brief Tipo de dato estructura para estadísticas de la recepción CAN adaptativa desde CAN_HW_Init
  *
  */
-typedef enum
+typedef struct
 {
-    CAN_TX_READY = 0, 		/**< Listo para transmitir mensaje CAN */
-    CAN_TX_NOT_READY   		/**< No listo para transmitir mensaje CAN */
-} can_tx_status_t;
+    uint32_t    irqs;                       /**< Interrupciones de mensaje pendiente en FIFO 0 */
+    uint32_t    irq_frames;                 /**< Tramas leídas en esas interrupciones */
+    uint32_t    irq_frames_max;             /**< Máximo de tramas leídas en una interrupción */
+    uint32_t    full_irqs;                  /**< Interrupciones de FIFO 0 llena (lectura por pasada atrasada) */
+    uint32_t    full_frames;                /**< Tramas leídas en esas interrupciones */
+    uint32_t    polls;                      /**< Pasadas que leyeron al menos una trama */
+    uint32_t    poll_frames;                /**< Tramas leídas por pasada */
+    uint32_t    poll_frames_max;            /**< Máximo de tramas leídas en una pasada */
+    uint32_t    to_polled;                  /**< Cambios a lectura por pasada */
+    uint32_t    to_irq;                     /**< Cambios a interrupción por trama */
+    uint32_t    rate_fps;                   /**< Tasa de recepción de la última ventana en tramas/s */
+    bool        polled;                     /**< Modo actual: lectura por pasada */
+
+} can_hw_rx_stats_t;
 
 /***********************************************************************************************************************
  * Public function prototypes
  **********************************************************************************************************************/
 
-void CAN_HW_Init(void);
+/**
+ * @brief Inicializa CAN para un contexto de la aplicación.
+ *
+ * Inicializa el objeto CAN de transmisión del contexto con el backend seleccionado y registra el contexto
+ * que actualizan las interrupciones de recepción CAN y de TIM7 (hay un único periférico).
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void CAN_HW_Init(app_context_t* ctx);
 
-/***********************************************************************************************************************
- * Global variables declarations
- **********************************************************************************************************************/
+/**
+ * @brief Retorna el bitrate del bus configurado en MX_CAN1_Init.
+ *
+ * Tiempo de bit de 1 + BS1 + BS2 cuantos, de Prescaler ciclos de PCLK1 cada uno. Llamar después de CAN_HW_Init.
+ *
+ * @param None
+ * @return uint32_t     Bitrate en bit/s
+ */
+uint32_t CAN_HW_Get_Bitrate(void);
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
 
-/** Bandera mensaje recibido CAN */
-extern can_rx_status_t flag_rx_can;
+/**
+ * @brief Lectura de la FIFO 0 al inicio de una pasada de la superloop.
+ *
+ * En modo lectura por pasada guarda las tramas pendientes (a lo más CAN_HW_RX_BUDGET) como la ISR de recepción y
+ * evalúa la tasa de recepción para volver a la interrupción por trama. En modo interrupción no hace nada.
+ *
+ * @param None
+ * @retval None
+ */
+void CAN_HW_Poll_Rx(void);
+
+/**
+ * @brief Cambia los umbrales de la recepción adaptativa.
+ *
+ * Por defecto CAN_HW_RX_POLL_ENTER_FPS y CAN_HW_RX_POLL_EXIT_FPS; puede llamarse antes de CAN_HW_Init. Con
+ * enter_fps en UINT32_MAX la recepción queda siempre con interrupción por trama; con 0, pasa a lectura por pasada
+ * en la primera ventana.
+ *
+ * @param enter_fps     Tasa desde la que se lee por pasada en tramas/s
+ * @param exit_fps      Tasa bajo la que vuelve la interrupción por trama en tramas/s
+ * @retval None
+ */
+void CAN_HW_Set_Rx_Thresholds(uint32_t enter_fps, uint32_t exit_fps);
+
+/**
+ * @brief Retorna las estadísticas de la recepción adaptativa desde CAN_HW_Init.
+ *
+ * @param stats     Estadísticas a completar
+ * @retval None
+ */
+void CAN_HW_Get_Rx_Stats(can_hw_rx_stats_t* stats);
 
-/** Bandera transmisión CAN */
-extern can_tx_status_t flag_tx_can;
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
 
 #endif /* _CAN_HW_H_ */
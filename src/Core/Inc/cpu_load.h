@@ -0,0 +1,172 @@
+/**
+ * @file cpu_load.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para cpu_load.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _CPU_LOAD_H_
+#define _CPU_LOAD_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* Application includes */
+#include "types.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature monitor de carga de CPU o no */
+#ifndef USE_CPU_LOAD_FEATURE
+#define USE_CPU_LOAD_FEATURE                1
+#endif
+
+/** @brief Plazo máximo entre dos pasadas de la superloop en us (pasadas más largas cuentan como deadline perdido) */
+#define CPU_LOAD_DEADLINE_US                1000U
+
+/** @brief log2 del límite inferior del primer bin del histograma de periodo (ciclos) */
+#define CPU_LOAD_HIST_MIN_LOG2              6
+
+/** @brief Número de octavas cubiertas por el histograma de periodo */
+#define CPU_LOAD_HIST_OCTAVES               12
+
+/** @brief Bits de sub-división de cada octava (4 bins por octava) */
+#define CPU_LOAD_HIST_SUB_BITS              2
+
+/** @brief Número de bins del histograma de periodo */
+#define CPU_LOAD_HIST_BINS                  (CPU_LOAD_HIST_OCTAVES << CPU_LOAD_HIST_SUB_BITS)
+
+/** @brief Largo de trama de estado de carga de CPU */
+#define CPU_LOAD_FRAME_LENGTH               8
+
+#if USE_CPU_LOAD_FEATURE == 1
+
+/** @brief Lectura del contador de ciclos DWT->CYCCNT */
+#define CPU_LOAD_GET_CYCLES()               (DWT->CYCCNT)
+
+/** @brief Habilita el contador de ciclos DWT->CYCCNT (sin reiniciarlo, puede estar compartido con el profiler) */
+#define CPU_LOAD_ENABLE_CYCLE_COUNTER()     do {                                                    \
+                                                CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     \
+                                                DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                \
+                                            } while (0)
+
+#endif /* USE_CPU_LOAD_FEATURE */
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para reporte de carga de CPU de una ventana de un segundo
+ *
+ */
+typedef struct
+{
+    uint8_t     load_pct;                   /**< Carga de CPU [0:100] % */
+    uint32_t    passes;                     /**< Pasadas de la superloop en la ventana */
+    uint32_t    period_min_us;              /**< Periodo mínimo de la superloop en us */
+    uint32_t    period_max_us;              /**< Periodo máximo de la superloop en us */
+    uint32_t    period_p99_us;              /**< Percentil 99 del periodo en us (límite superior de su bin) */
+    uint32_t    missed_deadlines;           /**< Deadlines perdidos en la ventana */
+    uint32_t    missed_deadlines_total;     /**< Deadlines perdidos desde el inicio */
+
+} cpu_load_report_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa el monitor de carga de CPU.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param hz            Frecuencia del contador de ciclos en Hz (largo de la ventana de reporte)
+ * @param deadline_us   Plazo máximo entre dos pasadas de la superloop en us
+ * @retval None
+ */
+void CPU_LOAD_Init(uint32_t hz, uint32_t deadline_us);
+
+/**
+ * @brief Marca el inicio de una pasada de la superloop.
+ *
+ * Registra el periodo desde la pasada anterior y cierra la ventana de reporte al cumplirse un segundo.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @param busy          true si la pasada tiene trabajo pendiente (evento CAN RX/TX), false si solo hace polling
+ * @retval None
+ */
+void CPU_LOAD_Pass_Begin(uint32_t now_cycles, bool busy);
+
+/**
+ * @brief Marca el fin de una pasada de la superloop.
+ *
+ * Si la pasada tenía trabajo, su duración se acumula como tiempo ocupado; si no, como tiempo idle.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @retval None
+ */
+void CPU_LOAD_Pass_End(uint32_t now_cycles);
+
+/**
+ * @brief Acumula tiempo dormido en WFI (idle.c).
+ *
+ * Desde la primera llamada la carga de cada ventana es la fracción del tiempo despierto, y el deadline se
+ * evalúa sobre el tiempo despierto entre pasadas (dormir esperando trabajo no es un deadline perdido).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param cycles        Ciclos dormidos
+ * @retval None
+ */
+void CPU_LOAD_Sleep(uint32_t cycles);
+
+/**
+ * @brief Retorna si hay un reporte nuevo desde la última llamada (y lo marca como leído).
+ *
+ * @param report        Reporte a completar
+ * @retval true         Hay reporte nuevo
+ * @retval false        No hay reporte nuevo
+ */
+bool CPU_LOAD_Get_Report(cpu_load_report_t* report);
+
+/**
+ * @brief Retorna el bin del histograma de periodo que corresponde a una duración en ciclos.
+ *
+ * @param cycles        Duración en ciclos
+ * @return uint8_t      Índice de bin [0:CPU_LOAD_HIST_BINS-1]
+ */
+uint8_t CPU_LOAD_Hist_Bin(uint32_t cycles);
+
+/**
+ * @brief Retorna el límite superior (exclusivo) en ciclos de un bin del histograma de periodo.
+ *
+ * @param bin           Índice de bin
+ * @return uint32_t     Límite superior en ciclos
+ */
+uint32_t CPU_LOAD_Hist_Bin_Upper(uint8_t bin);
+
+/**
+ * @brief Codifica un reporte en la trama de estado de carga de CPU.
+ *
+ * Formato (little-endian): byte 0 carga %, bytes 1-2 periodo mínimo us, bytes 3-4 periodo máximo us,
+ * bytes 5-6 periodo p99 us, byte 7 deadlines perdidos en la ventana. Campos saturados.
+ *
+ * @param report        Reporte a codificar
+ * @param payload       Buffer de CPU_LOAD_FRAME_LENGTH bytes
+ * @return uint8_t      Largo de la trama
+ */
+uint8_t CPU_LOAD_Encode_Frame(const cpu_load_report_t* report, uint8_t* payload);
+
+#endif /* _CPU_LOAD_H_ */
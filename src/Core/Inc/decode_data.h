@@ -17,23 +17,9 @@
  **********************************************************************************************************************/
 
 /* Application includes */
-#include "buses.h"
+#include "app_context.h"
 #include "can_def.h"
 
-/***********************************************************************************************************************
- * Types declarations
- **********************************************************************************************************************/
-
-/**
- * @brief Tipo de dato decode_status_t para bandera de decodificación
- *
- */
-typedef enum
-{
-    DECODIFICA = 0, 	/**< Valor para decodificar */
-    NO_DECODIFICA   	/**< Valor para no decodificar */
-} decode_status_t;
-
 /***********************************************************************************************************************
  * Public function prototypes
  **********************************************************************************************************************/
@@ -47,19 +33,9 @@ typedef enum
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void DECODE_DATA_Process(void);
-
-/***********************************************************************************************************************
- * Global variables declarations
- **********************************************************************************************************************/
-
-/**
- * @brief Bandera para ejecutar bloque de decodificación de datos
- *
- */
-extern decode_status_t flag_decodificar;
+void DECODE_DATA_Process(app_context_t* ctx);
 
 #endif /* _DECODE_DATA_H_ */
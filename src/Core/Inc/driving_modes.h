@@ -17,7 +17,7 @@
  **********************************************************************************************************************/
 
 /* Application includes */
-#include "buses.h"
+#include "app_context.h"
 #include "indicators.h"
 
 /***********************************************************************************************************************
@@ -32,6 +32,14 @@
  * Public function prototypes
  **********************************************************************************************************************/
 
+/**
+ * @brief Inicializa el estado de la máquina de modos de manejo de un contexto.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void DRIVING_MODES_Init(app_context_t* ctx);
+
 /**
  * @brief Función principal máquina de modos de manejo.
  *
@@ -39,9 +47,9 @@
  * 
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void DRIVING_MODES_Process(void);
+void DRIVING_MODES_Process(app_context_t* ctx);
 
 #endif /* _DRIVING_MODES_H_ */
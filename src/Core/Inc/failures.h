@@ -17,16 +17,53 @@
  **********************************************************************************************************************/
 
 /* Application includes */
-#include "buses.h"
+#include "app_context.h"
+
+/* STM32 HAL include */
+#include "main.h"
 
 /***********************************************************************************************************************
  * Macros
  **********************************************************************************************************************/
 
+/*
+ * Ventanas de persistencia de las transiciones de la máquina de fallas. Una transición solo se realiza cuando su
+ * condición se mantiene durante al menos MIN_COUNT muestras recibidas (pasadas con datos decodificados nuevos) y al
+ * menos MIN_TIME_MS milisegundos. Un valor de 0 deshabilita el criterio correspondiente. Son los valores de
+ * app_config_default; cada contexto puede usar otros (failures_config_t).
+ */
+
+/** @brief Ventana para transiciones hacia una falla más severa (OK -> CAUTION1, OK/CAUTION1 -> CAUTION2) */
+#define FAILURES_ESCALATE_MIN_COUNT         3U
+#define FAILURES_ESCALATE_MIN_TIME_MS       50U
+
+/** @brief Ventana para transiciones hacia una falla menos severa (CAUTION2 -> CAUTION1, CAUTION1 -> OK) */
+#define FAILURES_RECOVER_MIN_COUNT          5U
+#define FAILURES_RECOVER_MIN_TIME_MS        500U
+
+/** @brief Ventana para transición a AUTOKILL (NUM_OF_PROBLEM_MODULES módulos en PROBLEM) */
+#define FAILURES_AUTOKILL_MIN_COUNT         5U
+#define FAILURES_AUTOKILL_MIN_TIME_MS       200U
+
+/** @brief Número de módulos en PROBLEM que se considera condición crítica (camino rápido a AUTOKILL) */
+#define FAILURES_CRITICAL_NUM_OF_PROBLEM_MODULES    3
+
+/** @brief Ventana para transición a AUTOKILL por condición crítica */
+#define FAILURES_CRITICAL_MIN_COUNT         1U
+#define FAILURES_CRITICAL_MIN_TIME_MS       0U
+
 /***********************************************************************************************************************
  * Public functions prototypes
  **********************************************************************************************************************/
 
+/**
+ * @brief Inicializa el estado de la máquina de fallas de un contexto.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void FAILURES_Init(app_context_t* ctx);
+
 /**
  * @brief Función principal máquina de fallas.
  *
@@ -37,9 +74,9 @@
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void FAILURES_Process(void);
+void FAILURES_Process(app_context_t* ctx);
 
 #endif /* _FAILURES_H_ */
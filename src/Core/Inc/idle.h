@@ -0,0 +1,135 @@
+/**
+ * @file idle.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para idle.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Idle de la superloop con WFI: en vez de girar sobre MX_APP_Run_Pass, el núcleo duerme hasta que una ISR deja
+ * trabajo pendiente (bit IDLE_EVENT_*). Fuentes de trabajo: recepción CAN (CAN1_RX0), trigger de transmisión
+ * (TIM7) y SysTick cada IDLE_TICK_PERIOD_MS, que mantiene el trabajo temporizado (timeouts de monitoreo, LEDs)
+ * con el mismo periodo máximo entre pasadas que la superloop sin idle.
+ *
+ * La consulta de trabajo pendiente y WFI se hacen con PRIMASK en 1: una interrupción que llega entre ambas deja
+ * su pendiente en el NVIC y WFI retorna de inmediato, sin perder el despertar. La ISR corre al bajar PRIMASK.
+ *
+ * El tiempo dormido se mide con la base de tiempo (TIM2 sigue contando en sleep) y, con el monitor de carga de
+ * CPU, también en ciclos: la carga reportada pasa a ser la fracción del tiempo despierto (ciclo de trabajo real).
+ *
+ * En el build de host __WFI avanza el reloj de la HAL de simulación hasta el próximo evento (trama, TIM7 o
+ * SysTick simulado), que llama a las mismas ISRs.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _IDLE_H_
+#define _IDLE_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature idle con WFI o no (sin ella la superloop gira sin dormir) */
+#ifndef USE_WFI_IDLE_FEATURE
+#define USE_WFI_IDLE_FEATURE                1
+#endif
+
+/** @brief Trabajo pendiente: mensaje CAN recibido */
+#define IDLE_EVENT_CAN_RX                   (1UL << 0)
+
+/** @brief Trabajo pendiente: trigger de transmisión de TIM7 */
+#define IDLE_EVENT_CAN_TX                   (1UL << 1)
+
+/** @brief Trabajo pendiente: tick de trabajo temporizado */
+#define IDLE_EVENT_TICK                     (1UL << 2)
+
+/** @brief Periodo del tick de trabajo temporizado en ms (SysTick a 1 kHz) */
+#define IDLE_TICK_PERIOD_MS                 1U
+
+/** @brief Latencia máxima aceptada desde el trabajo pendiente hasta el inicio de la pasada en us */
+#define IDLE_WAKE_LATENCY_MAX_US            100U
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para estadísticas del idle desde la primera espera (fin del arranque)
+ *
+ */
+typedef struct
+{
+    uint64_t    elapsed_us;                 /**< Tiempo total observado en us */
+    uint64_t    sleep_us;                   /**< Tiempo dormido en WFI en us */
+    uint32_t    wakeups;                    /**< Retornos de IDLE_Wait con trabajo pendiente */
+    uint32_t    sleeps;                     /**< WFI ejecutados */
+    uint32_t    spurious_wakeups;           /**< WFI que despertaron sin trabajo pendiente */
+    uint32_t    wake_latency_max_us;        /**< Latencia máxima trabajo pendiente -> pasada en us */
+    uint32_t    wake_latency_over;          /**< Pasadas con latencia sobre IDLE_WAKE_LATENCY_MAX_US */
+
+} idle_stats_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+#if USE_WFI_IDLE_FEATURE == 1
+
+/**
+ * @brief Inicializa el idle: borra trabajo pendiente y estadísticas.
+ *
+ * No es static, por lo que puede ser usada por otros archivos. Llamar después de TIMEBASE_Init.
+ *
+ * @param None
+ * @retval None
+ */
+void IDLE_Init(void);
+
+/**
+ * @brief Marca trabajo pendiente para la superloop.
+ *
+ * Puede llamarse desde ISRs de cualquier prioridad (sección crítica con PRIMASK).
+ *
+ * @param events    Bits IDLE_EVENT_*
+ * @retval None
+ */
+void IDLE_Set_Pending_FromISR(uint32_t events);
+
+/**
+ * @brief Tick de trabajo temporizado, desde SysTick_Handler.
+ *
+ * Marca IDLE_EVENT_TICK cada IDLE_TICK_PERIOD_MS llamadas.
+ *
+ * @param None
+ * @retval None
+ */
+void IDLE_Tick_FromISR(void);
+
+/**
+ * @brief Duerme con WFI hasta que haya trabajo pendiente y lo retorna (borrándolo).
+ *
+ * Si ya hay trabajo pendiente retorna sin dormir.
+ *
+ * @return uint32_t     Bits IDLE_EVENT_* pendientes
+ */
+uint32_t IDLE_Wait(void);
+
+/**
+ * @brief Retorna las estadísticas del idle desde la primera espera (fin del arranque).
+ *
+ * @param stats     Estadísticas a completar
+ * @retval None
+ */
+void IDLE_Get_Stats(idle_stats_t* stats);
+
+#endif /* USE_WFI_IDLE_FEATURE */
+
+#endif /* _IDLE_H_ */
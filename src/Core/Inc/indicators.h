@@ -17,7 +17,7 @@
  **********************************************************************************************************************/
 
 /* Application includes */
-#include "buses.h"
+#include "app_context.h"
 
 /* BSP (board support package) include */
 #include "stm32f4xx_control.h"
@@ -36,20 +36,20 @@
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void INDICATORS_Process(void);
+void INDICATORS_Process(app_context_t* ctx);
 
 /**
  * @brief Actualiza LEDs para indicar confirmación de los módulos durante inicialización
  * 
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void INDICATORS_Update_ModulesLEDs(void);
+void INDICATORS_Update_ModulesLEDs(app_context_t* ctx);
 
 /**
  * @brief Indicación de que la tarjeta ha finalizado la inicialización.
@@ -0,0 +1,112 @@
+/**
+ * @file irq_priority.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Plan de prioridades de interrupciones de tarjeta Control (tabla central)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Grupo de prioridades NVIC_PRIORITYGROUP_4 (el que configura HAL_Init): los 4 bits de prioridad del STM32F446
+ * son de pre-emption (0 es la más alta) y no hay subprioridad. Una interrupción solo interrumpe a otra de número
+ * de pre-emption mayor; a igual número espera a que la otra termine.
+ *
+ *   Pre-emption  Interrupción   Motivo
+ *   0            SysTick        Tick de la HAL (HAL_GetTick y timeouts de la HAL). La ISR son pocos ciclos, por lo
+ *                               que no retrasa a las demás, y el tick no se atrasa durante ISRs largas.
+ *   1            CAN1_RX0       Recepción CAN: interrumpe al trigger de transmisión y a la pasada principal, así
+ *                               la FIFO de 3 tramas no se desborda y el camino rápido de hombre muerto no espera.
+ *   2            TIM7           Trigger de transmisión: solo marca la bandera de la pasada principal.
+ *
+ * Con USE_FREERTOS_FEATURE (app_rtos.h), el port de FreeRTOS baja SysTick y PendSV a la prioridad 15 al iniciar
+ * el scheduler; CAN1_RX0 y TIM7 usan la API ...FromISR, por lo que no pueden ser más prioritarias que
+ * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY (1).
+ *
+ * La base de tiempo en us (TIM2, timebase.h) es un contador libre sin interrupción y no depende de este plan.
+ * Las secciones críticas de can_app.c (PRIMASK) bloquean todas las interrupciones mientras se escribe un mailbox.
+ *
+ * Los archivos que habilitan interrupciones (can.c, tim.c) incluyen este header: desde ahí HAL_NVIC_EnableIRQ fija
+ * antes la prioridad de la tabla, y no compila si la interrupción no tiene entrada. Control.ioc tiene las mismas
+ * prioridades, para que el código que regenera CubeMX coincida con la tabla.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _IRQ_PRIORITY_H_
+#define _IRQ_PRIORITY_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* STM32 HAL include */
+#include "main.h"
+
+/* Application includes */
+#include "app_rtos.h"
+
+#if USE_FREERTOS_FEATURE == 1
+#include "FreeRTOSConfig.h"
+#endif /* USE_FREERTOS_FEATURE */
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Grupo de prioridades (sin bits de subprioridad) */
+#define IRQ_PRIORITY_GROUP                      NVIC_PRIORITYGROUP_4
+
+/* -------------------------------------------- Tabla de prioridades -------------------------------------------- */
+
+/** @brief SysTick: tick de la HAL */
+#define IRQ_PRIORITY_PREEMPT_SysTick_IRQn       0U
+#define IRQ_PRIORITY_SUB_SysTick_IRQn           0U
+
+/** @brief CAN1 RX0: recepción CAN */
+#define IRQ_PRIORITY_PREEMPT_CAN1_RX0_IRQn      1U
+#define IRQ_PRIORITY_SUB_CAN1_RX0_IRQn          0U
+
+/** @brief TIM7: trigger de transmisión CAN */
+#define IRQ_PRIORITY_PREEMPT_TIM7_IRQn          2U
+#define IRQ_PRIORITY_SUB_TIM7_IRQn              0U
+
+/* ------------------------------------------------------------------------------------------------------------ */
+
+/**
+ * @brief Habilita una interrupción con la prioridad de la tabla.
+ *
+ * Reemplaza a la función de la HAL en los archivos que incluyen este header (también en el código generado por
+ * CubeMX): una interrupción sin entrada IRQ_PRIORITY_PREEMPT_<irq> / IRQ_PRIORITY_SUB_<irq> no compila.
+ */
+#define HAL_NVIC_EnableIRQ(IRQn)                do {                                                            \
+                                                    HAL_NVIC_SetPriority((IRQn), IRQ_PRIORITY_PREEMPT_##IRQn,   \
+                                                                         IRQ_PRIORITY_SUB_##IRQn);              \
+                                                    (HAL_NVIC_EnableIRQ)(IRQn);                                 \
+                                                } while (0)
+
+/***********************************************************************************************************************
+ * Compile-time checks
+ **********************************************************************************************************************/
+
+_Static_assert(IRQ_PRIORITY_PREEMPT_SysTick_IRQn < (1U << __NVIC_PRIO_BITS), "prioridad SysTick fuera de rango");
+_Static_assert(IRQ_PRIORITY_PREEMPT_CAN1_RX0_IRQn < (1U << __NVIC_PRIO_BITS), "prioridad CAN1_RX0 fuera de rango");
+_Static_assert(IRQ_PRIORITY_PREEMPT_TIM7_IRQn < (1U << __NVIC_PRIO_BITS), "prioridad TIM7 fuera de rango");
+
+_Static_assert(IRQ_PRIORITY_SUB_SysTick_IRQn == 0U && IRQ_PRIORITY_SUB_CAN1_RX0_IRQn == 0U &&
+               IRQ_PRIORITY_SUB_TIM7_IRQn == 0U, "NVIC_PRIORITYGROUP_4 no tiene bits de subprioridad");
+
+_Static_assert(TICK_INT_PRIORITY == IRQ_PRIORITY_PREEMPT_SysTick_IRQn,
+               "TICK_INT_PRIORITY (stm32f4xx_hal_conf.h) debe ser la prioridad de SysTick de la tabla");
+
+_Static_assert(IRQ_PRIORITY_PREEMPT_CAN1_RX0_IRQn < IRQ_PRIORITY_PREEMPT_TIM7_IRQn,
+               "la recepción CAN debe interrumpir al trigger de transmisión");
+
+_Static_assert(IRQ_PRIORITY_PREEMPT_SysTick_IRQn <= IRQ_PRIORITY_PREEMPT_CAN1_RX0_IRQn,
+               "el tick de la HAL no debe esperar a la recepción CAN");
+
+#if USE_FREERTOS_FEATURE == 1
+_Static_assert(IRQ_PRIORITY_PREEMPT_CAN1_RX0_IRQn >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY &&
+               IRQ_PRIORITY_PREEMPT_TIM7_IRQn >= configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY,
+               "las ISRs que usan la API de FreeRTOS deben estar bajo configMAX_SYSCALL_INTERRUPT_PRIORITY");
+#endif /* USE_FREERTOS_FEATURE */
+
+#endif /* _IRQ_PRIORITY_H_ */
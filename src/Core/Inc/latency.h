@@ -0,0 +1,104 @@
+/**
+ * @file latency.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para latency.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* Application includes */
+#include "types.h"
+#include "profiler.h"
+#include "timebase.h"
+
+/* CAN driver include */
+#include "can_api.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature medición de latencia pedal-inversor o no */
+#ifndef USE_LATENCY_FEATURE
+#define USE_LATENCY_FEATURE                 1
+#endif
+
+/** @brief Valor de marca de tiempo que indica "sin muestra" */
+#define LATENCY_NO_TIMESTAMP                0U
+
+#if USE_LATENCY_FEATURE == 1
+
+/**
+ * @brief Marca de tiempo de llegada en us (base de tiempo TIM2).
+ *
+ * Se fuerza el bit 0 para no confundir una marca válida con LATENCY_NO_TIMESTAMP (error de un us).
+ */
+#define LATENCY_GET_TIMESTAMP()             (TIMEBASE_Get_Us() | 1U)
+
+#endif /* USE_LATENCY_FEATURE */
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa la medición de latencia.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void LATENCY_Init(void);
+
+/**
+ * @brief Registra la salida a mailbox de una trama de nivel de velocidad.
+ *
+ * Registra la latencia desde la llegada de la muestra de pedal que originó la trama. Cada muestra
+ * se registra una sola vez (la primera trama que la transporta); tramas que repiten el valor de
+ * una muestra ya registrada se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param timestamp Marca de tiempo de llegada de la muestra de pedal (LATENCY_NO_TIMESTAMP si no hay)
+ * @param now       Valor actual de la base de tiempo en us
+ * @retval None
+ */
+void LATENCY_Record_Tx(uint32_t timestamp, uint32_t now);
+
+/**
+ * @brief Retorna las estadísticas de latencia pedal-inversor en us.
+ *
+ * @return const profiler_stats_t*
+ */
+const profiler_stats_t* LATENCY_Get_Stats(void);
+
+/**
+ * @brief Reinicia las estadísticas de latencia.
+ *
+ * @param None
+ * @retval None
+ */
+void LATENCY_Reset(void);
+
+/**
+ * @brief Prepara la siguiente trama de diagnóstico de latencia.
+ *
+ * Mismo formato que las tramas del profiler (ver PROFILER_Encode_Frame), en us y con etapa 0.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @retval None
+ */
+void LATENCY_Export_Next(can_frame_t* frame);
+
+#endif /* _LATENCY_H_ */
@@ -18,7 +18,7 @@
 
 /* Application includes */
 #include "monitoring_api.h"
-#include "buses.h"
+#include "app_context.h"
 
 /***********************************************************************************************************************
  * Public function prototypes
@@ -29,9 +29,9 @@
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param   None
+ * @param   ctx Contexto de la aplicación
  * @retval  None
  */
-void MONITORING_Process(void);
+void MONITORING_Process(app_context_t* ctx);
 
 #endif /* _MONITORING_H_ */
@@ -0,0 +1,288 @@
+/**
+ * @file profiler.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para profiler.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* Application includes */
+#include "types.h"
+
+/* CAN driver include */
+#include "can_api.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature profiler de ciclos o no (0: el profiler se compila fuera por completo) */
+#ifndef USE_PROFILER_FEATURE
+#define USE_PROFILER_FEATURE                0
+#endif
+
+/** @brief Número de bins del histograma log2 de cada etapa */
+#define PROFILER_HIST_BINS                  16
+
+/** @brief Bin i cubre [2^(i+MIN_LOG2), 2^(i+MIN_LOG2+1)) ciclos; el primer y último bin además acumulan los extremos */
+#define PROFILER_HIST_MIN_LOG2              5
+
+/** @brief Bins del histograma por trama de diagnóstico */
+#define PROFILER_HIST_BINS_PER_FRAME        3
+
+/** @brief Número de registros (tramas) por etapa: min/max, media/conteo y bins del histograma */
+#define PROFILER_RECORDS_PER_STAGE          (2 + (PROFILER_HIST_BINS + PROFILER_HIST_BINS_PER_FRAME - 1) / PROFILER_HIST_BINS_PER_FRAME)
+
+/** @brief Largo de trama de diagnóstico del profiler */
+#define PROFILER_FRAME_LENGTH               8
+
+/** @brief Valor máximo de los campos de 24 bits de la trama de diagnóstico */
+#define PROFILER_U24_MAX                    0xFFFFFFUL
+
+#if USE_PROFILER_FEATURE == 1
+
+/** @brief Lectura del contador de ciclos DWT->CYCCNT */
+#define PROFILER_GET_CYCLES()               (DWT->CYCCNT)
+
+/** @brief Habilita el contador de ciclos DWT->CYCCNT */
+#define PROFILER_ENABLE_CYCLE_COUNTER()     do {                                                    \
+                                                CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     \
+                                                DWT->CYCCNT = 0;                                    \
+                                                DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                \
+                                            } while (0)
+
+/** @brief Mide los ciclos de una sentencia y los registra en la etapa indicada */
+#define PROFILER_MEASURE(stage, statement)  do {                                                    \
+                                                uint32_t profiler_t0 = PROFILER_GET_CYCLES();       \
+                                                statement;                                          \
+                                                PROFILER_Record((stage),                            \
+                                                        PROFILER_GET_CYCLES() - profiler_t0);       \
+                                            } while (0)
+
+/**
+ * @brief Inicio de medición de una ISR (declara variables locales).
+ *
+ * Registra en kPROFILER_STAGE_ISR_NESTING la profundidad de anidamiento al entrar (1: no interrumpió a otra ISR
+ * medida), con interrupciones enmascaradas porque esa etapa la actualizan todas las ISRs.
+ */
+#define PROFILER_ISR_ENTER()                uint32_t profiler_isr_t0 = PROFILER_GET_CYCLES();               \
+                                            uint32_t profiler_isr_primask = __get_PRIMASK();                \
+                                            __disable_irq();                                                \
+                                            PROFILER_Record(kPROFILER_STAGE_ISR_NESTING, ++profiler_isr_depth); \
+                                            __set_PRIMASK(profiler_isr_primask)
+
+/** @brief Fin de medición de una ISR */
+#define PROFILER_ISR_EXIT(stage)            do {                                                            \
+                                                PROFILER_Record((stage), PROFILER_GET_CYCLES() - profiler_isr_t0); \
+                                                profiler_isr_depth--;                                       \
+                                            } while (0)
+
+/**
+ * @brief Registra la latencia de entrada de la ISR de un timer básico, en ciclos desde su update event.
+ *
+ * El contador parte en 0 con el update event, por lo que al entrar vale el tiempo transcurrido en ticks de timer.
+ * Supone reloj de timer igual a SYSCLK (resolución PSC + 1 ciclos) y latencia menor a un periodo.
+ */
+#define PROFILER_ISR_TIMER_LATENCY(stage, tim)                                                              \
+                                            PROFILER_Record((stage), (tim)->CNT * ((tim)->PSC + 1U))
+
+/**
+ * @brief Deja pendiente una interrupción para medir su latencia de entrada desde este punto.
+ *
+ * Desde una ISR de menor prioridad mide la pre-emption: si el plan de prioridades no la permite, la latencia
+ * incluye el resto de la ISR que la pidió. La ISR sondeada registra la medición con PROFILER_ISR_PROBE_LATENCY.
+ */
+#define PROFILER_ISR_PROBE(irqn)            do {                                                            \
+                                                profiler_probe_t0 = PROFILER_GET_CYCLES();                  \
+                                                profiler_probe_pending = 1U;                                \
+                                                NVIC_SetPendingIRQ(irqn);                                   \
+                                            } while (0)
+
+/** @brief Registra la latencia de la sonda pendiente, si la hay (primera sentencia de la ISR sondeada) */
+#define PROFILER_ISR_PROBE_LATENCY(stage)   do {                                                            \
+                                                if (profiler_probe_pending != 0U)                           \
+                                                {                                                           \
+                                                    PROFILER_Record((stage),                                \
+                                                            PROFILER_GET_CYCLES() - profiler_probe_t0);     \
+                                                    profiler_probe_pending = 0U;                            \
+                                                }                                                           \
+                                            } while (0)
+
+#else
+
+#define PROFILER_ENABLE_CYCLE_COUNTER()     do { } while (0)
+#define PROFILER_MEASURE(stage, statement)  do { statement; } while (0)
+#define PROFILER_ISR_ENTER()                do { } while (0)
+#define PROFILER_ISR_EXIT(stage)            do { } while (0)
+#define PROFILER_ISR_TIMER_LATENCY(stage, tim)  do { } while (0)
+#define PROFILER_ISR_PROBE(irqn)            do { } while (0)
+#define PROFILER_ISR_PROBE_LATENCY(stage)   do { } while (0)
+
+#endif /* USE_PROFILER_FEATURE */
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato para etapas medidas por el profiler
+ *
+ */
+typedef enum
+{
+    kPROFILER_STAGE_CAN_APP = 0,        /**< CAN_APP_Process */
+    kPROFILER_STAGE_DECODE_DATA,        /**< DECODE_DATA_Process */
+    kPROFILER_STAGE_MONITORING,         /**< MONITORING_Process */
+    kPROFILER_STAGE_FAILURES,           /**< FAILURES_Process */
+    kPROFILER_STAGE_DRIVING_MODES,      /**< DRIVING_MODES_Process */
+    kPROFILER_STAGE_RAMPA_PEDAL,        /**< RAMPA_PEDAL_Process */
+    kPROFILER_STAGE_INDICATORS,         /**< INDICATORS_Process */
+    kPROFILER_STAGE_ISR_CAN1_RX0,       /**< CAN1_RX0_IRQHandler */
+    kPROFILER_STAGE_ISR_TIM7,           /**< TIM7_IRQHandler */
+    kPROFILER_STAGE_CAN_TX,             /**< CAN_API_Send_Message en CAN_APP_Send_BusData (backend de transmisión) */
+    kPROFILER_STAGE_CAN_RX,             /**< CAN_API_Read_Message en la ISR de recepción (backend de recepción) */
+    kPROFILER_STAGE_ISR_NESTING,        /**< Profundidad de anidamiento al entrar a una ISR (no son ciclos) */
+    kPROFILER_STAGE_LAT_CAN1_RX0,       /**< Latencia de entrada a CAN1_RX0_IRQHandler desde la sonda de TIM7 */
+    kPROFILER_STAGE_LAT_TIM7,           /**< Latencia de entrada a TIM7_IRQHandler desde el update event */
+    kPROFILER_NUM_OF_STAGES
+} profiler_stage_t;
+
+/**
+ * @brief Tipo de dato estructura para estadísticas de ciclos de una etapa
+ *
+ */
+typedef struct
+{
+    uint32_t    count;                          /**< Número de mediciones */
+    uint32_t    min;                            /**< Mínimo de ciclos */
+    uint32_t    max;                            /**< Máximo de ciclos */
+    uint64_t    sum;                            /**< Suma de ciclos (para media) */
+    uint16_t    hist[PROFILER_HIST_BINS];       /**< Histograma log2 de ciclos (saturado) */
+
+} profiler_stats_t;
+
+/***********************************************************************************************************************
+ * Global variables declarations
+ **********************************************************************************************************************/
+
+#if USE_PROFILER_FEATURE == 1
+
+/** @brief Profundidad de anidamiento de las ISRs medidas (ver PROFILER_ISR_ENTER) */
+extern volatile uint8_t profiler_isr_depth;
+
+/** @brief Instante de la sonda de latencia pendiente (ver PROFILER_ISR_PROBE) */
+extern volatile uint32_t profiler_probe_t0;
+
+/** @brief Sonda de latencia pendiente */
+extern volatile uint8_t profiler_probe_pending;
+
+#endif /* USE_PROFILER_FEATURE */
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Registra una medición de ciclos para una etapa.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param stage     Etapa medida
+ * @param cycles    Ciclos medidos
+ * @retval None
+ */
+void PROFILER_Record(profiler_stage_t stage, uint32_t cycles);
+
+/**
+ * @brief Actualiza estadísticas con una medición de ciclos.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param stats     Puntero a estadísticas a actualizar
+ * @param cycles    Ciclos medidos
+ * @retval None
+ */
+void PROFILER_Stats_Update(profiler_stats_t* stats, uint32_t cycles);
+
+/**
+ * @brief Retorna el bin del histograma log2 que corresponde a una medición de ciclos.
+ *
+ * @param cycles    Ciclos medidos
+ * @return uint8_t  Índice de bin [0:PROFILER_HIST_BINS-1]
+ */
+uint8_t PROFILER_Hist_Bin(uint32_t cycles);
+
+/**
+ * @brief Retorna las estadísticas de una etapa.
+ *
+ * @param stage     Etapa
+ * @return const profiler_stats_t*
+ */
+const profiler_stats_t* PROFILER_Get_Stats(profiler_stage_t stage);
+
+/**
+ * @brief Reinicia las estadísticas de todas las etapas.
+ *
+ * @param None
+ * @retval None
+ */
+void PROFILER_Reset(void);
+
+/**
+ * @brief Codifica un registro de estadísticas de una etapa en una trama de diagnóstico.
+ *
+ * Formato (little-endian): byte 0 etapa, byte 1 registro, bytes 2-7 datos.
+ *  - Registro 0: mínimo (u24), máximo (u24)
+ *  - Registro 1: media (u24), conteo (u24)
+ *  - Registro 2 en adelante: PROFILER_HIST_BINS_PER_FRAME bins del histograma (u16 cada uno)
+ *
+ * @param stats     Estadísticas de la etapa
+ * @param stage     Etapa
+ * @param record    Registro a codificar [0:PROFILER_RECORDS_PER_STAGE-1]
+ * @param payload   Buffer de PROFILER_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t PROFILER_Encode_Frame(const profiler_stats_t* stats, uint8_t stage, uint8_t record, uint8_t* payload);
+
+/**
+ * @brief Decodifica una trama de diagnóstico del profiler en las estadísticas de su etapa.
+ *
+ * Solo actualiza los campos presentes en el registro recibido. La suma se reconstruye como media por conteo.
+ *
+ * @param payload   Trama recibida
+ * @param length    Largo de la trama
+ * @param stats     Arreglo de kPROFILER_NUM_OF_STAGES estadísticas a actualizar
+ * @retval true     Trama válida
+ * @retval false    Trama inválida
+ */
+bool PROFILER_Decode_Frame(const uint8_t* payload, uint8_t length, profiler_stats_t* stats);
+
+/**
+ * @brief Prepara la siguiente trama de diagnóstico del profiler.
+ *
+ * Recorre en orden todos los registros de todas las etapas, una trama por llamada.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @retval None
+ */
+void PROFILER_Export_Next(can_frame_t* frame);
+
+/**
+ * @brief Nombre de una etapa (para herramientas de diagnóstico).
+ *
+ * @param stage     Etapa
+ * @return const char*
+ */
+const char* PROFILER_Stage_Name(uint8_t stage);
+
+#endif /* _PROFILER_H_ */
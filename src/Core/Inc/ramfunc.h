@@ -0,0 +1,46 @@
+/**
+ * @file ramfunc.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Marca de funciones ejecutadas desde SRAM
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Las funciones marcadas con RAMFUNC se enlazan en la sección .ramfunc (STM32F446VETX_FLASH.ld), que se guarda en
+ * flash y Reset_Handler copia a SRAM antes de SystemInit. Desde SRAM la CPU lee instrucciones sin wait states de
+ * flash (FLASH_LATENCY_2 a 80 MHz, 5 a 180 MHz), lo que el ART solo oculta en código sin saltos.
+ *
+ * Se marca solo código que corre en cada recepción CAN o en cada pasada: cada byte cuesta SRAM. El código de
+ * fabricante (HAL y driver CAN) no se modifica; sus funciones del mismo camino se ubican desde el linker script.
+ * Las llamadas entre flash y SRAM superan el alcance de BL y el linker las resuelve con veneers.
+ *
+ * Con USE_RAMFUNC_FEATURE en 0 las funciones marcadas quedan en flash, para comparar ciclos con el profiler
+ * (herramienta de host ramfunc_report). En el build de host la marca no tiene efecto.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _RAMFUNC_H_
+#define _RAMFUNC_H_
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si ejecutar desde SRAM las funciones marcadas con RAMFUNC o no */
+#ifndef USE_RAMFUNC_FEATURE
+#define USE_RAMFUNC_FEATURE                 1
+#endif
+
+#if USE_RAMFUNC_FEATURE == 1 && defined(__arm__)
+
+/** @brief Ubica la función en .ramfunc (noinline: si se inlinea en código de flash, se ejecuta desde flash) */
+#define RAMFUNC                             __attribute__((section(".ramfunc"), noinline))
+
+#else
+
+#define RAMFUNC
+
+#endif /* USE_RAMFUNC_FEATURE */
+
+#endif /* _RAMFUNC_H_ */
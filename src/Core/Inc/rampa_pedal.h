@@ -21,7 +21,7 @@
 #include <math.h>
 
 /* Application includes */
-#include "buses.h"
+#include "app_context.h"
 
 /***********************************************************************************************************************
  * Public function prototypes
@@ -33,13 +33,13 @@
  * Se encarga de transformar el valor de pedal registrado de periféricos a un valor de
  * velocidad que será empleado por inversor. Para cada modo de manejo se tiene una
  * función de transferencia diferente para determinar el valor de velocidad asociado al
- * valor de pedal registrado desde periféricos.
+ * valor de pedal registrado desde periféricos, tomada de la configuración del contexto.
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param   None
+ * @param   ctx Contexto de la aplicación
  * @retval  None
  */
-void RAMPA_PEDAL_Process(void);
+void RAMPA_PEDAL_Process(app_context_t* ctx);
 
 #endif /* _RAMPA_PEDAL_H_ */
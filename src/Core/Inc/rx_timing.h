@@ -0,0 +1,248 @@
+/**
+ * @file rx_timing.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para rx_timing.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Estadísticas de llegada por ID de las tramas que guarda CAN_APP_Store_ReceivedMessage (Periféricos, BMS, DCDC
+ * e Inversor): conteo, periodo medio, mínimo y máximo, y jitter entre periodos consecutivos. Cada trama se marca
+ * en la ISR de recepción con la base de tiempo en us (TIM2, timebase.h) y la actualización es O(1): tabla directa
+ * ID -> entrada y solo sumas y comparaciones en la ISR.
+ *
+ * No se usa la marca de tiempo de bxCAN (modo TTCM): cuenta tiempos de bit en 16 bits (da la vuelta cada 262 ms
+ * a 250 kbit/s) y el contador no se puede leer para llevarla a la base de tiempo. Con recepción adaptativa en
+ * lectura por pasada (can_hw.h) la marca es la de lectura de la FIFO, hasta un tick de SysTick después de la
+ * llegada, y ese retardo entra en el jitter.
+ *
+ * Para los módulos que agregan un contador de secuencia a sus tramas (can_def.h, CAN_SEQUENCE_BYTE) se cuentan
+ * además tramas perdidas, fuera de orden y duplicadas por ID, y la tasa de pérdida.
+ *
+ * La tabla se vuelca por CAN al recibir una petición de diagnóstico (CAN_ID_CONTROL_DIAG_PETICION):
+ * RX_TIMING_RECORDS_PER_ID tramas CAN_ID_CONTROL_DIAG_RECEPCION por ID, una por trigger de transmisión, sin ocupar
+ * más mailboxes que las demás tramas de diagnóstico. Son RX_TIMING_NUM_OF_IDS x RX_TIMING_RECORDS_PER_ID = 115
+ * tramas: unos 5,8 s con TIM7 cada 50 ms (tim.c: 80 MHz / 80 / 50000).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _RX_TIMING_H_
+#define _RX_TIMING_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* CAN driver include */
+#include "can_api.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Define si usar feature estadísticas de llegada por ID o no */
+#ifndef USE_RX_TIMING_FEATURE
+#define USE_RX_TIMING_FEATURE               1
+#endif
+
+/** @brief IDs con estadísticas (los que guarda CAN_APP_Store_ReceivedMessage) */
+#define RX_TIMING_NUM_OF_IDS                23U
+
+/** @brief Mayor ID con estadísticas (tamaño de la tabla directa ID -> entrada) */
+#define RX_TIMING_MAX_ID                    0x046U
+
+/** @brief Ganancia del estimador de jitter: 1 / 2^RX_TIMING_JITTER_SHIFT (1/16 como RFC 3550) */
+#define RX_TIMING_JITTER_SHIFT              4U
+
+/** @brief Largo de trama de volcado */
+#define RX_TIMING_FRAME_LENGTH              8U
+
+/** @brief Registros (tramas) por ID en el volcado */
+#define RX_TIMING_RECORDS_PER_ID            5U
+
+/** @brief Mayor distancia hacia atrás del contador de secuencia contada como fuera de orden (más: reinicio) */
+#define RX_TIMING_SEQ_REORDER_WINDOW        16U
+
+/** @brief Petición de diagnóstico (byte 0): volcar la tabla */
+#define RX_TIMING_CMD_DUMP                  0x01U
+
+/** @brief Petición de diagnóstico (byte 0): reiniciar las estadísticas */
+#define RX_TIMING_CMD_RESET                 0x02U
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para estadísticas de llegada de un ID (tiempos en us)
+ *
+ */
+typedef struct
+{
+    uint32_t    id;                         /**< Identificador */
+    uint32_t    count;                      /**< Tramas recibidas */
+    uint32_t    period_mean_us;             /**< Periodo medio (0 con menos de dos tramas) */
+    uint32_t    period_min_us;              /**< Periodo mínimo (0 con menos de dos tramas) */
+    uint32_t    period_max_us;              /**< Periodo máximo */
+    uint32_t    jitter_us;                  /**< Promedio móvil de la diferencia entre periodos consecutivos */
+    uint32_t    age_us;                     /**< Tiempo desde la última trama */
+    uint32_t    seq_count;                  /**< Tramas recibidas con contador de secuencia */
+    uint32_t    seq_lost;                   /**< Tramas perdidas (saltos del contador) */
+    uint32_t    seq_reordered;              /**< Tramas fuera de orden */
+    uint32_t    seq_duplicates;             /**< Tramas duplicadas */
+    uint16_t    loss_rate;                  /**< Tasa de pérdida en centésimas de % */
+
+} rx_timing_stats_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+#if USE_RX_TIMING_FEATURE == 1
+
+/**
+ * @brief Inicializa las estadísticas de llegada por ID.
+ *
+ * No es static, por lo que puede ser usada por otros archivos. Llamar antes de iniciar la recepción CAN.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Init(void);
+
+/**
+ * @brief Registra la llegada de una trama, desde la ISR de recepción.
+ *
+ * O(1): IDs sin estadísticas se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id        Identificador de la trama
+ * @param now_us    Marca de tiempo de llegada en us (base de tiempo)
+ * @retval None
+ */
+void RX_TIMING_Record(uint32_t id, uint32_t now_us);
+
+/**
+ * @brief Registra el contador de secuencia de una trama, desde la ISR de recepción.
+ *
+ * Para tramas de módulos que traen contador (largo CAN_SEQUENCE_LENGTH, contador en CAN_SEQUENCE_BYTE). Un salto
+ * hacia adelante de hasta 127 cuenta como tramas perdidas; un contador hasta RX_TIMING_SEQ_REORDER_WINDOW atrás,
+ * como trama fuera de orden (descuenta una perdida) o duplicada (el último contador); más atrás se toma como
+ * reinicio del módulo y solo se resincroniza. O(1): IDs sin estadísticas se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id        Identificador de la trama
+ * @param sequence  Contador de secuencia recibido
+ * @retval None
+ */
+void RX_TIMING_Record_Sequence(uint32_t id, uint8_t sequence);
+
+/**
+ * @brief Atiende una petición de diagnóstico (CAN_ID_CONTROL_DIAG_PETICION).
+ *
+ * RX_TIMING_CMD_DUMP inicia (o reinicia) el volcado de la tabla; RX_TIMING_CMD_RESET borra las estadísticas.
+ * Una petición sin datos (DLC 0) se ignora.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param frame     Trama de petición recibida
+ * @retval None
+ */
+void RX_TIMING_Request(const can_frame_t* frame);
+
+/**
+ * @brief Reinicia las estadísticas de llegada por ID.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Reset(void);
+
+/**
+ * @brief Retorna las estadísticas de una entrada de la tabla.
+ *
+ * @param index     Entrada [0:RX_TIMING_NUM_OF_IDS-1]
+ * @param now_us    Valor actual de la base de tiempo en us (para la edad de la última trama)
+ * @param stats     Estadísticas a completar
+ * @retval true     Entrada válida
+ * @retval false    Entrada fuera de la tabla
+ */
+bool RX_TIMING_Get_Stats(uint8_t index, uint32_t now_us, rx_timing_stats_t* stats);
+
+/**
+ * @brief Prepara la trama del volcado en curso.
+ *
+ * No avanza el volcado: avanzar con RX_TIMING_Export_Done una vez que la trama quedó en mailbox.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval true     Hay un volcado en curso y la trama quedó preparada
+ * @retval false    Sin volcado en curso
+ */
+bool RX_TIMING_Export_Next(can_frame_t* frame, uint32_t now_us);
+
+/**
+ * @brief Avanza el volcado en curso al siguiente registro; termina tras el último registro del último ID.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Export_Done(void);
+
+#endif /* USE_RX_TIMING_FEATURE */
+
+/**
+ * @brief Codifica un registro de las estadísticas de un ID en una trama de volcado.
+ *
+ * Formato (little-endian): byte 0 ID, byte 1 registro, bytes 2-7 datos.
+ *  - Registro 0: conteo (u24), periodo medio (u24)
+ *  - Registro 1: periodo mínimo (u24), periodo máximo (u24)
+ *  - Registro 2: jitter (u24), edad de la última trama (u24)
+ *  - Registro 3: tramas con contador de secuencia (u24), perdidas (u24)
+ *  - Registro 4: fuera de orden (u24), duplicadas (u24)
+ * Los campos saturan en 0xFFFFFF.
+ *
+ * @param stats     Estadísticas del ID
+ * @param record    Registro a codificar [0:RX_TIMING_RECORDS_PER_ID-1]
+ * @param payload   Buffer de RX_TIMING_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t RX_TIMING_Encode_Frame(const rx_timing_stats_t* stats, uint8_t record, uint8_t* payload);
+
+/**
+ * @brief Decodifica una trama de volcado en las estadísticas de su ID.
+ *
+ * Solo actualiza los campos presentes en el registro recibido.
+ *
+ * @param payload   Trama recibida
+ * @param length    Largo de la trama
+ * @param stats     Arreglo de RX_TIMING_NUM_OF_IDS estadísticas, en el orden de la tabla
+ * @retval true     Trama válida
+ * @retval false    Trama inválida
+ */
+bool RX_TIMING_Decode_Frame(const uint8_t* payload, uint8_t length, rx_timing_stats_t* stats);
+
+/**
+ * @brief Tasa de pérdida en centésimas de % (10000 = 100 %).
+ *
+ * @param received  Tramas distintas recibidas con contador (sin duplicadas)
+ * @param lost      Tramas perdidas
+ * @return uint16_t Pérdidas sobre recibidas más perdidas
+ */
+uint16_t RX_TIMING_Loss_Rate(uint32_t received, uint32_t lost);
+
+/**
+ * @brief Retorna el ID de una entrada de la tabla (para herramientas de diagnóstico).
+ *
+ * @param index     Entrada [0:RX_TIMING_NUM_OF_IDS-1]
+ * @return uint32_t ID, 0 si la entrada está fuera de la tabla
+ */
+uint32_t RX_TIMING_Get_Id(uint8_t index);
+
+#endif /* _RX_TIMING_H_ */
@@ -51,14 +51,14 @@ void HardFault_Handler(void);
 void MemManage_Handler(void);
 void BusFault_Handler(void);
 void UsageFault_Handler(void);
-void SVC_Handler(void);
 void DebugMon_Handler(void);
-void PendSV_Handler(void);
 void SysTick_Handler(void);
 void CAN1_RX0_IRQHandler(void);
 void TIM7_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+/* Sin FreeRTOS vacíos en stm32f4xx_it.c; con FreeRTOS, los del port */
+void SVC_Handler(void);
+void PendSV_Handler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
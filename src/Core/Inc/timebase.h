@@ -0,0 +1,70 @@
+/**
+ * @file timebase.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para timebase.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Base de tiempo libre de 32 bits en us. En la tarjeta es el contador de TIM2 (32 bits, APB1) con prescaler a 1 MHz:
+ * no depende de SysTick ni de su prioridad y se lee con un solo acceso, también desde ISRs. Desborda cada ~71,6
+ * minutos, por lo que los intervalos se calculan siempre como diferencia sin signo con las macros TIMEBASE_*,
+ * válidas mientras el intervalo sea menor a 2^31 us.
+ *
+ * En el build de host TIMEBASE_Init y TIMEBASE_Get_Us los implementa la HAL de simulación (reloj virtual,
+ * clock_gettime o tiempo del hilo), igual que HAL_GetTick.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _TIMEBASE_H_
+#define _TIMEBASE_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de la base de tiempo en Hz */
+#define TIMEBASE_HZ                         1000000UL
+
+/** @brief Tiempo transcurrido en us desde since hasta now (correcto a través del desborde) */
+#define TIMEBASE_ELAPSED_US(since, now)     ((uint32_t)((uint32_t)(now) - (uint32_t)(since)))
+
+/** @brief Indica si pasaron al menos timeout_us desde since */
+#define TIMEBASE_IS_EXPIRED(since, now, timeout_us)                                                 \
+                                            (TIMEBASE_ELAPSED_US((since), (now)) >= (uint32_t)(timeout_us))
+
+/** @brief Indica si el instante a es anterior al instante b */
+#define TIMEBASE_IS_BEFORE(a, b)            ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Configura e inicia la base de tiempo (parte en 0).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void TIMEBASE_Init(void);
+
+/**
+ * @brief Retorna el valor actual de la base de tiempo en us.
+ *
+ * Puede llamarse desde ISRs.
+ *
+ * @return uint32_t
+ */
+uint32_t TIMEBASE_Get_Us(void);
+
+#endif /* _TIMEBASE_H_ */
@@ -0,0 +1,100 @@
+/**
+ * @file tx_policy.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para tx_policy.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Política de transmisión por cambio de una señal de un byte: la señal se envía en cuanto su valor se aleja del
+ * último enviado en más de una banda muerta, pero nunca antes de un intervalo mínimo desde el envío anterior, y
+ * se reenvía aunque no cambie al cumplirse un intervalo máximo. TX_POLICY_Start fija el valor de partida y cuándo
+ * sale el primer reenvío, para que señales que parten juntas no cumplan su intervalo máximo en el mismo instante.
+ *
+ * El módulo solo decide; el envío y el estado por señal quedan en quien lo usa (ver CAN_APP_Send_Changes).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _TX_POLICY_H_
+#define _TX_POLICY_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para política de transmisión de una señal
+ *
+ */
+typedef struct
+{
+    uint8_t     deadband;                   /**< Cambio respecto del último valor enviado que no dispara envío */
+    uint32_t    min_interval_us;            /**< Separación mínima entre envíos por cambio (0: sin mínimo) */
+    uint32_t    max_interval_us;            /**< Reenvío sin cambios tras este tiempo (0: sin reenvío) */
+
+} tx_policy_config_t;
+
+/**
+ * @brief Tipo de dato estructura para estado de transmisión de una señal
+ *
+ */
+typedef struct
+{
+    uint8_t     value;                      /**< Último valor enviado */
+    uint32_t    last_us;                    /**< Instante del último envío (base de tiempo en us) */
+
+} tx_policy_state_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicia el estado de transmisión de una señal.
+ *
+ * El valor actual queda como enviado: la señal sale con su próximo cambio o, sin cambios, first_us después (se
+ * satura en el intervalo máximo; sin intervalo máximo solo sale por cambio).
+ *
+ * @param config    Política de la señal
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor actual de la señal
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @param first_us  Tiempo hasta el primer reenvío en us
+ * @retval None
+ */
+void TX_POLICY_Start(const tx_policy_config_t* config, tx_policy_state_t* state, uint8_t value, uint32_t now_us,
+                     uint32_t first_us);
+
+/**
+ * @brief Retorna si una señal debe enviarse ahora según su política.
+ *
+ * @param config    Política de la señal
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor actual de la señal
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval true     Enviar (cambio fuera de la banda muerta con el intervalo mínimo cumplido o intervalo máximo
+ *                  cumplido)
+ * @retval false    No enviar
+ */
+bool TX_POLICY_Is_Due(const tx_policy_config_t* config, const tx_policy_state_t* state, uint8_t value,
+                      uint32_t now_us);
+
+/**
+ * @brief Registra el envío de una señal (solo si la trama quedó en mailbox).
+ *
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor enviado
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval None
+ */
+void TX_POLICY_Sent(tx_policy_state_t* state, uint8_t value, uint32_t now_us);
+
+#endif /* _TX_POLICY_H_ */
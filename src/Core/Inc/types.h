@@ -20,6 +20,16 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Enum almacenado en el menor tipo entero que contiene sus valores (uint8_t para los enums de este archivo) */
+#define PACKED_ENUM                     __attribute__((packed))
+
+/** @brief Número de bits de los campos de estado de variable (var_state_t) en estructuras st_*_vars_t */
+#define VAR_STATE_BITS                  2
+
 /***********************************************************************************************************************
  * Types declarations
  **********************************************************************************************************************/
@@ -28,7 +38,7 @@
  * @brief Tipo de dato para variable info de cada módulo
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
     kMODULE_INFO_OK,                /**< Modulo OK */
 	kMODULE_INFO_ERROR              /**< Modulo ERROR */
@@ -44,7 +54,7 @@ typedef float rx_var_t;
  * @brief Tipo de dato para estado de variable analogica
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
     kVAR_STATE_DATA_PROBLEM = 0,    /**< Problema con el dato */
     kVAR_STATE_OK,                  /**< Estado de variable OK */
@@ -56,7 +66,7 @@ typedef enum
  * @brief Tipo de dato para estado de módulo
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
     kMODULE_STATUS_DATA_PROBLEM = 0,
     kMODULE_STATUS_OK,
@@ -72,7 +82,7 @@ typedef enum
  * @brief Tipo de dato para modos de manejo
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
     kDRIVING_MODE_ECO,      /**< Modo de manejo ECO */
 	kDRIVING_MODE_NORMAL,   /**< Modo de manejo NORMAL */
@@ -83,7 +93,7 @@ typedef enum
  * @brief Tipo de dato para fallas
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {       
 	kFAILURE_OK,            /**< Falla OK */
 	kFAILURE_CAUTION1,      /**< Falla CAUTION1 */
@@ -99,7 +109,7 @@ typedef enum
  * @brief Tipo de dato para botones de modo de manejo
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
 	kBTN_NONE = 0,
 	kBTN_ECO,
@@ -111,7 +121,7 @@ typedef enum
  * @brief Tipo de dato para estado de hombre muerto
  *
  */
-typedef enum
+typedef enum PACKED_ENUM
 {
 	kHOMBRE_MUERTO_OFF = 0,
 	kHOMBRE_MUERTO_ON
@@ -158,12 +168,12 @@ typedef struct
  */
 typedef struct
 {
-    var_state_t     voltaje;
-    var_state_t     corriente;
-    var_state_t     voltaje_min_celda;
-    var_state_t     potencia;
-    var_state_t     t_max;
-    var_state_t     nivel_bateria;
+    var_state_t     voltaje : VAR_STATE_BITS;
+    var_state_t     corriente : VAR_STATE_BITS;
+    var_state_t     voltaje_min_celda : VAR_STATE_BITS;
+    var_state_t     potencia : VAR_STATE_BITS;
+    var_state_t     t_max : VAR_STATE_BITS;
+    var_state_t     nivel_bateria : VAR_STATE_BITS;
 
 } st_bms_vars_t;
 
@@ -192,10 +202,10 @@ typedef struct
  */
 typedef struct
 {
-    var_state_t     voltaje_bateria;
-    var_state_t     voltaje_salida;
-    var_state_t     t_max;
-    var_state_t     potencia;
+    var_state_t     voltaje_bateria : VAR_STATE_BITS;
+    var_state_t     voltaje_salida : VAR_STATE_BITS;
+    var_state_t     t_max : VAR_STATE_BITS;
+    var_state_t     potencia : VAR_STATE_BITS;
 
 } st_dcdc_vars_t;
 
@@ -226,13 +236,26 @@ typedef struct
  */
 typedef struct
 {
-    var_state_t     velocidad;
-    var_state_t     V;
-    var_state_t     I;
-    var_state_t     temp_max;
-    var_state_t     temp_motor;
-    var_state_t     potencia;
+    var_state_t     velocidad : VAR_STATE_BITS;
+    var_state_t     V : VAR_STATE_BITS;
+    var_state_t     I : VAR_STATE_BITS;
+    var_state_t     temp_max : VAR_STATE_BITS;
+    var_state_t     temp_motor : VAR_STATE_BITS;
+    var_state_t     potencia : VAR_STATE_BITS;
 
 } st_inversor_vars_t;
 
+/***********************************************************************************************************************
+ * Compile-time checks
+ **********************************************************************************************************************/
+
+_Static_assert(sizeof(module_info_t) == 1, "module_info_t debe ocupar 1 byte");
+_Static_assert(sizeof(var_state_t) == 1, "var_state_t debe ocupar 1 byte");
+_Static_assert(sizeof(module_status_t) == 1, "module_status_t debe ocupar 1 byte");
+_Static_assert(sizeof(driving_mode_t) == 1, "driving_mode_t debe ocupar 1 byte");
+_Static_assert(sizeof(failure_t) == 1, "failure_t debe ocupar 1 byte");
+_Static_assert(sizeof(btn_modo_manejo_t) == 1, "btn_modo_manejo_t debe ocupar 1 byte");
+_Static_assert(sizeof(hm_state_t) == 1, "hm_state_t debe ocupar 1 byte");
+_Static_assert(kVAR_STATE_PROBLEM < (1 << VAR_STATE_BITS), "var_state_t no cabe en VAR_STATE_BITS bits");
+
 #endif /* _TYPES_H_ */
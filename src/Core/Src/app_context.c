@@ -0,0 +1,102 @@
+/**
+ * @file app_context.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Contexto de la aplicación de Control: inicialización y configuración por defecto
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "app_context.h"
+
+/* C includes */
+#include <string.h>
+
+/* Application includes */
+#include "failures.h"
+#include "driving_modes.h"
+
+/* CAN application include */
+#include "can_app.h"
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+/* Configuración por defecto: ventanas de failures.h, rampas de pedal del vehículo y políticas de can_app.h */
+const app_config_t app_config_default =
+{
+    .failures =
+    {
+        .escalate = {FAILURES_ESCALATE_MIN_COUNT, FAILURES_ESCALATE_MIN_TIME_MS},
+        .recover  = {FAILURES_RECOVER_MIN_COUNT, FAILURES_RECOVER_MIN_TIME_MS},
+        .autokill = {FAILURES_AUTOKILL_MIN_COUNT, FAILURES_AUTOKILL_MIN_TIME_MS},
+        .critical = {FAILURES_CRITICAL_MIN_COUNT, FAILURES_CRITICAL_MIN_TIME_MS},
+    },
+
+    /* Tramos de pedal [0:20), [20:40), [40:60), [60:80), [80:100) */
+    .pedal_eco =
+    {
+        {{0.25f, 0.0f}, {0.5f, -5.0f}, {0.75f, -15.0f}, {1.5f, -60.0f}, {2.0f, -100.0f}}
+    },
+    .pedal_normal =
+    {
+        {{0.5f, 0.0f}, {1.0f, -10.0f}, {2.0f, -50.0f}, {1.0f, 10.0f}, {0.5f, 50.0f}}
+    },
+    .pedal_sport =
+    {
+        {{1.5f, 0.0f}, {1.25f, 5.0f}, {1.0f, 15.0f}, {0.75f, 30.0f}, {0.5f, 50.0f}}
+    },
+
+    /* Banda muerta, intervalo mínimo e intervalo máximo por señal; hombre muerto y falla nunca esperan un cambio */
+    .can_tx_policy =
+    {
+        [kCAN_TX_ESTADO_MANEJO]   = {0, CAN_APP_ESTADO_MIN_INTERVAL_US, CAN_APP_ESTADO_MAX_INTERVAL_US},
+        [kCAN_TX_ESTADO_FALLA]    = {0, 0, CAN_APP_ESTADO_MAX_INTERVAL_US},
+        [kCAN_TX_NIVEL_VELOCIDAD] = {0, CAN_APP_VELOCIDAD_MIN_GAP_US, CAN_APP_VELOCIDAD_KEEPALIVE_US},
+        [kCAN_TX_HOMBRE_MUERTO]   = {0, 0, CAN_APP_ESTADO_MAX_INTERVAL_US},
+    },
+};
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa un contexto con los valores iniciales de buses y máquinas de estado.
+ *
+ * No inicializa el objeto CAN (ver CAN_HW_Init).
+ *
+ * @param ctx       Contexto
+ * @param config    Configuración de la instancia (debe seguir válida mientras se use el contexto)
+ * @retval None
+ */
+void APP_CONTEXT_Init(app_context_t* ctx, const app_config_t* config)
+{
+    memset(ctx, 0, sizeof(*ctx));
+
+    ctx->config = config;
+
+    /* Buses */
+    ctx->bus_data = bus_data_init;
+    ctx->bus_can_output = bus_can_output_init;
+    ctx->bus_can_input = bus_can_input_init;
+    ctx->bus_can_input_shared.data = bus_can_input_init;
+
+    /* Banderas */
+    ctx->flag_rx_can = CAN_MSG_NOT_RECEIVED;
+    ctx->flag_rx_pedal = CAN_MSG_NOT_RECEIVED;
+    ctx->flag_tx_can = CAN_TX_READY;
+    ctx->flag_decodificar = NO_DECODIFICA;
+    ctx->hombre_muerto_isr = kHOMBRE_MUERTO_OFF;
+
+    /* Máquinas de estado (app_state queda en kWAITING_ECHO_RESPONSE) */
+    FAILURES_Init(ctx);
+    DRIVING_MODES_Init(ctx);
+}
@@ -15,6 +15,7 @@
 
 #include "app_control.h"
 
+#include "app_context.h"
 #include "buses.h"
 #include "decode_data.h"
 #include "driving_modes.h"
@@ -23,16 +24,17 @@
 #include "monitoring.h"
 #include "indicators.h"
 #include "can_app.h"
+#include "profiler.h"
+#include "cpu_load.h"
+#include "bus_load.h"
+#include "latency.h"
+#include "rx_timing.h"
+#include "timebase.h"
+#include "idle.h"
+#include "app_rtos.h"
 
 #include "main.h"
 
-/***********************************************************************************************************************
- * Private macros
- **********************************************************************************************************************/
-
-/** @brief Duración de la espera hasta timeout en ms */
-#define TIMEOUT_VALUE_MS       	5000U
-
 /***********************************************************************************************************************
  * Private variables definitions
  **********************************************************************************************************************/
@@ -44,17 +46,8 @@ enum App_States
     kRUNNING,       					/**< Estado RUNNING */
 };
 
-/** @brief Estado de la máquina de estados */
-static uint8_t app_state = kWAITING_ECHO_RESPONSE;
-
-/** Para conteo de timeout en estado kWAITING_ECHO_RESPONSE */
-static uint32_t tickstart;
-
-/***********************************************************************************************************************
- * Private functions prototypes
- **********************************************************************************************************************/
-
-static void MX_APP_Send_Echo(typedef_bus2_t* bus_can_output);
+/** @brief Contexto de la aplicación: única instancia en el target */
+static app_context_t app_ctx;
 
 /***********************************************************************************************************************
  * Public functions implementation
@@ -62,6 +55,9 @@ static void MX_APP_Send_Echo(typedef_bus2_t* bus_can_output);
 
 void MX_APP_Init(void)
 {
+    /* Estado inicial de buses y máquinas de estado */
+    APP_CONTEXT_Init(&app_ctx, &app_config_default);
+
     /* Initialize board LEDs */
     BSP_LED_Init(LED1);
     BSP_LED_Init(LED2);
@@ -70,8 +66,45 @@ void MX_APP_Init(void)
     /* Initialize board buzzer */
     BSP_BUZZER_Init();
 
+    /* Base de tiempo en us, antes de CAN: la ISR de recepción marca tiempos de llegada */
+    TIMEBASE_Init();
+
+#if USE_WFI_IDLE_FEATURE == 1
+    /* Idle con WFI: las ISRs marcan trabajo pendiente desde que se inicia CAN */
+    IDLE_Init();
+#endif /* USE_WFI_IDLE_FEATURE */
+
+#if USE_FREERTOS_FEATURE == 1
+    /* Colas y tareas, antes de CAN: la ISR de recepción entrega las tramas a la tarea de recepción */
+    APP_RTOS_Init(&app_ctx);
+#endif /* USE_FREERTOS_FEATURE */
+
+#if USE_RX_TIMING_FEATURE == 1
+    /* Estadísticas de llegada por ID, antes de CAN: la ISR de recepción las actualiza */
+    RX_TIMING_Init();
+#endif /* USE_RX_TIMING_FEATURE */
+
     /* Initialize hardware */
-    CAN_HW_Init();
+    CAN_HW_Init(&app_ctx);
+
+#if USE_BUS_LOAD_FEATURE == 1
+    /* Inicializa medidor de carga del bus CAN (bitrate de MX_CAN1_Init) */
+    BUS_LOAD_Init(CAN_HW_Get_Bitrate(), TIMEBASE_Get_Us());
+#endif /* USE_BUS_LOAD_FEATURE */
+
+    /* Habilita contador de ciclos para profiler (no hace nada si el profiler está deshabilitado) */
+    PROFILER_ENABLE_CYCLE_COUNTER();
+
+#if USE_CPU_LOAD_FEATURE == 1
+    /* Inicializa monitor de carga de CPU (ventana de un segundo) */
+    CPU_LOAD_ENABLE_CYCLE_COUNTER();
+    CPU_LOAD_Init(SystemCoreClock, CPU_LOAD_DEADLINE_US);
+#endif /* USE_CPU_LOAD_FEATURE */
+
+#if USE_LATENCY_FEATURE == 1
+    /* Inicializa medición de latencia pedal-inversor */
+    LATENCY_Init();
+#endif /* USE_LATENCY_FEATURE */
 
     /* Indicate that initialization was completed */
     for(int i=0; i<3; i++)
@@ -92,54 +125,53 @@ void MX_APP_Init(void)
 
 void MX_APP_Process(void)
 {
-	switch (app_state)
+	app_context_t* ctx = &app_ctx;
+
+	switch (ctx->app_state)
 	{
 
 	/* Estado esperando respuesta ECHO a tarjetas: BMS, DCDC, Inversor, Perifericos */
 	case kWAITING_ECHO_RESPONSE:
 
-		HAL_Delay(2000);
+		HAL_Delay(MX_APP_ECHO_DELAY_MS);
 
 		/* Envía echo a demás tarjetas */
-		MX_APP_Send_Echo(&bus_can_output);
+		MX_APP_Send_Echo(ctx);
 
-		/* Get ticks for timeout counting */
-		tickstart = HAL_GetTick();
+		/* Get time for timeout counting */
+		ctx->app_timestart_us = TIMEBASE_Get_Us();
 
 		while(1)
 		{
 		    /* Recibió mensaje CAN */
-		    if (flag_rx_can == CAN_MSG_RECEIVED)
+		    if (ctx->flag_rx_can == CAN_MSG_RECEIVED)
 		    {
-		        CAN_APP_Store_ReceivedMessage();
+		        ctx->flag_rx_can = CAN_MSG_NOT_RECEIVED;
 
-		        flag_rx_can = CAN_MSG_NOT_RECEIVED;
+		        BUSES_Input_Snapshot(&ctx->bus_can_input_shared, &ctx->bus_can_input);
 		    }
 
 			/* LEDs para indicar confirmación de cada módulo */
-			INDICATORS_Update_ModulesLEDs();
+			INDICATORS_Update_ModulesLEDs(ctx);
 
 			/* Si todos los módulos respondieron OK, Control está listo */
-			if (bus_can_input.bms_ok == CAN_VALUE_MODULE_OK &&
-                bus_can_input.dcdc_ok == CAN_VALUE_MODULE_OK &&
-                bus_can_input.inversor_ok == CAN_VALUE_MODULE_OK &&
-                bus_can_input.perifericos_ok == CAN_VALUE_MODULE_OK)
+			if (MX_APP_Modules_Ok(ctx))
 			{
-				HAL_Delay(500);
+				HAL_Delay(MX_APP_READY_DELAY_MS);
 
 				/* Indicate that start up has finished */
 				INDICATORS_Finish_StartUp();
 
-				app_state = kRUNNING;
+				MX_APP_Enter_Running(ctx);
 
 				break;
 			}
-			else if((HAL_GetTick() - tickstart) > TIMEOUT_VALUE_MS)
+			else if(TIMEBASE_IS_EXPIRED(ctx->app_timestart_us, TIMEBASE_Get_Us(), MX_APP_ECHO_TIMEOUT_US))
 			{
 				/* Envía echo a demás tarjetas, de nuevo */
-				MX_APP_Send_Echo(&bus_can_output);
+				MX_APP_Send_Echo(ctx);
 
-				tickstart = HAL_GetTick();
+				ctx->app_timestart_us = TIMEBASE_Get_Us();
 			}
 		}
 
@@ -148,37 +180,99 @@ void MX_APP_Process(void)
 	/* Estado tarjeta de Control running */
 	case kRUNNING:
 
-		CAN_APP_Process();
+#if USE_WFI_IDLE_FEATURE == 1
+		/* Duerme hasta que una ISR deje trabajo pendiente (CAN, TIM7 o tick) */
+		(void)IDLE_Wait();
+#endif /* USE_WFI_IDLE_FEATURE */
+
+		MX_APP_Run_Pass(ctx);
+
+		break;
+	}
+}
+
+void MX_APP_Run_Pass(app_context_t* ctx)
+{
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+	/* Con tráfico alto la FIFO de recepción se lee aquí en vez de una interrupción por trama */
+	CAN_HW_Poll_Rx();
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
 
-		DECODE_DATA_Process();
+#if USE_BUS_LOAD_FEATURE == 1
+	/* Cierra las ventanas de carga del bus vencidas */
+	BUS_LOAD_Process(TIMEBASE_Get_Us());
+#endif /* USE_BUS_LOAD_FEATURE */
 
-		MONITORING_Process();
+#if USE_CPU_LOAD_FEATURE == 1
+	/* Inicio de pasada: con trabajo si hay evento CAN pendiente */
+	CPU_LOAD_Pass_Begin(CPU_LOAD_GET_CYCLES(),
+	                    (ctx->flag_rx_can == CAN_MSG_RECEIVED) || (ctx->flag_tx_can == CAN_TX_READY));
+#endif /* USE_CPU_LOAD_FEATURE */
 
-		FAILURES_Process();
+	PROFILER_MEASURE(kPROFILER_STAGE_CAN_APP, CAN_APP_Process(ctx));
 
-		DRIVING_MODES_Process();
+	PROFILER_MEASURE(kPROFILER_STAGE_DECODE_DATA, DECODE_DATA_Process(ctx));
 
-		RAMPA_PEDAL_Process();
+	PROFILER_MEASURE(kPROFILER_STAGE_MONITORING, MONITORING_Process(ctx));
 
-	    INDICATORS_Process();
+	PROFILER_MEASURE(kPROFILER_STAGE_FAILURES, FAILURES_Process(ctx));
 
-		break;
-	}
+	PROFILER_MEASURE(kPROFILER_STAGE_DRIVING_MODES, DRIVING_MODES_Process(ctx));
+
+	PROFILER_MEASURE(kPROFILER_STAGE_RAMPA_PEDAL, RAMPA_PEDAL_Process(ctx));
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+	/* Señales del bus de salida CAN que cambiaron en esta pasada (y reenvíos vencidos) */
+	CAN_APP_Send_Changes(ctx);
+#elif USE_PEDAL_EVENT_TX_FEATURE == 1
+	/* Nivel de velocidad de la muestra de pedal de esta pasada, sin esperar el trigger de TIM7 */
+	CAN_APP_Send_Velocidad(ctx);
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+	PROFILER_MEASURE(kPROFILER_STAGE_INDICATORS, INDICATORS_Process(ctx));
+
+#if USE_CPU_LOAD_FEATURE == 1
+	CPU_LOAD_Pass_End(CPU_LOAD_GET_CYCLES());
+#endif /* USE_CPU_LOAD_FEATURE */
 }
 
-/***********************************************************************************************************************
- * Private functions implementation
- **********************************************************************************************************************/
+app_context_t* MX_APP_Get_Context(void)
+{
+	return &app_ctx;
+}
 
-static void MX_APP_Send_Echo(typedef_bus2_t* bus_can_output)
+void MX_APP_Send_Echo(app_context_t* ctx)
 {
-	bus_can_output->control_ok = CAN_VALUE_MODULE_OK;
+	ctx->bus_can_output.control_ok = CAN_VALUE_MODULE_OK;
 
 	/* Set up can_obj for message transmission */
-	can_obj.Frame.id = CAN_ID_CONTROL_OK;
-	can_obj.Frame.payload_length = 1;
-	can_obj.Frame.payload_buff[0] = bus_can_output->control_ok;
+	ctx->can_obj.Frame.id = CAN_ID_CONTROL_OK;
+	ctx->can_obj.Frame.payload_length = 1;
+	ctx->can_obj.Frame.payload_buff[0] = ctx->bus_can_output.control_ok;
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+	CAN_APP_Stamp_Sequence(ctx, &ctx->can_obj.Frame);
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
+	/* Send message (mismo resguardo de mailbox que el resto de los envíos de la pasada principal) */
+	CAN_APP_Send_Message(&ctx->can_obj);
+}
+
+bool MX_APP_Modules_Ok(const app_context_t* ctx)
+{
+	return ctx->bus_can_input.bms_ok == CAN_VALUE_MODULE_OK &&
+	       ctx->bus_can_input.dcdc_ok == CAN_VALUE_MODULE_OK &&
+	       ctx->bus_can_input.inversor_ok == CAN_VALUE_MODULE_OK &&
+	       ctx->bus_can_input.perifericos_ok == CAN_VALUE_MODULE_OK;
+}
+
+void MX_APP_Enter_Running(app_context_t* ctx)
+{
+	ctx->app_state = kRUNNING;
 
-	/* Send message */
-	CAN_API_Send_Message(&can_obj);
+#if USE_PEDAL_EVENT_TX_FEATURE == 1
+	/* Primer nivel de velocidad con la próxima muestra de pedal: las de la espera ya son antiguas */
+	ctx->flag_rx_pedal = CAN_MSG_NOT_RECEIVED;
+	ctx->velocidad_tx_last_us = TIMEBASE_Get_Us();
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
 }
@@ -0,0 +1,597 @@
+/**
+ * @file app_rtos.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Tareas de FreeRTOS de la aplicación de Control
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "app_rtos.h"
+
+#if USE_FREERTOS_FEATURE == 1
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "buses.h"
+#include "can_app.h"
+#include "decode_data.h"
+#include "driving_modes.h"
+#include "failures.h"
+#include "indicators.h"
+#include "monitoring.h"
+#include "rampa_pedal.h"
+#include "profiler.h"
+#include "cpu_load.h"
+#include "bus_load.h"
+#include "timebase.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Resultado de la máquina de fallas (FAILURES -> CONTROL)
+ *
+ */
+typedef struct
+{
+    failure_t   failure;            /**< Falla (bus de datos) */
+    uint8_t     estado_falla;       /**< Falla (bus de salida CAN) */
+    uint8_t     autokill;           /**< Autokill (bus de salida CAN) */
+} app_rtos_failure_t;
+
+/**
+ * @brief Estado que muestran los indicadores (CONTROL -> INDICATORS)
+ *
+ */
+typedef struct
+{
+    bool            running;        /**< Control en kRUNNING (false: esperando echo de los módulos) */
+    driving_mode_t  driving_mode;   /**< Modo de manejo */
+    failure_t       failure;        /**< Falla */
+    uint8_t         bms_ok;         /**< Estado recibido de BMS */
+    uint8_t         dcdc_ok;        /**< Estado recibido de DCDC */
+    uint8_t         perifericos_ok; /**< Estado recibido de Periféricos */
+} app_rtos_indicators_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Tramas recibidas (ISR de recepción -> CAN_RX) */
+static QueueHandle_t can_rx_queue;
+
+/** @brief Eventos de la tarea de control (app_rtos_event_t) */
+static QueueHandle_t event_queue;
+
+/** @brief Bus de datos decodificado (CONTROL -> MONITORING), largo 1 */
+static QueueHandle_t data_queue;
+
+/** @brief Bus de datos monitoreado (MONITORING -> FAILURES), largo 1 */
+static QueueHandle_t monitored_queue;
+
+/** @brief Resultado de fallas (FAILURES -> CONTROL), largo 1 */
+static QueueHandle_t failure_queue;
+
+/** @brief Estado de indicadores (CONTROL -> INDICATORS), largo 1 */
+static QueueHandle_t indicators_queue;
+
+/** @brief Contextos propios de las tareas que no comparten el de la aplicación */
+static app_context_t monitoring_ctx;
+static app_context_t failures_ctx;
+static app_context_t indicators_ctx;
+
+/** @brief Tramas descartadas con la cola de recepción llena */
+static volatile uint32_t rx_overruns = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void APP_RTOS_Can_Rx_Task(void* argument);
+static void APP_RTOS_Control_Task(void* argument);
+static void APP_RTOS_Failures_Task(void* argument);
+static void APP_RTOS_Monitoring_Task(void* argument);
+static void APP_RTOS_Indicators_Task(void* argument);
+
+static void APP_RTOS_Control_StartUp(app_context_t* ctx);
+static void APP_RTOS_Control_Pass(app_context_t* ctx);
+static void APP_RTOS_Send_Event(app_rtos_event_t event);
+static void APP_RTOS_Send_Indicators(const app_context_t* ctx, bool running);
+static void APP_RTOS_Create_Task(TaskFunction_t task, const char* name, configSTACK_DEPTH_TYPE stack,
+                                 void* argument, UBaseType_t priority);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Crea las colas y las tareas de la aplicación.
+ *
+ * Se llama desde MX_APP_Init antes de CAN_HW_Init: la ISR de recepción ya usa la cola de tramas. Hasta
+ * APP_RTOS_Start, FreeRTOS deja enmascaradas las interrupciones que usan su API.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (el de CAN_RX y CONTROL)
+ * @retval None
+ */
+void APP_RTOS_Init(app_context_t* ctx)
+{
+    can_rx_queue = xQueueCreate(APP_RTOS_CAN_RX_QUEUE_LENGTH, sizeof(can_frame_t));
+    event_queue = xQueueCreate(APP_RTOS_EVENT_QUEUE_LENGTH, sizeof(uint8_t));
+    data_queue = xQueueCreate(1, sizeof(typedef_bus1_t));
+    monitored_queue = xQueueCreate(1, sizeof(typedef_bus1_t));
+    failure_queue = xQueueCreate(1, sizeof(app_rtos_failure_t));
+    indicators_queue = xQueueCreate(1, sizeof(app_rtos_indicators_t));
+
+    if (can_rx_queue == NULL || event_queue == NULL || data_queue == NULL || monitored_queue == NULL ||
+        failure_queue == NULL || indicators_queue == NULL)
+    {
+        Error_Handler();
+    }
+
+    /* Cada etapa fuera del camino de pedal guarda su estado en su propio contexto */
+    APP_CONTEXT_Init(&monitoring_ctx, ctx->config);
+    APP_CONTEXT_Init(&failures_ctx, ctx->config);
+    APP_CONTEXT_Init(&indicators_ctx, ctx->config);
+
+    APP_RTOS_Create_Task(APP_RTOS_Can_Rx_Task, "CAN_RX", APP_RTOS_STACK_CAN_RX, ctx, APP_RTOS_PRIORITY_CAN_RX);
+    APP_RTOS_Create_Task(APP_RTOS_Control_Task, "CONTROL", APP_RTOS_STACK_CONTROL, ctx, APP_RTOS_PRIORITY_CONTROL);
+    APP_RTOS_Create_Task(APP_RTOS_Failures_Task, "FAILURES", APP_RTOS_STACK_FAILURES, &failures_ctx,
+                         APP_RTOS_PRIORITY_FAILURES);
+    APP_RTOS_Create_Task(APP_RTOS_Monitoring_Task, "MONITORING", APP_RTOS_STACK_MONITORING, &monitoring_ctx,
+                         APP_RTOS_PRIORITY_MONITORING);
+    APP_RTOS_Create_Task(APP_RTOS_Indicators_Task, "INDICATORS", APP_RTOS_STACK_INDICATORS, &indicators_ctx,
+                         APP_RTOS_PRIORITY_INDICATORS);
+}
+
+/**
+ * @brief Inicia el scheduler. No retorna.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void APP_RTOS_Start(void)
+{
+    vTaskStartScheduler();
+
+    /* Solo retorna si no hubo memoria para la tarea idle */
+    Error_Handler();
+}
+
+/**
+ * @brief Entrega una trama recibida a la tarea de recepción. Se llama desde la ISR de recepción CAN.
+ *
+ * Si la cola está llena la trama se descarta y se cuenta (APP_RTOS_Get_Rx_Overruns).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param frame Trama recibida
+ * @retval None
+ */
+void APP_RTOS_Can_Rx_FromISR(const can_frame_t* frame)
+{
+    BaseType_t woken = pdFALSE;
+
+    if (xQueueSendFromISR(can_rx_queue, frame, &woken) != pdPASS)
+    {
+        rx_overruns++;
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Avisa a la tarea de control el trigger de transmisión. Se llama desde la ISR de TIM7.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void APP_RTOS_Can_Tx_Trigger_FromISR(void)
+{
+    BaseType_t woken = pdFALSE;
+    uint8_t event = kAPP_RTOS_EVENT_CAN_TX;
+
+    /* Con la cola llena, la tarea de control ya tiene eventos pendientes y hará la pasada */
+    (void)xQueueSendFromISR(event_queue, &event, &woken);
+
+    portYIELD_FROM_ISR(woken);
+}
+
+/**
+ * @brief Retorna el número de tramas descartadas con la cola de recepción llena.
+ *
+ * @return uint32_t
+ */
+uint32_t APP_RTOS_Get_Rx_Overruns(void)
+{
+    return rx_overruns;
+}
+
+/***********************************************************************************************************************
+ * FreeRTOS hooks implementation
+ **********************************************************************************************************************/
+
+/*
+ * Desborde de stack detectado por el kernel (configCHECK_FOR_STACK_OVERFLOW)
+ */
+void vApplicationStackOverflowHook(TaskHandle_t task, char* name)
+{
+    Error_Handler();
+}
+
+/*
+ * pvPortMalloc sin memoria (configUSE_MALLOC_FAILED_HOOK)
+ */
+void vApplicationMallocFailedHook(void)
+{
+    Error_Handler();
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tarea de recepción CAN.
+ *
+ * Guarda en el bus de recepción compartido todas las tramas encoladas (incluye el camino rápido de hombre
+ * muerto) y avisa una vez a la tarea de control.
+ *
+ * @param argument Contexto de la aplicación
+ * @retval None
+ */
+static void APP_RTOS_Can_Rx_Task(void* argument)
+{
+    app_context_t* ctx = argument;
+    can_frame_t frame;
+
+    for (;;)
+    {
+        (void)xQueueReceive(can_rx_queue, &frame, portMAX_DELAY);
+
+        do
+        {
+            CAN_APP_Store_ReceivedMessage(ctx, &frame);
+        }
+        while (xQueueReceive(can_rx_queue, &frame, 0) == pdPASS);
+
+        APP_RTOS_Send_Event(kAPP_RTOS_EVENT_CAN_RX);
+    }
+}
+
+/**
+ * @brief Tarea de control: camino de seguridad y de pedal.
+ *
+ * Espera el echo de los módulos y luego hace una pasada por cada evento (o cada APP_RTOS_CONTROL_PERIOD_MS sin
+ * eventos). Los eventos acumulados durante una pasada se atienden juntos en la siguiente, como las banderas de
+ * la superloop.
+ *
+ * @param argument Contexto de la aplicación
+ * @retval None
+ */
+static void APP_RTOS_Control_Task(void* argument)
+{
+    app_context_t* ctx = argument;
+    app_rtos_failure_t failure;
+    uint8_t event;
+
+    APP_RTOS_Control_StartUp(ctx);
+
+    for (;;)
+    {
+        if (xQueueReceive(event_queue, &event, pdMS_TO_TICKS(APP_RTOS_CONTROL_PERIOD_MS)) == pdPASS)
+        {
+            do
+            {
+                if (event == kAPP_RTOS_EVENT_CAN_RX)
+                {
+                    ctx->flag_rx_can = CAN_MSG_RECEIVED;
+                }
+                else if (event == kAPP_RTOS_EVENT_CAN_TX)
+                {
+                    ctx->flag_tx_can = CAN_TX_READY;
+                }
+            }
+            while (xQueueReceive(event_queue, &event, 0) == pdPASS);
+        }
+
+        /* Último resultado de la máquina de fallas */
+        if (xQueueReceive(failure_queue, &failure, 0) == pdPASS)
+        {
+            ctx->bus_data.failure = failure.failure;
+            ctx->bus_can_output.estado_falla = failure.estado_falla;
+            ctx->bus_can_output.autokill = failure.autokill;
+        }
+
+        APP_RTOS_Control_Pass(ctx);
+    }
+}
+
+/**
+ * @brief Tarea de fallas.
+ *
+ * Evalúa la máquina de fallas con cada bus de datos monitoreado y, sin datos nuevos, cada
+ * APP_RTOS_FAILURES_PERIOD_MS para que avancen las ventanas de persistencia por tiempo.
+ *
+ * @param argument Contexto de la tarea
+ * @retval None
+ */
+static void APP_RTOS_Failures_Task(void* argument)
+{
+    app_context_t* ctx = argument;
+    app_rtos_failure_t failure;
+    bool has_data = false;
+
+    for (;;)
+    {
+        if (xQueueReceive(monitored_queue, &ctx->bus_data, pdMS_TO_TICKS(APP_RTOS_FAILURES_PERIOD_MS)) == pdPASS)
+        {
+            has_data = true;
+
+            /* Muestra nueva para las ventanas de persistencia (sin ella solo avanza el tiempo) */
+            ctx->failures_sample = true;
+        }
+
+        /* Sin un primer bus de datos no hay nada que evaluar */
+        if (!has_data)
+        {
+            continue;
+        }
+
+        PROFILER_MEASURE(kPROFILER_STAGE_FAILURES, FAILURES_Process(ctx));
+
+        failure.failure = ctx->bus_data.failure;
+        failure.estado_falla = ctx->bus_can_output.estado_falla;
+        failure.autokill = ctx->bus_can_output.autokill;
+
+        (void)xQueueOverwrite(failure_queue, &failure);
+
+        APP_RTOS_Send_Event(kAPP_RTOS_EVENT_FAILURE);
+    }
+}
+
+/**
+ * @brief Tarea de monitoreo: estado de los módulos para cada bus de datos decodificado.
+ *
+ * @param argument Contexto de la tarea
+ * @retval None
+ */
+static void APP_RTOS_Monitoring_Task(void* argument)
+{
+    app_context_t* ctx = argument;
+
+    for (;;)
+    {
+        (void)xQueueReceive(data_queue, &ctx->bus_data, portMAX_DELAY);
+
+        PROFILER_MEASURE(kPROFILER_STAGE_MONITORING, MONITORING_Process(ctx));
+
+        (void)xQueueOverwrite(monitored_queue, &ctx->bus_data);
+    }
+}
+
+/**
+ * @brief Tarea de indicadores.
+ *
+ * Durante la espera de echo enciende los LEDs de los módulos que respondieron. Al pasar a kRUNNING ejecuta la
+ * indicación de fin de inicialización (bloqueante, pero en la tarea de menor prioridad) y luego INDICATORS_Process.
+ *
+ * @param argument Contexto de la tarea
+ * @retval None
+ */
+static void APP_RTOS_Indicators_Task(void* argument)
+{
+    app_context_t* ctx = argument;
+    app_rtos_indicators_t indicators;
+    bool started = false;
+
+    for (;;)
+    {
+        (void)xQueueReceive(indicators_queue, &indicators, portMAX_DELAY);
+
+        ctx->bus_data.driving_mode = indicators.driving_mode;
+        ctx->bus_data.failure = indicators.failure;
+        ctx->bus_can_input.bms_ok = indicators.bms_ok;
+        ctx->bus_can_input.dcdc_ok = indicators.dcdc_ok;
+        ctx->bus_can_input.perifericos_ok = indicators.perifericos_ok;
+
+        if (!indicators.running)
+        {
+            INDICATORS_Update_ModulesLEDs(ctx);
+            continue;
+        }
+
+        if (!started)
+        {
+            INDICATORS_Finish_StartUp();
+            started = true;
+        }
+
+        PROFILER_MEASURE(kPROFILER_STAGE_INDICATORS, INDICATORS_Process(ctx));
+    }
+}
+
+/**
+ * @brief Espera de echo de la tarea de control (estado kWAITING_ECHO_RESPONSE de la superloop).
+ *
+ * Mismos tiempos que MX_APP_Process, pero las esperas bloquean la tarea en vez de la CPU.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+static void APP_RTOS_Control_StartUp(app_context_t* ctx)
+{
+    uint8_t event;
+
+    vTaskDelay(pdMS_TO_TICKS(MX_APP_ECHO_DELAY_MS));
+
+    /* Envía echo a demás tarjetas */
+    MX_APP_Send_Echo(ctx);
+
+    ctx->app_timestart_us = TIMEBASE_Get_Us();
+
+    while (!MX_APP_Modules_Ok(ctx))
+    {
+        /* Recibió mensaje CAN */
+        if (xQueueReceive(event_queue, &event, pdMS_TO_TICKS(APP_RTOS_CONTROL_PERIOD_MS)) == pdPASS &&
+            event == kAPP_RTOS_EVENT_CAN_RX)
+        {
+            BUSES_Input_Snapshot(&ctx->bus_can_input_shared, &ctx->bus_can_input);
+        }
+
+        /* LEDs para indicar confirmación de cada módulo */
+        APP_RTOS_Send_Indicators(ctx, false);
+
+        if (TIMEBASE_IS_EXPIRED(ctx->app_timestart_us, TIMEBASE_Get_Us(), MX_APP_ECHO_TIMEOUT_US))
+        {
+            /* Envía echo a demás tarjetas, de nuevo */
+            MX_APP_Send_Echo(ctx);
+
+            ctx->app_timestart_us = TIMEBASE_Get_Us();
+        }
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(MX_APP_READY_DELAY_MS));
+
+    /* Los eventos de la espera ya fueron atendidos por el snapshot */
+    xQueueReset(event_queue);
+
+    MX_APP_Enter_Running(ctx);
+
+    /* Fin de inicialización en la tarea de indicadores, sin detener el camino de pedal */
+    APP_RTOS_Send_Indicators(ctx, true);
+}
+
+/**
+ * @brief Pasada de la tarea de control.
+ *
+ * Mismo orden que MX_APP_Run_Pass para las etapas del camino de pedal. MONITORING, FAILURES e INDICATORS
+ * reciben el bus de datos por cola y corren en sus tareas.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+static void APP_RTOS_Control_Pass(app_context_t* ctx)
+{
+    bool decoded;
+
+#if USE_BUS_LOAD_FEATURE == 1
+    /* Cierra las ventanas de carga del bus vencidas (la tarea despierta al menos con cada trigger de TIM7) */
+    BUS_LOAD_Process(TIMEBASE_Get_Us());
+#endif /* USE_BUS_LOAD_FEATURE */
+
+#if USE_CPU_LOAD_FEATURE == 1
+    /* Con tareas, la carga medida es la de la tarea de control */
+    CPU_LOAD_Pass_Begin(CPU_LOAD_GET_CYCLES(), true);
+#endif /* USE_CPU_LOAD_FEATURE */
+
+    PROFILER_MEASURE(kPROFILER_STAGE_CAN_APP, CAN_APP_Process(ctx));
+
+    /* DECODE_DATA_Process limpia la bandera */
+    decoded = (ctx->flag_decodificar == DECODIFICA);
+
+    PROFILER_MEASURE(kPROFILER_STAGE_DECODE_DATA, DECODE_DATA_Process(ctx));
+
+    PROFILER_MEASURE(kPROFILER_STAGE_DRIVING_MODES, DRIVING_MODES_Process(ctx));
+
+    PROFILER_MEASURE(kPROFILER_STAGE_RAMPA_PEDAL, RAMPA_PEDAL_Process(ctx));
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+    /* Señales del bus de salida CAN que cambiaron en esta pasada (y reenvíos vencidos) */
+    CAN_APP_Send_Changes(ctx);
+#elif USE_PEDAL_EVENT_TX_FEATURE == 1
+    /* Nivel de velocidad de la muestra de pedal de esta pasada, sin esperar el trigger de TIM7 */
+    CAN_APP_Send_Velocidad(ctx);
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+    /* Datos nuevos para monitoreo y fallas, que corren cuando esta tarea se bloquea */
+    if (decoded)
+    {
+        (void)xQueueOverwrite(data_queue, &ctx->bus_data);
+    }
+
+    APP_RTOS_Send_Indicators(ctx, true);
+
+#if USE_CPU_LOAD_FEATURE == 1
+    CPU_LOAD_Pass_End(CPU_LOAD_GET_CYCLES());
+#endif /* USE_CPU_LOAD_FEATURE */
+}
+
+/**
+ * @brief Envía un evento a la tarea de control sin bloquear.
+ *
+ * Con la cola llena el evento se descarta: la tarea de control ya tiene eventos pendientes y su próxima
+ * pasada procesa el bus de recepción y el resultado de fallas más recientes.
+ *
+ * @param event Evento
+ * @retval None
+ */
+static void APP_RTOS_Send_Event(app_rtos_event_t event)
+{
+    uint8_t value = (uint8_t)event;
+
+    (void)xQueueSend(event_queue, &value, 0);
+}
+
+/**
+ * @brief Publica el estado de indicadores (reemplaza al anterior no leído).
+ *
+ * @param ctx       Contexto de la aplicación
+ * @param running   Control en kRUNNING
+ * @retval None
+ */
+static void APP_RTOS_Send_Indicators(const app_context_t* ctx, bool running)
+{
+    app_rtos_indicators_t indicators;
+
+    indicators.running = running;
+    indicators.driving_mode = ctx->bus_data.driving_mode;
+    indicators.failure = ctx->bus_data.failure;
+    indicators.bms_ok = ctx->bus_can_input.bms_ok;
+    indicators.dcdc_ok = ctx->bus_can_input.dcdc_ok;
+    indicators.perifericos_ok = ctx->bus_can_input.perifericos_ok;
+
+    (void)xQueueOverwrite(indicators_queue, &indicators);
+}
+
+/**
+ * @brief Crea una tarea; sin memoria llama a Error_Handler.
+ *
+ * @param task      Función de la tarea
+ * @param name      Nombre
+ * @param stack     Stack en palabras
+ * @param argument  Argumento de la tarea
+ * @param priority  Prioridad
+ * @retval None
+ */
+static void APP_RTOS_Create_Task(TaskFunction_t task, const char* name, configSTACK_DEPTH_TYPE stack,
+                                 void* argument, UBaseType_t priority)
+{
+    if (xTaskCreate(task, name, stack, argument, priority, NULL) != pdPASS)
+    {
+        Error_Handler();
+    }
+}
+
+#endif /* USE_FREERTOS_FEATURE */
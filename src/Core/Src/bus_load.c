@@ -0,0 +1,344 @@
+/**
+ * @file bus_load.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Medidor de carga del bus CAN
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Las tramas observadas suman bits a un acumulador de la ventana actual (O(1) en la ISR). Al cerrar una ventana
+ * de 100 ms la pasada principal la guarda en una historia circular de BUS_LOAD_WINDOWS_10S ventanas y actualiza
+ * las sumas deslizantes de 1 s y 10 s restando la ventana que sale de cada una. Las divisiones se hacen solo al
+ * armar el reporte, una vez por segundo.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "bus_load.h"
+
+/* Application includes */
+#include "ramfunc.h"
+#include "timebase.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Payload máximo de una trama en bytes */
+#define BUS_LOAD_MAX_DLC                    8U
+
+#if USE_BUS_LOAD_FEATURE == 1
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Bitrate del bus en bit/s */
+static uint32_t bus_bitrate = 0;
+
+/** @brief Bits observados en la ventana actual (escritos por ISRs) */
+static volatile uint32_t window_bits = 0;
+
+/** @brief Tramas observadas en la ventana actual (escritas por ISRs) */
+static volatile uint32_t window_frames = 0;
+
+/** @brief Inicio de la ventana actual */
+static uint32_t window_start_us = 0;
+
+/** @brief Bits de las últimas BUS_LOAD_WINDOWS_10S ventanas cerradas */
+static uint32_t history_bits[BUS_LOAD_WINDOWS_10S];
+
+/** @brief Posición de la próxima ventana cerrada en la historia */
+static uint32_t history_index = 0;
+
+/** @brief Ventanas cerradas, saturado en BUS_LOAD_WINDOWS_10S */
+static uint32_t history_count = 0;
+
+/** @brief Bits de las últimas BUS_LOAD_WINDOWS_1S ventanas */
+static uint32_t sum_bits_1s = 0;
+
+/** @brief Bits de las últimas BUS_LOAD_WINDOWS_10S ventanas */
+static uint32_t sum_bits_10s = 0;
+
+/** @brief Ventanas cerradas desde el último reporte */
+static uint32_t report_windows = 0;
+
+/** @brief Máximo de bits de una ventana desde el último reporte */
+static uint32_t report_bits_max = 0;
+
+/** @brief Tramas desde el último reporte */
+static uint32_t report_frames = 0;
+
+/** @brief Último reporte */
+static bus_load_report_t report_last;
+
+/** @brief Indica un reporte nuevo no leído */
+static bool report_ready = false;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void BUS_LOAD_Close_Window(uint32_t bits, uint32_t frames);
+static uint16_t BUS_LOAD_Percent(uint32_t bits, uint32_t windows);
+
+#endif /* USE_BUS_LOAD_FEATURE */
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+#if USE_BUS_LOAD_FEATURE == 1
+
+/**
+ * @brief Inicializa el medidor de carga del bus.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param bitrate   Bitrate del bus en bit/s
+ * @param now_us    Valor actual de la base de tiempo en us (inicio de la primera ventana)
+ * @retval None
+ */
+void BUS_LOAD_Init(uint32_t bitrate, uint32_t now_us)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    /* La recepción CAN puede estar corriendo */
+    __disable_irq();
+
+    window_bits = 0;
+    window_frames = 0;
+
+    __set_PRIMASK(primask);
+
+    bus_bitrate = bitrate;
+    window_start_us = now_us;
+
+    memset(history_bits, 0, sizeof(history_bits));
+    history_index = 0;
+    history_count = 0;
+    sum_bits_1s = 0;
+    sum_bits_10s = 0;
+
+    report_windows = 0;
+    report_bits_max = 0;
+    report_frames = 0;
+    report_last = (bus_load_report_t){0};
+    report_ready = false;
+}
+
+/**
+ * @brief Suma una trama observada (recibida o propia) a la ventana actual.
+ *
+ * Puede llamarse desde ISRs y desde la pasada principal (sección crítica con PRIMASK).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param dlc       Largo de la trama (DLC, se satura en 8)
+ * @retval None
+ */
+RAMFUNC void BUS_LOAD_Record(uint8_t dlc)
+{
+    uint32_t bits = BUS_LOAD_Frame_Bits(dlc);
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    window_bits += bits;
+    window_frames++;
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Cierra las ventanas de BUS_LOAD_WINDOW_US vencidas, desde la pasada principal.
+ *
+ * Marca un reporte nuevo cada BUS_LOAD_WINDOWS_1S ventanas.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval None
+ */
+void BUS_LOAD_Process(uint32_t now_us)
+{
+    uint32_t closed = 0;
+    uint32_t bits;
+    uint32_t frames;
+    uint32_t primask;
+
+    while (TIMEBASE_IS_EXPIRED(window_start_us, now_us, BUS_LOAD_WINDOW_US))
+    {
+        /* Tras una pausa más larga que la historia, las ventanas vacías restantes no cambian nada */
+        if (closed >= BUS_LOAD_WINDOWS_10S)
+        {
+            window_start_us = now_us;
+            break;
+        }
+
+        window_start_us += BUS_LOAD_WINDOW_US;
+
+        /* La primera ventana vencida se lleva lo acumulado; las siguientes (pasada atrasada) quedan vacías */
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+        bits = window_bits;
+        frames = window_frames;
+        window_bits = 0;
+        window_frames = 0;
+
+        __set_PRIMASK(primask);
+
+        BUS_LOAD_Close_Window(bits, frames);
+        closed++;
+    }
+}
+
+/**
+ * @brief Retorna si hay un reporte nuevo desde la última llamada (y lo marca como leído).
+ *
+ * @param report    Reporte a completar
+ * @retval true     Hay reporte nuevo
+ * @retval false    No hay reporte nuevo
+ */
+bool BUS_LOAD_Get_Report(bus_load_report_t* report)
+{
+    if (!report_ready)
+    {
+        return false;
+    }
+
+    *report = report_last;
+    report_ready = false;
+
+    return true;
+}
+
+#endif /* USE_BUS_LOAD_FEATURE */
+
+/**
+ * @brief Largo en bits de una trama estándar de datos con el peor caso de bit stuffing.
+ *
+ * @param dlc       Largo de la trama (DLC, se satura en 8)
+ * @return uint32_t Bits en el bus, incluido el espacio entre tramas
+ */
+RAMFUNC uint32_t BUS_LOAD_Frame_Bits(uint8_t dlc)
+{
+    uint32_t data_bits = 8U * ((dlc > BUS_LOAD_MAX_DLC) ? BUS_LOAD_MAX_DLC : dlc);
+
+    /* 34 + 8n bits de SOF a CRC con un bit de stuffing cada 4 tras el primero, más 13 bits sin stuffing */
+    return 47U + data_bits + ((34U + data_bits - 1U) >> 2);
+}
+
+/**
+ * @brief Codifica un reporte en la trama de carga del bus.
+ *
+ * Formato (little-endian, centésimas de %): bytes 0-1 carga de 100 ms, bytes 2-3 carga de 1 s, bytes 4-5 carga
+ * de 10 s, bytes 6-7 máxima carga de 100 ms en el último segundo.
+ *
+ * @param report    Reporte a codificar
+ * @param payload   Buffer de BUS_LOAD_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t BUS_LOAD_Encode_Frame(const bus_load_report_t* report, uint8_t* payload)
+{
+    payload[0] = (uint8_t)(report->load_100ms & 0xFF);
+    payload[1] = (uint8_t)(report->load_100ms >> 8);
+    payload[2] = (uint8_t)(report->load_1s & 0xFF);
+    payload[3] = (uint8_t)(report->load_1s >> 8);
+    payload[4] = (uint8_t)(report->load_10s & 0xFF);
+    payload[5] = (uint8_t)(report->load_10s >> 8);
+    payload[6] = (uint8_t)(report->load_100ms_max & 0xFF);
+    payload[7] = (uint8_t)(report->load_100ms_max >> 8);
+
+    return BUS_LOAD_FRAME_LENGTH;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+#if USE_BUS_LOAD_FEATURE == 1
+
+/**
+ * @brief Guarda una ventana cerrada, actualiza las sumas deslizantes y arma el reporte cada segundo.
+ *
+ * @param bits      Bits observados en la ventana
+ * @param frames    Tramas observadas en la ventana
+ * @retval None
+ */
+static void BUS_LOAD_Close_Window(uint32_t bits, uint32_t frames)
+{
+    uint32_t out_1s = (history_index + BUS_LOAD_WINDOWS_10S - BUS_LOAD_WINDOWS_1S) % BUS_LOAD_WINDOWS_10S;
+
+    /* Sale de la suma de 1 s la ventana de hace BUS_LOAD_WINDOWS_1S y de la de 10 s la que se sobrescribe */
+    sum_bits_1s += bits - history_bits[out_1s];
+    sum_bits_10s += bits - history_bits[history_index];
+
+    history_bits[history_index] = bits;
+    history_index = (history_index + 1U) % BUS_LOAD_WINDOWS_10S;
+
+    if (history_count < BUS_LOAD_WINDOWS_10S)
+    {
+        history_count++;
+    }
+
+    if (bits > report_bits_max)
+    {
+        report_bits_max = bits;
+    }
+
+    report_frames += frames;
+
+    if (++report_windows < BUS_LOAD_WINDOWS_1S)
+    {
+        return;
+    }
+
+    /* Ventanas aún no observadas (primeros segundos) no cuentan como bus libre */
+    report_last.load_100ms = BUS_LOAD_Percent(bits, 1U);
+    report_last.load_1s = BUS_LOAD_Percent(sum_bits_1s,
+                                           (history_count < BUS_LOAD_WINDOWS_1S) ? history_count : BUS_LOAD_WINDOWS_1S);
+    report_last.load_10s = BUS_LOAD_Percent(sum_bits_10s, history_count);
+    report_last.load_100ms_max = BUS_LOAD_Percent(report_bits_max, 1U);
+    report_last.frames_1s = report_frames;
+    report_ready = true;
+
+    report_windows = 0;
+    report_bits_max = 0;
+    report_frames = 0;
+}
+
+/**
+ * @brief Carga en centésimas de % de los bits de un número de ventanas base.
+ *
+ * @param bits      Bits observados
+ * @param windows   Ventanas base
+ * @return uint16_t Carga (saturada en UINT16_MAX; el peor caso de stuffing puede pasar de 100 %)
+ */
+static uint16_t BUS_LOAD_Percent(uint32_t bits, uint32_t windows)
+{
+    uint64_t capacity = (uint64_t)bus_bitrate * BUS_LOAD_WINDOW_US * windows;
+    uint64_t load;
+
+    if (capacity == 0U)
+    {
+        return 0;
+    }
+
+    load = ((uint64_t)bits * BUS_LOAD_SCALE * TIMEBASE_HZ + capacity / 2U) / capacity;
+
+    return (load > UINT16_MAX) ? UINT16_MAX : (uint16_t)load;
+}
+
+#endif /* USE_BUS_LOAD_FEATURE */
@@ -15,12 +15,21 @@
 
 #include "buses.h"
 
+/* Application includes */
+#include "ramfunc.h"
+
+/* C includes */
+#include <string.h>
+
+/* STM32 HAL include */
+#include "main.h"
+
 /***********************************************************************************************************************
  * Buses initialization
  **********************************************************************************************************************/
 
-/* Inicialización de bus de datos (bus 1) */
-typedef_bus1_t bus_data =
+/* Valores iniciales de bus de datos (bus 1), copiados a cada contexto por APP_CONTEXT_Init */
+const typedef_bus1_t bus_data_init =
 {
 	/* Variables modo de manejo y fallas */
 	.driving_mode = kDRIVING_MODE_NORMAL,
@@ -51,8 +60,8 @@ typedef_bus1_t bus_data =
 	.inversor_status = kMODULE_STATUS_DATA_PROBLEM,
 };
 
-/* Inicialización de bus de salida CAN (bus 2) */
-typedef_bus2_t bus_can_output =
+/* Valores iniciales de bus de salida CAN (bus 2) */
+const typedef_bus2_t bus_can_output_init =
 {
 	.autokill = CAN_VALUE_AUTOKILL_OFF,
 	.estado_manejo = CAN_VALUE_DRIVING_MODE_NORMAL,
@@ -62,8 +71,8 @@ typedef_bus2_t bus_can_output =
 	.control_ok = CAN_VALUE_MODULE_IDLE
 };
 
-/* Inicialización de bus de recepción CAN (bus 3) */
-typedef_bus3_t bus_can_input =
+/* Valores iniciales de bus de recepción CAN (bus 3), también para su copia compartida */
+const typedef_bus3_t bus_can_input_init =
 {
 	.bms_ok = CAN_VALUE_MODULE_IDLE,
 	.dcdc_ok = CAN_VALUE_MODULE_IDLE,
@@ -73,3 +82,63 @@ typedef_bus3_t bus_can_input =
 	.hombre_muerto = CAN_VALUE_HOMBRE_MUERTO_OFF,
 	.botones_cambio_estado = CAN_VALUE_BTN_NONE
 };
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicio de escritura en bus de recepción CAN compartido.
+ *
+ * Solo debe llamarse desde el contexto que escribe el bus (ISR de recepción CAN).
+ *
+ * @param shared Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @retval None
+ */
+RAMFUNC void BUSES_Input_Write_Begin(typedef_bus3_shared_t* shared)
+{
+	/* Contador impar: escritura en curso */
+	shared->seq++;
+
+	__DMB();
+}
+
+/**
+ * @brief Fin de escritura en bus de recepción CAN compartido.
+ *
+ * @param shared Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @retval None
+ */
+RAMFUNC void BUSES_Input_Write_End(typedef_bus3_shared_t* shared)
+{
+	__DMB();
+
+	/* Contador par: datos consistentes */
+	shared->seq++;
+}
+
+/**
+ * @brief Copia consistente del bus de recepción CAN compartido.
+ *
+ * Reintenta la copia hasta obtener una versión que no fue modificada durante la lectura.
+ *
+ * @param shared   Puntero a estructura de tipo typedef_bus3_shared_t (bus de recepción CAN compartido)
+ * @param snapshot Puntero a estructura de tipo typedef_bus3_t donde se guarda la copia
+ * @retval None
+ */
+RAMFUNC void BUSES_Input_Snapshot(const typedef_bus3_shared_t* shared, typedef_bus3_t* snapshot)
+{
+	uint32_t seq;
+
+	do
+	{
+		seq = shared->seq;
+
+		__DMB();
+
+		memcpy(snapshot, &shared->data, sizeof(typedef_bus3_t));
+
+		__DMB();
+
+	} while ((seq & 1U) != 0U || seq != shared->seq);
+}
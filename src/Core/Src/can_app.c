@@ -15,6 +15,16 @@
 
 #include "can_app.h"
 
+/* Application includes */
+#include "profiler.h"
+#include "bus_load.h"
+#include "cpu_load.h"
+#include "latency.h"
+#include "ramfunc.h"
+#include "rx_timing.h"
+#include "timebase.h"
+#include "tx_policy.h"
+
 /***********************************************************************************************************************
  * Private macros
  **********************************************************************************************************************/
@@ -22,6 +32,26 @@
 /** @brief CAN number of messages to transmit */
 #define CAN_NUM_OF_MSGS                 6
 
+/** @brief Trama de camino rápido pendiente: nivel de velocidad */
+#define CAN_PRIORITY_NIVEL_VELOCIDAD    (1U << 0)
+
+/** @brief Trama de camino rápido pendiente: hombre muerto */
+#define CAN_PRIORITY_HOMBRE_MUERTO      (1U << 1)
+
+/** @brief Suma una trama propia dejada en mailbox a la carga del bus */
+#if USE_BUS_LOAD_FEATURE == 1
+#define CAN_APP_BUS_LOAD_RECORD(length) BUS_LOAD_Record(length)
+#else
+#define CAN_APP_BUS_LOAD_RECORD(length) ((void)(length))
+#endif /* USE_BUS_LOAD_FEATURE */
+
+/** @brief Agrega el contador de secuencia a una trama de un byte de Control */
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+#define CAN_APP_STAMP_SEQUENCE(ctx, frame)  CAN_APP_Stamp_Sequence((ctx), (frame))
+#else
+#define CAN_APP_STAMP_SEQUENCE(ctx, frame)  ((void)(ctx), (void)(frame))
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
 /***********************************************************************************************************************
  * Private variables definitions
  **********************************************************************************************************************/
@@ -34,13 +64,30 @@ static const uint32_t can_ids_array[CAN_NUM_OF_MSGS] = {CAN_ID_CONTROL_AUTOKILL,
                                                         CAN_ID_CONTROL_HOMBRE_MUERTO,
                                                         CAN_ID_CONTROL_OK};
 
-/** @brief Array of CAN values to transmit */
-static uint8_t can_values_array[CAN_NUM_OF_MSGS];
+#if USE_CAN_TX_POLICY_FEATURE == 1
+/** @brief IDs de las señales con política de transmisión por cambio, en el orden de can_tx_signal_t */
+static const uint32_t can_tx_policy_ids[kCAN_TX_NUM_OF_SIGNALS] = {CAN_ID_CONTROL_ESTADO_MANEJO,
+                                                                   CAN_ID_CONTROL_ESTADO_FALLA,
+                                                                   CAN_ID_CONTROL_NIVEL_VELOCIDAD,
+                                                                   CAN_ID_CONTROL_HOMBRE_MUERTO};
+#endif /* USE_CAN_TX_POLICY_FEATURE */
 
 /***********************************************************************************************************************
  * Private functions prototypes
  **********************************************************************************************************************/
 
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+static void CAN_APP_Deadman_FastPath(app_context_t* ctx, uint8_t value);
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+#if USE_CPU_LOAD_FEATURE == 1
+static void CAN_APP_Send_CpuLoad(CAN_t* can_obj);
+#endif /* USE_CPU_LOAD_FEATURE */
+
+#if USE_BUS_LOAD_FEATURE == 1
+static void CAN_APP_Send_BusLoad(CAN_t* can_obj);
+#endif /* USE_BUS_LOAD_FEATURE */
+
 /***********************************************************************************************************************
  * Public functions implementation
  **********************************************************************************************************************/
@@ -54,66 +101,108 @@ static uint8_t can_values_array[CAN_NUM_OF_MSGS];
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void CAN_APP_Process(void)
+RAMFUNC void CAN_APP_Process(app_context_t* ctx)
 {
-	/** Increments every time CAN TX flag is set as CAN_TX_READY */
-	static int can_tx_flag_count = 0;
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+    /* Tramas de camino rápido que la ISR no pudo dejar en mailbox, antes que cualquier otra */
+    CAN_APP_Send_Priority(ctx);
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
 
     /* Recibió mensaje CAN */
-    if (flag_rx_can == CAN_MSG_RECEIVED)
+    if (ctx->flag_rx_can == CAN_MSG_RECEIVED)
     {
 		/* Toggle LED 2 (Red LED) */
 		BSP_LED_Toggle(LED2);
 
-        /* Guarda mensaje CAN recibido en bus de entrada CAN */
-        CAN_APP_Store_ReceivedMessage();
+        /* Clear CAN received message flag (before snapshot, so later frames set it again) */
+        ctx->flag_rx_can = CAN_MSG_NOT_RECEIVED;
+
+#if USE_PEDAL_EVENT_TX_FEATURE == 1 && USE_CAN_TX_POLICY_FEATURE == 0
+        /* Muestra de pedal en este snapshot: nivel de velocidad se envía al final de la pasada */
+        if (ctx->flag_rx_pedal == CAN_MSG_RECEIVED)
+        {
+            ctx->flag_rx_pedal = CAN_MSG_NOT_RECEIVED;
+            ctx->velocidad_tx_pending = true;
+        }
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
 
-        /* Clear CAN received message flag */
-        flag_rx_can = CAN_MSG_NOT_RECEIVED;
+        /* Snapshot consistente del bus de entrada CAN para esta pasada */
+        BUSES_Input_Snapshot(&ctx->bus_can_input_shared, &ctx->bus_can_input);
 
         /* Activa bandera para decodificar */
-        flag_decodificar = DECODIFICA;
+        ctx->flag_decodificar = DECODIFICA;
     }
 
     /* Hubo trigger para transmisión mensaje CAN */
-    if (flag_tx_can == CAN_TX_READY)
+    if (ctx->flag_tx_can == CAN_TX_READY)
     {
     	/* Incrementa contador de bandera transmisión CAN */
-    	can_tx_flag_count++;
+    	ctx->can_tx_flag_count++;
 
     	/* Send bus variables every 100ms (CAN transmission timer is set to 100ms) */
-    	if(can_tx_flag_count % 1 == 0)
+    	if(ctx->can_tx_flag_count % 1 == 0)
     	{
     		/* Toggle LED 1 (Red LED) */
     		BSP_LED_Toggle(LED1);
 
-			/* Envío de datos del bus de salida CAN a módulo CAN */
-			CAN_APP_Send_BusData(&bus_can_output);
+#if USE_CAN_TX_POLICY_FEATURE == 0
+			/* Envío de datos del bus de salida CAN a módulo CAN (con política por cambio: CAN_APP_Send_Changes) */
+			CAN_APP_Send_BusData(ctx);
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+#if USE_PROFILER_FEATURE == 1
+			/* Envío de una trama de diagnóstico del profiler */
+			PROFILER_Export_Next(&ctx->can_obj.Frame);
+			CAN_APP_Send_Message(&ctx->can_obj);
+#endif /* USE_PROFILER_FEATURE */
+
+#if USE_LATENCY_FEATURE == 1
+			/* Envío de una trama de diagnóstico de latencia pedal-inversor */
+			LATENCY_Export_Next(&ctx->can_obj.Frame);
+			CAN_APP_Send_Message(&ctx->can_obj);
+#endif /* USE_LATENCY_FEATURE */
+
+#if USE_CPU_LOAD_FEATURE == 1
+			/* Envío de reporte de carga de CPU (uno por segundo) */
+			CAN_APP_Send_CpuLoad(&ctx->can_obj);
+#endif /* USE_CPU_LOAD_FEATURE */
+
+#if USE_BUS_LOAD_FEATURE == 1
+			/* Envío de reporte de carga del bus CAN (uno por segundo) */
+			CAN_APP_Send_BusLoad(&ctx->can_obj);
+#endif /* USE_BUS_LOAD_FEATURE */
+
+#if USE_RX_TIMING_FEATURE == 1
+			/* Volcado de estadísticas de llegada por ID pedido por diagnóstico (una trama por trigger) */
+			if (RX_TIMING_Export_Next(&ctx->can_obj.Frame, TIMEBASE_Get_Us()) &&
+				CAN_APP_Send_Message(&ctx->can_obj) == CAN_STATUS_OK)
+			{
+				RX_TIMING_Export_Done();
+			}
+#endif /* USE_RX_TIMING_FEATURE */
 
 			/* Better reset this to zero */
-			can_tx_flag_count = 0;
+			ctx->can_tx_flag_count = 0;
     	}
 
         /* Clear CAN TX ready flag */
-        flag_tx_can = CAN_TX_NOT_READY;
+        ctx->flag_tx_can = CAN_TX_NOT_READY;
     }
 
     /* Si hay autokill */
-    if(bus_data.failure == kFAILURE_AUTOKILL)
+    if(ctx->bus_data.failure == kFAILURE_AUTOKILL)
     {
-    	/* Bus data into CAN values array */
-    	can_values_array[0] = bus_can_output.autokill;
-
 		/* Set up can_obj for message transmission */
-		can_obj.Frame.id = can_ids_array[0];
-		can_obj.Frame.payload_length = 1;
-		can_obj.Frame.payload_buff[0] = can_values_array[0];
+		ctx->can_obj.Frame.id = can_ids_array[0];
+		ctx->can_obj.Frame.payload_length = 1;
+		ctx->can_obj.Frame.payload_buff[0] = ctx->bus_can_output.autokill;
+		CAN_APP_STAMP_SEQUENCE(ctx, &ctx->can_obj.Frame);
 
 		/* Send message */
-		CAN_API_Send_Message(&can_obj);
+		CAN_APP_Send_Message(&ctx->can_obj);
     }
 }
 
@@ -124,13 +213,20 @@ void CAN_APP_Process(void)
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param bus_can_output Puntero a estructura de tipo typedef_bus2_t (bus de salida CAN)
+ * @param ctx Contexto de la aplicación (bus de salida CAN y objeto CAN)
  * @retval None
  */
-void CAN_APP_Send_BusData(typedef_bus2_t *bus_can_output)
+RAMFUNC void CAN_APP_Send_BusData(app_context_t* ctx)
 {
 	/* Index for CAN values array and CAN IDs array */
-	static int i = 0;
+	uint8_t i = ctx->can_tx_index;
+
+	/* Array of CAN values to transmit */
+	uint8_t can_values_array[CAN_NUM_OF_MSGS];
+
+	typedef_bus2_t* bus_can_output = &ctx->bus_can_output;
+	CAN_t* can_obj = &ctx->can_obj;
+	can_status_t status;
 
 	/* Bus data into CAN values array */
 	can_values_array[0] = bus_can_output->autokill;
@@ -143,136 +239,558 @@ void CAN_APP_Send_BusData(typedef_bus2_t *bus_can_output)
 	/* Index exceeds number of messages to transmit */
 	if(i >= CAN_NUM_OF_MSGS)
 	{
-		i=0;
+		ctx->can_tx_index = 0;
 		return;
 	}
 
 	/* Discard index for autokill message */
 	if(i == 0)
 	{
-		i++;
+		ctx->can_tx_index = i + 1;
 		return;
 	}
 
 	/* Discard index for control_ok message */
 	if(i == 5)
 	{
-		i++;
+		ctx->can_tx_index = i + 1;
 		return;
 	}
 
+#if USE_PEDAL_EVENT_TX_FEATURE == 1
+	/* Discard index for nivel_velocidad message (sent by CAN_APP_Send_Velocidad) */
+	if(i == 3)
+	{
+		ctx->can_tx_index = i + 1;
+		return;
+	}
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
+
 	/* Set up can_obj for message transmission */
-	can_obj.Frame.id = can_ids_array[i];
-	can_obj.Frame.payload_length = 1;
-	can_obj.Frame.payload_buff[0] = can_values_array[i];
+	can_obj->Frame.id = can_ids_array[i];
+	can_obj->Frame.payload_length = 1;
+	can_obj->Frame.payload_buff[0] = can_values_array[i];
+	CAN_APP_STAMP_SEQUENCE(ctx, &can_obj->Frame);
 
 	/* Send message */
-	CAN_API_Send_Message(&can_obj);
+	PROFILER_MEASURE(kPROFILER_STAGE_CAN_TX, status = CAN_APP_Send_Message(can_obj));
+
+#if USE_LATENCY_FEATURE == 1
+	/* Latencia desde llegada de la muestra de pedal hasta que nivel de velocidad queda en mailbox */
+	if (status == CAN_STATUS_OK && can_ids_array[i] == CAN_ID_CONTROL_NIVEL_VELOCIDAD)
+	{
+		LATENCY_Record_Tx(bus_can_output->nivel_velocidad_timestamp, LATENCY_GET_TIMESTAMP());
+	}
+#else
+	(void)status;
+#endif /* USE_LATENCY_FEATURE */
 
-	i++;
+	ctx->can_tx_index = i + 1;
 }
 
+#if USE_PEDAL_EVENT_TX_FEATURE == 1
+/**
+ * @brief Función de envío de nivel de velocidad por evento.
+ *
+ * Se llama al final de cada pasada, después de RAMPA_PEDAL_Process. Si en la pasada llegó una muestra de pedal,
+ * envía el nivel de velocidad recién calculado, respetando CAN_APP_VELOCIDAD_MIN_GAP_US desde el envío anterior;
+ * sin muestras, lo reenvía cada CAN_APP_VELOCIDAD_KEEPALIVE_US. Si los mailboxes están ocupados, reintenta en
+ * la próxima pasada.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (bus de salida CAN y objeto CAN)
+ * @retval None
+ */
+RAMFUNC void CAN_APP_Send_Velocidad(app_context_t* ctx)
+{
+	uint32_t now = TIMEBASE_Get_Us();
+	uint32_t wait_us = ctx->velocidad_tx_pending ? CAN_APP_VELOCIDAD_MIN_GAP_US : CAN_APP_VELOCIDAD_KEEPALIVE_US;
+	CAN_t* can_obj = &ctx->can_obj;
+	can_status_t status;
+
+	if (!TIMEBASE_IS_EXPIRED(ctx->velocidad_tx_last_us, now, wait_us))
+	{
+		return;
+	}
+
+	/* Set up can_obj for message transmission */
+	can_obj->Frame.id = CAN_ID_CONTROL_NIVEL_VELOCIDAD;
+	can_obj->Frame.payload_length = 1;
+	can_obj->Frame.payload_buff[0] = ctx->bus_can_output.nivel_velocidad;
+	CAN_APP_STAMP_SEQUENCE(ctx, &can_obj->Frame);
+
+	/* Send message */
+	PROFILER_MEASURE(kPROFILER_STAGE_CAN_TX, status = CAN_APP_Send_Message(can_obj));
+
+	if (status != CAN_STATUS_OK)
+	{
+		return;
+	}
+
+#if USE_LATENCY_FEATURE == 1
+	/* Latencia desde llegada de la muestra de pedal hasta que nivel de velocidad queda en mailbox */
+	if (ctx->velocidad_tx_pending)
+	{
+		LATENCY_Record_Tx(ctx->bus_can_output.nivel_velocidad_timestamp, LATENCY_GET_TIMESTAMP());
+	}
+#endif /* USE_LATENCY_FEATURE */
+
+	ctx->velocidad_tx_pending = false;
+	ctx->velocidad_tx_last_us = now;
+}
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+/**
+ * @brief Función de envío por cambio de las señales del bus de salida CAN.
+ *
+ * Se llama al final de cada pasada, después de RAMPA_PEDAL_Process. Envía, en el orden de can_tx_signal_t, cada
+ * señal cuya política (can_tx_policy de la configuración) lo pide: cambio fuera de la banda muerta con el
+ * intervalo mínimo cumplido, o intervalo máximo sin envíos. Reemplaza la rotación de CAN_APP_Send_BusData y el
+ * envío de nivel de velocidad por evento. Si los mailboxes están ocupados, la señal y las siguientes se
+ * reintentan en la próxima pasada. La política no ve los envíos del camino rápido de hombre muerto, por lo que
+ * ese flanco sale una vez más desde aquí.
+ *
+ * La primera llamada (primera pasada en kRUNNING) no envía: toma los valores actuales como enviados y escalona los
+ * primeros reenvíos cada CAN_APP_TX_PHASE_US, para que las señales no cumplan juntas su intervalo máximo en cada
+ * reenvío. Como con el envío por evento, nivel de velocidad sale recién con su primer cambio tras la espera de
+ * echo (el valor actual viene de muestras de pedal antiguas).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación (bus de salida CAN, objeto CAN y estado de transmisión)
+ * @retval None
+ */
+RAMFUNC void CAN_APP_Send_Changes(app_context_t* ctx)
+{
+	/* Array of CAN values to transmit */
+	uint8_t values[kCAN_TX_NUM_OF_SIGNALS];
+
+	uint32_t now = TIMEBASE_Get_Us();
+	CAN_t* can_obj = &ctx->can_obj;
+	can_status_t status;
+
+	/* Bus data into CAN values array */
+	values[kCAN_TX_ESTADO_MANEJO] = ctx->bus_can_output.estado_manejo;
+	values[kCAN_TX_ESTADO_FALLA] = ctx->bus_can_output.estado_falla;
+	values[kCAN_TX_NIVEL_VELOCIDAD] = ctx->bus_can_output.nivel_velocidad;
+	values[kCAN_TX_HOMBRE_MUERTO] = ctx->bus_can_output.hombre_muerto;
+
+	/* Primera pasada: valores de partida y primeros reenvíos escalonados */
+	if (!ctx->can_tx_policy_started)
+	{
+		for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+		{
+			TX_POLICY_Start(&ctx->config->can_tx_policy[i], &ctx->can_tx_policy[i], values[i], now,
+			                (uint32_t)(i + 1U) * CAN_APP_TX_PHASE_US);
+		}
+
+		ctx->can_tx_policy_started = true;
+		return;
+	}
+
+	for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+	{
+		tx_policy_state_t* state = &ctx->can_tx_policy[i];
+
+		if (!TX_POLICY_Is_Due(&ctx->config->can_tx_policy[i], state, values[i], now))
+		{
+			continue;
+		}
+
+		/* Set up can_obj for message transmission */
+		can_obj->Frame.id = can_tx_policy_ids[i];
+		can_obj->Frame.payload_length = 1;
+		can_obj->Frame.payload_buff[0] = values[i];
+		CAN_APP_STAMP_SEQUENCE(ctx, &can_obj->Frame);
+
+		/* Send message */
+		PROFILER_MEASURE(kPROFILER_STAGE_CAN_TX, status = CAN_APP_Send_Message(can_obj));
+
+		/* Mailboxes ocupados: esta señal y las siguientes se reintentan en la próxima pasada */
+		if (status != CAN_STATUS_OK)
+		{
+			return;
+		}
+
+#if USE_LATENCY_FEATURE == 1
+		/* Latencia desde llegada de la muestra de pedal hasta que un nivel de velocidad nuevo queda en mailbox */
+		if (i == kCAN_TX_NIVEL_VELOCIDAD && values[i] != state->value)
+		{
+			LATENCY_Record_Tx(ctx->bus_can_output.nivel_velocidad_timestamp, LATENCY_GET_TIMESTAMP());
+		}
+#endif /* USE_LATENCY_FEATURE */
+
+		TX_POLICY_Sent(state, values[i], now);
+	}
+}
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
 /**
  * @brief Función guardar mensaje CAN recibido en bus de entrada CAN.
  *
- * Según standard identifier que se recibió, guarda dato en variables de bus de recepción CAN.
+ * Según standard identifier que se recibió, guarda dato en variables de bus de recepción CAN
+ * compartido. Se llama desde la ISR de recepción; la escritura se protege con el contador de
+ * secuencia del bus compartido y nunca se bloquea.
+ * Con USE_DEADMAN_FAST_PATH_FEATURE, hombre muerto presionado dispara además el camino rápido
+ * (velocidad en cero y transmisión inmediata).
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx   Contexto de la aplicación
+ * @param frame Puntero a trama CAN recibida
  * @retval None
  */
-void CAN_APP_Store_ReceivedMessage(void)
+RAMFUNC void CAN_APP_Store_ReceivedMessage(app_context_t* ctx, const can_frame_t* frame)
 {
-    switch (can_obj.Frame.id)
+    /* Bus de recepción CAN compartido */
+    typedef_bus3_t* shared_input = &ctx->bus_can_input_shared.data;
+
+    BUSES_Input_Write_Begin(&ctx->bus_can_input_shared);
+
+    switch (frame->id)
     {
 
     /* ------------------------------ Periféricos ------------------------------ */
 
     case CAN_ID_PERIFERICOS_PEDAL:
-        bus_can_input.pedal = can_obj.Frame.payload_buff[0];
+        shared_input->pedal = frame->payload_buff[0];
+#if USE_LATENCY_FEATURE == 1
+        shared_input->pedal_timestamp = LATENCY_GET_TIMESTAMP();
+#endif /* USE_LATENCY_FEATURE */
+#if USE_PEDAL_EVENT_TX_FEATURE == 1
+        ctx->flag_rx_pedal = CAN_MSG_RECEIVED;
+#endif /* USE_PEDAL_EVENT_TX_FEATURE */
         break;
     case CAN_ID_PERIFERICOS_HOMBRE_MUERTO:
-        bus_can_input.hombre_muerto = can_obj.Frame.payload_buff[0];
+        shared_input->hombre_muerto = frame->payload_buff[0];
         break;
     case CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO:
-        bus_can_input.botones_cambio_estado = can_obj.Frame.payload_buff[0];
+        shared_input->botones_cambio_estado = frame->payload_buff[0];
         break;
     case CAN_ID_PERIFERICOS_OK:
-        bus_can_input.perifericos_ok = can_obj.Frame.payload_buff[0];
+        shared_input->perifericos_ok = frame->payload_buff[0];
         break;
 
     /* ---------------------------------- BMS ---------------------------------- */
 
     case CAN_ID_BMS_VOLTAJE:
-        bus_can_input.voltaje_bms = can_obj.Frame.payload_buff[0];
+        shared_input->voltaje_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_CORRIENTE:
-        bus_can_input.corriente_bms = can_obj.Frame.payload_buff[0];
+        shared_input->corriente_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_VOLTAJE_MIN_CELDA:
-        bus_can_input.voltaje_min_celda_bms = can_obj.Frame.payload_buff[0];
+        shared_input->voltaje_min_celda_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_POTENCIA:
-        bus_can_input.potencia_bms = can_obj.Frame.payload_buff[0];
+        shared_input->potencia_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_T_MAX:
-        bus_can_input.t_max_bms = can_obj.Frame.payload_buff[0];
+        shared_input->t_max_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_NIVEL_BATERIA:
-        bus_can_input.nivel_bateria_bms = can_obj.Frame.payload_buff[0];
+        shared_input->nivel_bateria_bms = frame->payload_buff[0];
         break;
     case CAN_ID_BMS_OK:
-        bus_can_input.bms_ok = can_obj.Frame.payload_buff[0];
+        shared_input->bms_ok = frame->payload_buff[0];
         break;
 
     /* --------------------------------- DCDC ---------------------------------- */
 
     case CAN_ID_DCDC_VOLTAJE_BATERIA:
-        bus_can_input.voltaje_bateria_dcdc = can_obj.Frame.payload_buff[0];
+        shared_input->voltaje_bateria_dcdc = frame->payload_buff[0];
         break;
     case CAN_ID_DCDC_VOLTAJE_SALIDA:
-        bus_can_input.voltaje_salida_dcdc = can_obj.Frame.payload_buff[0];
+        shared_input->voltaje_salida_dcdc = frame->payload_buff[0];
         break;
     case CAN_ID_DCDC_T_MAX:
-        bus_can_input.t_max_dcdc = can_obj.Frame.payload_buff[0];
+        shared_input->t_max_dcdc = frame->payload_buff[0];
         break;
     case CAN_ID_DCDC_POTENCIA:
-        bus_can_input.potencia_dcdc = can_obj.Frame.payload_buff[0];
+        shared_input->potencia_dcdc = frame->payload_buff[0];
         break;
     case CAN_ID_DCDC_OK:
-        bus_can_input.dcdc_ok = can_obj.Frame.payload_buff[0];
+        shared_input->dcdc_ok = frame->payload_buff[0];
         break;
 
     /* -------------------------------- Inversor ------------------------------- */
 
     case CAN_ID_INVERSOR_VELOCIDAD:
-        bus_can_input.velocidad_inv = can_obj.Frame.payload_buff[0];
+        shared_input->velocidad_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_V:
-        bus_can_input.V_inv = can_obj.Frame.payload_buff[0];
+        shared_input->V_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_I:
-        bus_can_input.I_inv = can_obj.Frame.payload_buff[0];
+        shared_input->I_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_TEMP_MAX:
-        bus_can_input.temp_max_inv = can_obj.Frame.payload_buff[0];
+        shared_input->temp_max_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_TEMP_MOTOR:
-        bus_can_input.temp_motor_inv = can_obj.Frame.payload_buff[0];
+        shared_input->temp_motor_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_POTENCIA:
-        bus_can_input.potencia_inv = can_obj.Frame.payload_buff[0];
+        shared_input->potencia_inv = frame->payload_buff[0];
         break;
     case CAN_ID_INVERSOR_OK:
-        bus_can_input.inversor_ok = can_obj.Frame.payload_buff[0];
+        shared_input->inversor_ok = frame->payload_buff[0];
+        break;
+
+    /* ------------------------------ Diagnóstico ------------------------------ */
+
+#if USE_RX_TIMING_FEATURE == 1
+    case CAN_ID_CONTROL_DIAG_PETICION:
+        RX_TIMING_Request(frame);
         break;
+#endif /* USE_RX_TIMING_FEATURE */
 
     default:
         break;
     }
+
+    BUSES_Input_Write_End(&ctx->bus_can_input_shared);
+
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+    /* Camino rápido de hombre muerto, fuera de la escritura del bus compartido */
+    if (frame->id == CAN_ID_PERIFERICOS_HOMBRE_MUERTO)
+    {
+        CAN_APP_Deadman_FastPath(ctx, frame->payload_buff[0]);
+    }
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+}
+
+/**
+ * @brief Envío de la trama de un objeto CAN desde la pasada principal.
+ *
+ * Con el camino rápido de hombre muerto la ISR de recepción también transmite: el envío se hace con
+ * interrupciones enmascaradas para que ambos no elijan el mismo mailbox. Todo envío fuera de la ISR debe pasar
+ * por aquí.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param can_obj Objeto CAN de transmisión
+ * @return can_status_t
+ */
+RAMFUNC can_status_t CAN_APP_Send_Message(CAN_t* can_obj)
+{
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+	uint32_t primask = __get_PRIMASK();
+	can_status_t status;
+
+	__disable_irq();
+
+	status = CAN_API_Send_Message(can_obj);
+
+	__set_PRIMASK(primask);
+#else
+	can_status_t status = CAN_API_Send_Message(can_obj);
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+	if (status == CAN_STATUS_OK)
+	{
+		CAN_APP_BUS_LOAD_RECORD(can_obj->Frame.payload_length);
+	}
+
+	return status;
 }
 
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+/**
+ * @brief Función de envío de tramas de camino rápido pendientes.
+ *
+ * Deja en mailbox, en orden, nivel de velocidad y hombre muerto si el camino rápido de hombre muerto los marcó
+ * como pendientes. Las que no caben (mailboxes ocupados) quedan pendientes para la próxima llamada. Se llama
+ * desde la ISR de recepción y al inicio de CAN_APP_Process, con interrupciones enmascaradas durante el envío.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+RAMFUNC void CAN_APP_Send_Priority(app_context_t* ctx)
+{
+	uint32_t primask;
+	uint8_t pending;
+	CAN_t can_obj;
+
+	if (ctx->can_tx_priority == 0)
+	{
+		return;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	/* Objeto propio: no toca la trama que la pasada principal pueda estar armando en ctx->can_obj */
+	can_obj = ctx->can_obj;
+	pending = ctx->can_tx_priority;
+
+	if (pending & CAN_PRIORITY_NIVEL_VELOCIDAD)
+	{
+		can_obj.Frame.id = CAN_ID_CONTROL_NIVEL_VELOCIDAD;
+		can_obj.Frame.payload_length = 1;
+		can_obj.Frame.payload_buff[0] = ctx->bus_can_output.nivel_velocidad;
+		CAN_APP_STAMP_SEQUENCE(ctx, &can_obj.Frame);
+
+		if (CAN_API_Send_Message(&can_obj) == CAN_STATUS_OK)
+		{
+			CAN_APP_BUS_LOAD_RECORD(can_obj.Frame.payload_length);
+			pending &= (uint8_t)~CAN_PRIORITY_NIVEL_VELOCIDAD;
+		}
+	}
+
+	/* Hombre muerto nunca se adelanta al corte de velocidad */
+	if ((pending & CAN_PRIORITY_HOMBRE_MUERTO) && !(pending & CAN_PRIORITY_NIVEL_VELOCIDAD))
+	{
+		can_obj.Frame.id = CAN_ID_CONTROL_HOMBRE_MUERTO;
+		can_obj.Frame.payload_length = 1;
+		can_obj.Frame.payload_buff[0] = ctx->bus_can_output.hombre_muerto;
+		CAN_APP_STAMP_SEQUENCE(ctx, &can_obj.Frame);
+
+		if (CAN_API_Send_Message(&can_obj) == CAN_STATUS_OK)
+		{
+			CAN_APP_BUS_LOAD_RECORD(can_obj.Frame.payload_length);
+			pending &= (uint8_t)~CAN_PRIORITY_HOMBRE_MUERTO;
+		}
+	}
+
+	ctx->can_tx_priority = pending;
+
+	__set_PRIMASK(primask);
+}
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+/**
+ * @brief Agrega el contador de secuencia de su ID a una trama de un byte de dato de Control.
+ *
+ * El contador (8 bits, uno por ID) va en CAN_SEQUENCE_BYTE y avanza con cada intento de envío: una trama que no
+ * entra en mailbox aparece en el receptor como un salto del contador, es decir, como pérdida. Tramas de otro
+ * largo (diagnóstico) o IDs sobre CAN_SEQUENCE_MAX_TX_ID no se modifican. Puede llamarse desde ISRs y desde la
+ * pasada principal (sección crítica con PRIMASK).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param ctx   Contexto de la aplicación (contadores por ID)
+ * @param frame Trama a transmitir (largo 1)
+ * @retval None
+ */
+RAMFUNC void CAN_APP_Stamp_Sequence(app_context_t* ctx, can_frame_t* frame)
+{
+	uint32_t primask;
+
+	if (frame->payload_length != 1 || frame->id > CAN_SEQUENCE_MAX_TX_ID)
+	{
+		return;
+	}
+
+	primask = __get_PRIMASK();
+
+	/* El camino rápido de hombre muerto usa los mismos contadores desde la ISR de recepción */
+	__disable_irq();
+
+	frame->payload_buff[CAN_SEQUENCE_BYTE] = ctx->can_tx_sequence[frame->id]++;
+	frame->payload_length = CAN_SEQUENCE_LENGTH;
+
+	__set_PRIMASK(primask);
+}
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
 /***********************************************************************************************************************
  * Private functions implementation
  **********************************************************************************************************************/
+
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+/**
+ * @brief Camino rápido de hombre muerto, llamado desde la ISR de recepción.
+ *
+ * Al pasar hombre muerto a presionado fuerza a cero el nivel de velocidad del bus de salida CAN y transmite de
+ * inmediato nivel de velocidad y hombre muerto, sin esperar la pasada principal ni el turno de CAN_APP_Send_BusData.
+ * RAMPA_PEDAL_Process mantiene la velocidad en cero mientras la ISR lo vea presionado.
+ *
+ * @param ctx   Contexto de la aplicación
+ * @param value Valor recibido en CAN_ID_PERIFERICOS_HOMBRE_MUERTO
+ * @retval None
+ */
+RAMFUNC static void CAN_APP_Deadman_FastPath(app_context_t* ctx, uint8_t value)
+{
+	if (value == CAN_VALUE_HOMBRE_MUERTO_OFF)
+	{
+		ctx->hombre_muerto_isr = kHOMBRE_MUERTO_OFF;
+		return;
+	}
+
+	/* Solo el flanco: mientras sigue presionado, la trama periódica de periféricos no se vuelve a adelantar */
+	if (value != CAN_VALUE_HOMBRE_MUERTO_ON || ctx->hombre_muerto_isr == kHOMBRE_MUERTO_ON)
+	{
+		return;
+	}
+
+	ctx->hombre_muerto_isr = kHOMBRE_MUERTO_ON;
+
+	ctx->bus_can_output.nivel_velocidad = 0;
+	ctx->bus_can_output.hombre_muerto = CAN_VALUE_HOMBRE_MUERTO_ON;
+
+	ctx->can_tx_priority = CAN_PRIORITY_NIVEL_VELOCIDAD | CAN_PRIORITY_HOMBRE_MUERTO;
+
+	CAN_APP_Send_Priority(ctx);
+}
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+#if USE_CPU_LOAD_FEATURE == 1
+/**
+ * @brief Función de envío de reporte de carga de CPU.
+ *
+ * Envía la trama de estado de carga de CPU solo si el monitor cerró una ventana nueva.
+ *
+ * @param can_obj Objeto CAN de transmisión
+ * @retval None
+ */
+static void CAN_APP_Send_CpuLoad(CAN_t* can_obj)
+{
+	cpu_load_report_t cpu_load_report;
+
+	if (!CPU_LOAD_Get_Report(&cpu_load_report))
+	{
+		return;
+	}
+
+	/* Set up can_obj for message transmission */
+	can_obj->Frame.id = CAN_ID_CONTROL_CARGA_CPU;
+	can_obj->Frame.payload_length = CPU_LOAD_Encode_Frame(&cpu_load_report, can_obj->Frame.payload_buff);
+
+	/* Send message */
+	CAN_APP_Send_Message(can_obj);
+}
+#endif /* USE_CPU_LOAD_FEATURE */
+
+
+#if USE_BUS_LOAD_FEATURE == 1
+/**
+ * @brief Función de envío de reporte de carga del bus CAN.
+ *
+ * Envía la trama de carga del bus solo si el medidor armó un reporte nuevo.
+ *
+ * @param can_obj Objeto CAN de transmisión
+ * @retval None
+ */
+static void CAN_APP_Send_BusLoad(CAN_t* can_obj)
+{
+	bus_load_report_t bus_load_report;
+
+	if (!BUS_LOAD_Get_Report(&bus_load_report))
+	{
+		return;
+	}
+
+	/* Set up can_obj for message transmission */
+	can_obj->Frame.id = CAN_ID_CONTROL_CARGA_BUS;
+	can_obj->Frame.payload_length = BUS_LOAD_Encode_Frame(&bus_load_report, can_obj->Frame.payload_buff);
+
+	/* Send message */
+	CAN_APP_Send_Message(can_obj);
+}
+#endif /* USE_BUS_LOAD_FEATURE */
@@ -14,6 +14,14 @@
  **********************************************************************************************************************/
 
 #include "can_hw.h"
+#include "can_app.h"
+#include "app_rtos.h"
+#include "bus_load.h"
+#include "idle.h"
+#include "ramfunc.h"
+#include "profiler.h"
+#include "rx_timing.h"
+#include "timebase.h"
 
 /***********************************************************************************************************************
  * Private macros
@@ -26,14 +34,32 @@
  * Private variables definitions
  **********************************************************************************************************************/
 
-/** @brief CAN object instance */
-CAN_t can_obj;
+/** @brief Contexto de la aplicación que actualizan las interrupciones */
+static app_context_t* hw_ctx = NULL;
 
-/** @brief Bandera mensaje recibido CAN */
-can_rx_status_t flag_rx_can = CAN_MSG_NOT_RECEIVED;
+/** @brief CAN object instance for reception (used only from the RX interrupt) */
+static CAN_t can_rx_obj;
 
-/** @brief Bandera transmisión CAN */
-can_tx_status_t flag_tx_can = CAN_TX_READY;
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+/** @brief Modo de recepción: lectura por pasada (interrupción de mensaje pendiente enmascarada) */
+static volatile bool rx_polled = false;
+
+/** @brief Tramas recibidas en la ventana de tasa actual */
+static uint32_t rx_window_frames = 0;
+
+/** @brief Inicio de la ventana de tasa actual */
+static uint32_t rx_window_start_us = 0;
+
+/** @brief Tasa desde la que se lee por pasada en tramas/s */
+static uint32_t rx_enter_fps = CAN_HW_RX_POLL_ENTER_FPS;
+
+/** @brief Tasa bajo la que vuelve la interrupción por trama en tramas/s */
+static uint32_t rx_exit_fps = CAN_HW_RX_POLL_EXIT_FPS;
+
+/** @brief Estadísticas de la recepción adaptativa */
+static can_hw_rx_stats_t rx_stats;
+
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
 
 #if SEND_TEST_MESSAGE == 1
 /** @brief ID para prueba comunicación CAN */
@@ -45,22 +71,181 @@ static uint8_t test_msg_id = 0x31;
  * Private functions prototypes
  **********************************************************************************************************************/
 
+static void CAN_HW_Rx_Message(CAN_t* can_obj);
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+static uint32_t CAN_HW_Rx_Drain(CAN_t* can_obj);
+static void CAN_HW_Rx_Rate_Update(uint32_t frames, uint32_t now_us);
+static void CAN_HW_Rx_Set_Polled(bool polled);
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
 /***********************************************************************************************************************
  * Public functions implementation
  **********************************************************************************************************************/
 
-void CAN_HW_Init(void)
+/**
+ * @brief Inicializa CAN para un contexto de la aplicación.
+ *
+ * Inicializa el objeto CAN de transmisión del contexto con el backend seleccionado y registra el contexto
+ * que actualizan las interrupciones de recepción CAN y de TIM7 (hay un único periférico).
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void CAN_HW_Init(app_context_t* ctx)
 {
+	can_status_t status;
+
+	/* Antes de iniciar CAN y TIM7, que ya pueden interrumpir */
+	hw_ctx = ctx;
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+	/* CAN_Wrapper_Init deja activa la interrupción por trama */
+	rx_polled = false;
+	rx_window_frames = 0;
+	rx_window_start_us = TIMEBASE_Get_Us();
+	rx_stats = (can_hw_rx_stats_t){0};
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
 	/* Inicializa CAN usando driver */
-	CAN_API_Init(&can_obj,
+#if USE_SOCKETCAN_BACKEND == 1
+	status = CAN_API_Init(&ctx->can_obj,
+				 STANDARD_FRAME,
+				 NORMAL_MSG,
+				 CAN_SocketCAN_Init,
+				 CAN_SocketCAN_TransmitData,
+				 CAN_SocketCAN_ReceiveData,
+				 CAN_SocketCAN_DataCount);
+#elif USE_CAN_LL_BACKEND == 1
+	status = CAN_API_Init(&ctx->can_obj,
+				 STANDARD_FRAME,
+				 NORMAL_MSG,
+				 CAN_LL_Init,
+				 CAN_LL_TransmitData,
+				 CAN_LL_ReceiveData,
+				 CAN_LL_DataCount);
+#else
+	status = CAN_API_Init(&ctx->can_obj,
 				 STANDARD_FRAME,
 				 NORMAL_MSG,
 				 CAN_Wrapper_Init,
 				 CAN_Wrapper_TransmitData,
 				 CAN_Wrapper_ReceiveData,
 				 CAN_Wrapper_DataCount);
+#endif /* USE_SOCKETCAN_BACKEND */
+
+	if(status != CAN_STATUS_OK)
+	{
+		Error_Handler();
+	}
+
+	/* Reception uses its own frame so the RX interrupt never overwrites a frame being transmitted */
+	can_rx_obj = ctx->can_obj;
+}
+
+/**
+ * @brief Retorna el bitrate del bus configurado en MX_CAN1_Init.
+ *
+ * Tiempo de bit de 1 + BS1 + BS2 cuantos, de Prescaler ciclos de PCLK1 cada uno. Llamar después de CAN_HW_Init.
+ *
+ * @param None
+ * @return uint32_t     Bitrate en bit/s
+ */
+uint32_t CAN_HW_Get_Bitrate(void)
+{
+#if USE_SOCKETCAN_BACKEND == 1
+	return CAN_SOCKETCAN_BITRATE;
+#else
+	uint32_t bs1 = ((hcan1.Init.TimeSeg1 & CAN_BTR_TS1) >> CAN_BTR_TS1_Pos) + 1U;
+	uint32_t bs2 = ((hcan1.Init.TimeSeg2 & CAN_BTR_TS2) >> CAN_BTR_TS2_Pos) + 1U;
+
+	return HAL_RCC_GetPCLK1Freq() / (hcan1.Init.Prescaler * (1U + bs1 + bs2));
+#endif /* USE_SOCKETCAN_BACKEND */
 }
 
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+/**
+ * @brief Lectura de la FIFO 0 al inicio de una pasada de la superloop.
+ *
+ * En modo lectura por pasada guarda las tramas pendientes (a lo más CAN_HW_RX_BUDGET) como la ISR de recepción y
+ * evalúa la tasa de recepción para volver a la interrupción por trama. En modo interrupción no hace nada.
+ *
+ * @param None
+ * @retval None
+ */
+RAMFUNC void CAN_HW_Poll_Rx(void)
+{
+	uint32_t primask;
+	uint32_t now_us;
+	uint32_t frames;
+	CAN_t can_obj;
+
+	if (!rx_polled)
+	{
+		return;
+	}
+
+	now_us = TIMEBASE_Get_Us();
+
+	/* La ISR de FIFO llena también lee la FIFO y actualiza la tasa */
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	/* Objeto propio: no toca la trama de la ISR de recepción */
+	can_obj = can_rx_obj;
+	frames = CAN_HW_Rx_Drain(&can_obj);
+
+	if (frames != 0U)
+	{
+		rx_stats.polls++;
+		rx_stats.poll_frames += frames;
+
+		if (frames > rx_stats.poll_frames_max)
+		{
+			rx_stats.poll_frames_max = frames;
+		}
+	}
+
+	CAN_HW_Rx_Rate_Update(frames, now_us);
+
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Cambia los umbrales de la recepción adaptativa.
+ *
+ * Por defecto CAN_HW_RX_POLL_ENTER_FPS y CAN_HW_RX_POLL_EXIT_FPS; puede llamarse antes de CAN_HW_Init. Con
+ * enter_fps en UINT32_MAX la recepción queda siempre con interrupción por trama; con 0, pasa a lectura por pasada
+ * en la primera ventana.
+ *
+ * @param enter_fps     Tasa desde la que se lee por pasada en tramas/s
+ * @param exit_fps      Tasa bajo la que vuelve la interrupción por trama en tramas/s
+ * @retval None
+ */
+void CAN_HW_Set_Rx_Thresholds(uint32_t enter_fps, uint32_t exit_fps)
+{
+	rx_enter_fps = enter_fps;
+	rx_exit_fps = exit_fps;
+}
+
+/**
+ * @brief Retorna las estadísticas de la recepción adaptativa desde CAN_HW_Init.
+ *
+ * @param stats     Estadísticas a completar
+ * @retval None
+ */
+void CAN_HW_Get_Rx_Stats(can_hw_rx_stats_t* stats)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+
+	*stats = rx_stats;
+	stats->polled = rx_polled;
+
+	__set_PRIMASK(primask);
+}
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
 /***********************************************************************************************************************
  * Exported functions implementation
  **********************************************************************************************************************/
@@ -68,22 +253,52 @@ void CAN_HW_Init(void)
 /*
  * Callback mensaje CAN recibido
  */
-void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef* hcan)
+RAMFUNC void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef* hcan)
 {
-    /* The flag indicates that the callback was called */
-    flag_rx_can = CAN_MSG_RECEIVED;
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+	/* Lee todas las tramas pendientes en la misma interrupción */
+	uint32_t frames = CAN_HW_Rx_Drain(&can_rx_obj);
 
-	/* Get the received message */
-	if(CAN_API_Read_Message(&can_obj) != CAN_STATUS_OK)
+	rx_stats.irqs++;
+	rx_stats.irq_frames += frames;
+
+	if (frames > rx_stats.irq_frames_max)
 	{
-		Error_Handler();
+		rx_stats.irq_frames_max = frames;
 	}
+
+	/* Con la tasa sobre el umbral de entrada enmascara esta interrupción */
+	CAN_HW_Rx_Rate_Update(frames, TIMEBASE_Get_Us());
+#else
+	CAN_HW_Rx_Message(&can_rx_obj);
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+}
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+/*
+ * Callback FIFO 0 llena (solo activa en lectura por pasada)
+ */
+RAMFUNC void HAL_CAN_RxFifo0FullCallback(CAN_HandleTypeDef* hcan)
+{
+	/* Una pasada atrasada: la ISR lee la FIFO antes de que se pierda una trama */
+	uint32_t frames = CAN_HW_Rx_Drain(&can_rx_obj);
+
+	rx_stats.full_irqs++;
+	rx_stats.full_frames += frames;
+
+	CAN_HW_Rx_Rate_Update(frames, TIMEBASE_Get_Us());
+
+#if USE_WFI_IDLE_FEATURE == 1
+	/* Despierta a la superloop para procesar lo leído */
+	IDLE_Set_Pending_FromISR(IDLE_EVENT_CAN_RX);
+#endif /* USE_WFI_IDLE_FEATURE */
 }
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
 
 /*
  * Callback timer trigger de transmisión de datos de bus de salida CAN a módulo CAN
  */
-void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
+RAMFUNC void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 {
 #if SEND_TEST_MESSAGE == 1
 	static int i = 0;
@@ -96,11 +311,11 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 		BSP_LED_Toggle(LED1);
 
 		/* Transmit test message */
-		can_obj.Frame.id = test_msg_id;
-		can_obj.Frame.payload_length = 1;
-		can_obj.Frame.payload_buff[0] = 0x25;
+		hw_ctx->can_obj.Frame.id = test_msg_id;
+		hw_ctx->can_obj.Frame.payload_length = 1;
+		hw_ctx->can_obj.Frame.payload_buff[0] = 0x25;
 
-		if(CAN_API_Send_Message(&can_obj) != CAN_STATUS_OK)
+		if(CAN_API_Send_Message(&hw_ctx->can_obj) != CAN_STATUS_OK)
 		{
 			Error_Handler();
 		}
@@ -108,8 +323,18 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 #else
 	if(htim == &htim7)
 	{
+#if USE_FREERTOS_FEATURE == 1
+		/* Evento de transmisión para la tarea de control */
+		APP_RTOS_Can_Tx_Trigger_FromISR();
+#else
 		/* The flag indicates that the callback was called */
-		flag_tx_can = CAN_TX_READY;
+		hw_ctx->flag_tx_can = CAN_TX_READY;
+
+#if USE_WFI_IDLE_FEATURE == 1
+		/* Despierta a la superloop */
+		IDLE_Set_Pending_FromISR(IDLE_EVENT_CAN_TX);
+#endif /* USE_WFI_IDLE_FEATURE */
+#endif /* USE_FREERTOS_FEATURE */
 	}
 
 #endif /* SEND_TEST_MESSAGE */
@@ -118,3 +343,166 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
 /***********************************************************************************************************************
  * Private functions implementation
  **********************************************************************************************************************/
+
+/**
+ * @brief Lee una trama de la FIFO 0 y la entrega a la aplicación.
+ *
+ * Con FreeRTOS la entrega a la tarea de recepción; en la superloop la guarda en el bus de entrada CAN compartido
+ * y marca el evento de recepción.
+ *
+ * @param can_obj   Objeto CAN de recepción
+ * @retval None
+ */
+RAMFUNC static void CAN_HW_Rx_Message(CAN_t* can_obj)
+{
+	can_status_t status;
+
+	/* Get the received message */
+	PROFILER_MEASURE(kPROFILER_STAGE_CAN_RX, status = CAN_API_Read_Message(can_obj));
+
+	if(status != CAN_STATUS_OK)
+	{
+		Error_Handler();
+	}
+
+#if USE_RX_TIMING_FEATURE == 1
+	/* Marca de llegada para las estadísticas por ID */
+	RX_TIMING_Record(can_obj->Frame.id, TIMEBASE_Get_Us());
+
+	/* Pérdidas y desorden por ID en las tramas que traen contador de secuencia */
+	if (can_obj->Frame.DLC == CAN_SEQUENCE_LENGTH)
+	{
+		RX_TIMING_Record_Sequence(can_obj->Frame.id, can_obj->Frame.payload_buff[CAN_SEQUENCE_BYTE]);
+	}
+#endif /* USE_RX_TIMING_FEATURE */
+
+#if USE_BUS_LOAD_FEATURE == 1
+	/* Bits de la trama recibida para la carga del bus */
+	BUS_LOAD_Record(can_obj->Frame.DLC);
+#endif /* USE_BUS_LOAD_FEATURE */
+
+#if USE_FREERTOS_FEATURE == 1
+	/* La tarea de recepción guarda el mensaje y avisa a la tarea de control */
+	APP_RTOS_Can_Rx_FromISR(&can_obj->Frame);
+#else
+	/* Guarda mensaje CAN recibido en bus de entrada CAN compartido */
+	CAN_APP_Store_ReceivedMessage(hw_ctx, &can_obj->Frame);
+
+    /* The flag indicates that the callback was called */
+    hw_ctx->flag_rx_can = CAN_MSG_RECEIVED;
+
+#if USE_WFI_IDLE_FEATURE == 1 && USE_CAN_RX_COALESCING_FEATURE == 1
+    /* Despierta a la superloop (en lectura por pasada ya está despierta) */
+    if (!rx_polled)
+    {
+        IDLE_Set_Pending_FromISR(IDLE_EVENT_CAN_RX);
+    }
+#elif USE_WFI_IDLE_FEATURE == 1
+    /* Despierta a la superloop */
+    IDLE_Set_Pending_FromISR(IDLE_EVENT_CAN_RX);
+#endif /* USE_WFI_IDLE_FEATURE */
+#endif /* USE_FREERTOS_FEATURE */
+}
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+/**
+ * @brief Lee las tramas pendientes en la FIFO 0, a lo más CAN_HW_RX_BUDGET.
+ *
+ * @param can_obj   Objeto CAN de recepción
+ * @return uint32_t Tramas leídas
+ */
+RAMFUNC static uint32_t CAN_HW_Rx_Drain(CAN_t* can_obj)
+{
+	uint32_t frames = 0;
+
+	while (frames < CAN_HW_RX_BUDGET && HAL_CAN_GetRxFifoFillLevel(&hcan1, CAN_RX_FIFO0) != 0U)
+	{
+		CAN_HW_Rx_Message(can_obj);
+		frames++;
+	}
+
+	return frames;
+}
+
+/**
+ * @brief Cuenta tramas en la ventana de tasa y, al cerrarla, cambia de modo según los umbrales.
+ *
+ * Se llama desde la ISR de recepción o con interrupciones enmascaradas.
+ *
+ * @param frames    Tramas leídas
+ * @param now_us    Instante actual de la base de tiempo
+ * @retval None
+ */
+RAMFUNC static void CAN_HW_Rx_Rate_Update(uint32_t frames, uint32_t now_us)
+{
+	uint32_t elapsed_us = TIMEBASE_ELAPSED_US(rx_window_start_us, now_us);
+	uint32_t rate_fps;
+
+	rx_window_frames += frames;
+
+	if (elapsed_us < CAN_HW_RX_RATE_WINDOW_US)
+	{
+		return;
+	}
+
+	rate_fps = (uint32_t)(((uint64_t)rx_window_frames * 1000000U) / elapsed_us);
+
+	rx_window_frames = 0;
+	rx_window_start_us = now_us;
+	rx_stats.rate_fps = rate_fps;
+
+	if (!rx_polled && rate_fps >= rx_enter_fps)
+	{
+		CAN_HW_Rx_Set_Polled(true);
+	}
+	else if (rx_polled && rate_fps <= rx_exit_fps && rate_fps < rx_enter_fps)
+	{
+		CAN_HW_Rx_Set_Polled(false);
+	}
+}
+
+/**
+ * @brief Cambia entre interrupción por trama y lectura por pasada.
+ *
+ * Se llama desde la ISR de recepción o con interrupciones enmascaradas.
+ *
+ * @param polled    true: lectura por pasada
+ * @retval None
+ */
+static void CAN_HW_Rx_Set_Polled(bool polled)
+{
+	HAL_StatusTypeDef status;
+
+	if (polled)
+	{
+		/* La interrupción de FIFO llena queda como respaldo si una pasada se atrasa */
+		status = HAL_CAN_ActivateNotification(&hcan1, CAN_IT_RX_FIFO0_FULL);
+
+		if (status == HAL_OK)
+		{
+			status = HAL_CAN_DeactivateNotification(&hcan1, CAN_IT_RX_FIFO0_MSG_PENDING);
+		}
+
+		rx_stats.to_polled++;
+	}
+	else
+	{
+		/* Tramas que queden en la FIFO interrumpen apenas se restaure PRIMASK */
+		status = HAL_CAN_ActivateNotification(&hcan1, CAN_IT_RX_FIFO0_MSG_PENDING);
+
+		if (status == HAL_OK)
+		{
+			status = HAL_CAN_DeactivateNotification(&hcan1, CAN_IT_RX_FIFO0_FULL);
+		}
+
+		rx_stats.to_irq++;
+	}
+
+	if (status != HAL_OK)
+	{
+		Error_Handler();
+	}
+
+	rx_polled = polled;
+}
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
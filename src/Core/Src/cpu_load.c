@@ -0,0 +1,420 @@
+/**
+ * @file cpu_load.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Monitor de carga de CPU y jitter de la superloop
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Si la superloop no duerme, el tiempo idle se define como el tiempo de las pasadas sin eventos
+ * pendientes (solo polling) y la carga de cada ventana de un segundo es la fracción del tiempo ocupada
+ * por pasadas con trabajo. Con idle en WFI (idle.c informa el tiempo dormido con CPU_LOAD_Sleep) la
+ * carga es la fracción del tiempo despierto. Este archivo no depende de la HAL: recibe el contador de
+ * ciclos como parámetro, para poder validarlo en host con patrones de carga sintéticos.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "cpu_load.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Máscara de sub-bin de cada octava */
+#define CPU_LOAD_HIST_SUB_MASK              ((1U << CPU_LOAD_HIST_SUB_BITS) - 1U)
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia del contador de ciclos en Hz (largo de ventana) */
+static uint32_t cpu_hz = 1U;
+
+/** @brief Plazo máximo entre pasadas en ciclos */
+static uint32_t deadline_cycles = 0xFFFFFFFFU;
+
+/** @brief Indica si ya se registró la primera pasada */
+static bool started = false;
+
+/** @brief Ciclos al inicio de la pasada anterior */
+static uint32_t last_begin;
+
+/** @brief Indica si la pasada en curso tiene trabajo */
+static bool pass_busy;
+
+/** @brief Ciclos al inicio de la ventana de reporte */
+static uint32_t window_start;
+
+/** @brief Ciclos ocupados en la ventana */
+static uint64_t window_busy;
+
+/** @brief Indica si la superloop duerme en WFI (se informó tiempo dormido) */
+static bool sleep_accounting = false;
+
+/** @brief Ciclos dormidos en la ventana */
+static uint64_t window_sleep;
+
+/** @brief Ciclos dormidos desde el inicio de la pasada anterior */
+static uint32_t pass_sleep;
+
+/** @brief Pasadas en la ventana */
+static uint32_t window_passes;
+
+/** @brief Periodo mínimo en la ventana en ciclos */
+static uint32_t period_min;
+
+/** @brief Periodo máximo en la ventana en ciclos */
+static uint32_t period_max;
+
+/** @brief Histograma de periodo de la ventana */
+static uint32_t period_hist[CPU_LOAD_HIST_BINS];
+
+/** @brief Deadlines perdidos en la ventana */
+static uint32_t missed_window;
+
+/** @brief Deadlines perdidos desde el inicio */
+static uint32_t missed_total;
+
+/** @brief Último reporte */
+static cpu_load_report_t report_last;
+
+/** @brief Indica si hay reporte nuevo */
+static bool report_ready = false;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void CPU_LOAD_Close_Window(uint32_t now_cycles);
+static void CPU_LOAD_Reset_Window(uint32_t now_cycles);
+static uint32_t CPU_LOAD_Cycles_To_Us(uint32_t cycles);
+static void CPU_LOAD_Put_U16(uint8_t* buff, uint32_t value);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa el monitor de carga de CPU.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param hz            Frecuencia del contador de ciclos en Hz (largo de la ventana de reporte)
+ * @param deadline_us   Plazo máximo entre dos pasadas de la superloop en us
+ * @retval None
+ */
+void CPU_LOAD_Init(uint32_t hz, uint32_t deadline_us)
+{
+    cpu_hz = (hz != 0U) ? hz : 1U;
+    deadline_cycles = (uint32_t)(((uint64_t)cpu_hz * deadline_us) / 1000000U);
+
+    started = false;
+    sleep_accounting = false;
+    pass_sleep = 0;
+    report_ready = false;
+    missed_total = 0;
+
+    memset(&report_last, 0, sizeof(report_last));
+
+    CPU_LOAD_Reset_Window(0);
+}
+
+/**
+ * @brief Marca el inicio de una pasada de la superloop.
+ *
+ * Registra el periodo desde la pasada anterior y cierra la ventana de reporte al cumplirse un segundo.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @param busy          true si la pasada tiene trabajo pendiente (evento CAN RX/TX), false si solo hace polling
+ * @retval None
+ */
+void CPU_LOAD_Pass_Begin(uint32_t now_cycles, bool busy)
+{
+    uint32_t period;
+    uint32_t awake;
+
+    pass_busy = busy;
+
+    /* Primera pasada: solo referencia de tiempo */
+    if (!started)
+    {
+        started = true;
+        last_begin = now_cycles;
+        pass_sleep = 0;
+
+        CPU_LOAD_Reset_Window(now_cycles);
+
+        return;
+    }
+
+    period = now_cycles - last_begin;
+    last_begin = now_cycles;
+    awake = period - pass_sleep;
+    pass_sleep = 0;
+
+    if (window_passes == 0 || period < period_min)
+    {
+        period_min = period;
+    }
+
+    if (period > period_max)
+    {
+        period_max = period;
+    }
+
+    window_passes++;
+    period_hist[CPU_LOAD_Hist_Bin(period)]++;
+
+    /* Sin WFI pass_sleep es 0 y el tiempo despierto es el periodo */
+    if (awake > deadline_cycles)
+    {
+        missed_window++;
+        missed_total++;
+    }
+
+    /* Cierra ventana de un segundo */
+    if ((now_cycles - window_start) >= cpu_hz)
+    {
+        CPU_LOAD_Close_Window(now_cycles);
+    }
+}
+
+/**
+ * @brief Marca el fin de una pasada de la superloop.
+ *
+ * Si la pasada tenía trabajo, su duración se acumula como tiempo ocupado; si no, como tiempo idle.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @retval None
+ */
+void CPU_LOAD_Pass_End(uint32_t now_cycles)
+{
+    if (started && pass_busy)
+    {
+        window_busy += now_cycles - last_begin;
+    }
+}
+
+/**
+ * @brief Acumula tiempo dormido en WFI (idle.c).
+ *
+ * Desde la primera llamada la carga de cada ventana es la fracción del tiempo despierto, y el deadline se
+ * evalúa sobre el tiempo despierto entre pasadas (dormir esperando trabajo no es un deadline perdido).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param cycles        Ciclos dormidos
+ * @retval None
+ */
+void CPU_LOAD_Sleep(uint32_t cycles)
+{
+    sleep_accounting = true;
+
+    window_sleep += cycles;
+    pass_sleep += cycles;
+}
+
+/**
+ * @brief Retorna si hay un reporte nuevo desde la última llamada (y lo marca como leído).
+ *
+ * @param report        Reporte a completar
+ * @retval true         Hay reporte nuevo
+ * @retval false        No hay reporte nuevo
+ */
+bool CPU_LOAD_Get_Report(cpu_load_report_t* report)
+{
+    if (!report_ready)
+    {
+        return false;
+    }
+
+    *report = report_last;
+    report_ready = false;
+
+    return true;
+}
+
+/**
+ * @brief Retorna el bin del histograma de periodo que corresponde a una duración en ciclos.
+ *
+ * Escala log-lineal: cada octava se divide en 2^CPU_LOAD_HIST_SUB_BITS bins iguales.
+ *
+ * @param cycles        Duración en ciclos
+ * @return uint8_t      Índice de bin [0:CPU_LOAD_HIST_BINS-1]
+ */
+uint8_t CPU_LOAD_Hist_Bin(uint32_t cycles)
+{
+    uint32_t octave;
+    uint32_t sub;
+    uint32_t bin;
+
+    if (cycles < (1UL << CPU_LOAD_HIST_MIN_LOG2))
+    {
+        return 0;
+    }
+
+    octave = 31U - (uint32_t)__builtin_clz(cycles);
+    sub = (cycles >> (octave - CPU_LOAD_HIST_SUB_BITS)) & CPU_LOAD_HIST_SUB_MASK;
+    bin = ((octave - CPU_LOAD_HIST_MIN_LOG2) << CPU_LOAD_HIST_SUB_BITS) + sub;
+
+    if (bin > CPU_LOAD_HIST_BINS - 1)
+    {
+        bin = CPU_LOAD_HIST_BINS - 1;
+    }
+
+    return (uint8_t)bin;
+}
+
+/**
+ * @brief Retorna el límite superior (exclusivo) en ciclos de un bin del histograma de periodo.
+ *
+ * @param bin           Índice de bin
+ * @return uint32_t     Límite superior en ciclos
+ */
+uint32_t CPU_LOAD_Hist_Bin_Upper(uint8_t bin)
+{
+    uint32_t octave = CPU_LOAD_HIST_MIN_LOG2 + ((uint32_t)bin >> CPU_LOAD_HIST_SUB_BITS);
+    uint32_t sub = (uint32_t)bin & CPU_LOAD_HIST_SUB_MASK;
+
+    return ((1UL << CPU_LOAD_HIST_SUB_BITS) + sub + 1U) << (octave - CPU_LOAD_HIST_SUB_BITS);
+}
+
+/**
+ * @brief Codifica un reporte en la trama de estado de carga de CPU.
+ *
+ * Formato (little-endian): byte 0 carga %, bytes 1-2 periodo mínimo us, bytes 3-4 periodo máximo us,
+ * bytes 5-6 periodo p99 us, byte 7 deadlines perdidos en la ventana. Campos saturados.
+ *
+ * @param report        Reporte a codificar
+ * @param payload       Buffer de CPU_LOAD_FRAME_LENGTH bytes
+ * @return uint8_t      Largo de la trama
+ */
+uint8_t CPU_LOAD_Encode_Frame(const cpu_load_report_t* report, uint8_t* payload)
+{
+    payload[0] = report->load_pct;
+
+    CPU_LOAD_Put_U16(&payload[1], report->period_min_us);
+    CPU_LOAD_Put_U16(&payload[3], report->period_max_us);
+    CPU_LOAD_Put_U16(&payload[5], report->period_p99_us);
+
+    payload[7] = (report->missed_deadlines > UINT8_MAX) ? UINT8_MAX : (uint8_t)report->missed_deadlines;
+
+    return CPU_LOAD_FRAME_LENGTH;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Cierra la ventana de reporte: calcula carga y percentil 99, y reinicia la ventana.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @retval None
+ */
+static void CPU_LOAD_Close_Window(uint32_t now_cycles)
+{
+    uint32_t elapsed = now_cycles - window_start;
+    uint32_t target = (uint32_t)(((uint64_t)window_passes * 99U + 99U) / 100U);
+    uint32_t cumulative = 0;
+    uint32_t p99 = period_max;
+    uint32_t load;
+
+    /* Percentil 99: límite superior del bin que lo contiene, acotado por el máximo */
+    for (uint8_t bin = 0; bin < CPU_LOAD_HIST_BINS - 1; bin++)
+    {
+        cumulative += period_hist[bin];
+
+        if (cumulative >= target)
+        {
+            uint32_t upper = CPU_LOAD_Hist_Bin_Upper(bin);
+
+            p99 = (upper < period_max) ? upper : period_max;
+
+            break;
+        }
+    }
+
+    if (sleep_accounting)
+    {
+        uint64_t awake = (window_sleep < elapsed) ? elapsed - window_sleep : 0U;
+
+        load = (uint32_t)((awake * 100U + elapsed / 2U) / elapsed);
+    }
+    else
+    {
+        load = (uint32_t)((window_busy * 100U + elapsed / 2U) / elapsed);
+    }
+
+    report_last.load_pct = (load > 100U) ? 100U : (uint8_t)load;
+    report_last.passes = window_passes;
+    report_last.period_min_us = CPU_LOAD_Cycles_To_Us(period_min);
+    report_last.period_max_us = CPU_LOAD_Cycles_To_Us(period_max);
+    report_last.period_p99_us = CPU_LOAD_Cycles_To_Us(p99);
+    report_last.missed_deadlines = missed_window;
+    report_last.missed_deadlines_total = missed_total;
+
+    report_ready = true;
+
+    CPU_LOAD_Reset_Window(now_cycles);
+}
+
+/**
+ * @brief Reinicia acumuladores de la ventana de reporte.
+ *
+ * @param now_cycles    Valor actual del contador de ciclos
+ * @retval None
+ */
+static void CPU_LOAD_Reset_Window(uint32_t now_cycles)
+{
+    window_start = now_cycles;
+    window_busy = 0;
+    window_sleep = 0;
+    window_passes = 0;
+    period_min = 0;
+    period_max = 0;
+    missed_window = 0;
+
+    memset(period_hist, 0, sizeof(period_hist));
+}
+
+/**
+ * @brief Convierte ciclos a us.
+ *
+ * @param cycles        Ciclos
+ * @return uint32_t     Microsegundos
+ */
+static uint32_t CPU_LOAD_Cycles_To_Us(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / cpu_hz);
+}
+
+/**
+ * @brief Escribe un valor de 16 bits little-endian, saturado a UINT16_MAX.
+ *
+ * @param buff          Buffer destino (2 bytes)
+ * @param value         Valor a escribir
+ * @retval None
+ */
+static void CPU_LOAD_Put_U16(uint8_t* buff, uint32_t value)
+{
+    if (value > UINT16_MAX)
+    {
+        value = UINT16_MAX;
+    }
+
+    buff[0] = (uint8_t)(value & 0xFF);
+    buff[1] = (uint8_t)(value >> 8);
+}
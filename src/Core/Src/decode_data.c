@@ -15,36 +15,20 @@
 
 #include "decode_data.h"
 
-/***********************************************************************************************************************
- * Private variables definitions
- **********************************************************************************************************************/
-
-/** @brief Bandera para ejecutar bloque de decodificación de datos */
-decode_status_t flag_decodificar = NO_DECODIFICA;
-
-/* Puntero a estructura de tipo rx_peripherals_vars_t que contiene los valores de las variables decodificadas de Periféricos */
-static rx_peripherals_vars_t* Rx_Peripherals = &bus_data.Rx_Peripherals;
-
-/* Puntero a estructura de tipo rx_bms_vars_t que contiene los valores de las variables decodificadas de BMS */
-static rx_bms_vars_t* Rx_Bms = &bus_data.Rx_Bms;
-
-/* Puntero a estructura de tipo rx_dcdc_vars_t que contiene los valores de las variables decodificadas de DCDC */
-static rx_dcdc_vars_t* Rx_Dcdc = &bus_data.Rx_Dcdc;
-
-/* Puntero a estructura de tipo rx_inversor_vars_t que contiene los valores de las variables decodificadas de Inversor */
-static rx_inversor_vars_t* Rx_Inversor = &bus_data.Rx_Inversor;
+/* Application includes */
+#include "ramfunc.h"
 
 /***********************************************************************************************************************
  * Private functions prototypes
  **********************************************************************************************************************/
 
-static void DECODE_DATA_Decode_Bms(void);
+static void DECODE_DATA_Decode_Bms(app_context_t* ctx);
 
-static void DECODE_DATA_Decode_Dcdc(void);
+static void DECODE_DATA_Decode_Dcdc(app_context_t* ctx);
 
-static void DECODE_DATA_Decode_Inversor(void);
+static void DECODE_DATA_Decode_Inversor(app_context_t* ctx);
 
-static void DECODE_DATA_Decode_Perifericos(void);
+static void DECODE_DATA_Decode_Perifericos(app_context_t* ctx);
 
 /***********************************************************************************************************************
  * Public functions implementation
@@ -59,19 +43,22 @@ static void DECODE_DATA_Decode_Perifericos(void);
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void DECODE_DATA_Process(void)
+RAMFUNC void DECODE_DATA_Process(app_context_t* ctx)
 {
-    if (flag_decodificar == DECODIFICA)
+    if (ctx->flag_decodificar == DECODIFICA)
     {
-    	DECODE_DATA_Decode_Bms();
-        DECODE_DATA_Decode_Dcdc();
-    	DECODE_DATA_Decode_Inversor();
-        DECODE_DATA_Decode_Perifericos();
+    	DECODE_DATA_Decode_Bms(ctx);
+        DECODE_DATA_Decode_Dcdc(ctx);
+    	DECODE_DATA_Decode_Inversor(ctx);
+        DECODE_DATA_Decode_Perifericos(ctx);
 
-        flag_decodificar = NO_DECODIFICA;
+        ctx->flag_decodificar = NO_DECODIFICA;
+
+        /* Muestra nueva para las ventanas de persistencia de fallas */
+        ctx->failures_sample = true;
     }
 }
 
@@ -86,11 +73,15 @@ void DECODE_DATA_Process(void)
  * los datos en la estructura Rx_Bms del tipo rx_bms_vars_t y que
  * se encuentra en el bus_data.
  *
+ * @param ctx Contexto de la aplicación
  */
-static void DECODE_DATA_Decode_Bms(void)
+RAMFUNC static void DECODE_DATA_Decode_Bms(app_context_t* ctx)
 {
+    rx_bms_vars_t* Rx_Bms = &ctx->bus_data.Rx_Bms;
+    const typedef_bus3_t* bus_can_input = &ctx->bus_can_input;
+
     /* Decodifica info de BMS */
-    switch (bus_can_input.bms_ok)
+    switch (bus_can_input->bms_ok)
     {
     case CAN_VALUE_MODULE_OK:
     	Rx_Bms->bms_ok = kMODULE_INFO_OK;
@@ -101,12 +92,12 @@ static void DECODE_DATA_Decode_Bms(void)
     }
 
     /* Decodifica las variables analógicas de BMS */
-    Rx_Bms->voltaje = (rx_var_t)bus_can_input.voltaje_bms / 2.0;
-    Rx_Bms->corriente = (rx_var_t)bus_can_input.corriente_bms;
-    Rx_Bms->voltaje_min_celda = (rx_var_t)bus_can_input.voltaje_min_celda_bms / 50.0;
-    Rx_Bms->potencia = (rx_var_t)bus_can_input.potencia_bms * 10.0;
-    Rx_Bms->t_max = (rx_var_t)bus_can_input.t_max_bms;
-    Rx_Bms->nivel_bateria = (rx_var_t)bus_can_input.nivel_bateria_bms / 2.0;
+    Rx_Bms->voltaje = (rx_var_t)bus_can_input->voltaje_bms / 2.0;
+    Rx_Bms->corriente = (rx_var_t)bus_can_input->corriente_bms;
+    Rx_Bms->voltaje_min_celda = (rx_var_t)bus_can_input->voltaje_min_celda_bms / 50.0;
+    Rx_Bms->potencia = (rx_var_t)bus_can_input->potencia_bms * 10.0;
+    Rx_Bms->t_max = (rx_var_t)bus_can_input->t_max_bms;
+    Rx_Bms->nivel_bateria = (rx_var_t)bus_can_input->nivel_bateria_bms / 2.0;
 }
 
 /**
@@ -116,11 +107,15 @@ static void DECODE_DATA_Decode_Bms(void)
  * los datos en la estructura Rx_Dcdc del tipo rx_dcdc_vars_t y que
  * se encuentra en el bus_data.
  *
+ * @param ctx Contexto de la aplicación
  */
-static void DECODE_DATA_Decode_Dcdc(void)
+RAMFUNC static void DECODE_DATA_Decode_Dcdc(app_context_t* ctx)
 {
+    rx_dcdc_vars_t* Rx_Dcdc = &ctx->bus_data.Rx_Dcdc;
+    const typedef_bus3_t* bus_can_input = &ctx->bus_can_input;
+
     /* Decodifica info de DCDC */
-    switch (bus_can_input.dcdc_ok)
+    switch (bus_can_input->dcdc_ok)
     {
     case CAN_VALUE_MODULE_OK:
     	Rx_Dcdc->dcdc_ok = kMODULE_INFO_OK;
@@ -131,10 +126,10 @@ static void DECODE_DATA_Decode_Dcdc(void)
     }
 
     /* Decodifica las variables analógicas de DCDC */
-    Rx_Dcdc->voltaje_bateria = (rx_var_t)bus_can_input.voltaje_bateria_dcdc;
-    Rx_Dcdc->voltaje_salida = (rx_var_t)bus_can_input.voltaje_salida_dcdc;
-    Rx_Dcdc->t_max = (rx_var_t)bus_can_input.t_max_dcdc;
-    Rx_Dcdc->potencia = (rx_var_t)bus_can_input.potencia_dcdc;
+    Rx_Dcdc->voltaje_bateria = (rx_var_t)bus_can_input->voltaje_bateria_dcdc;
+    Rx_Dcdc->voltaje_salida = (rx_var_t)bus_can_input->voltaje_salida_dcdc;
+    Rx_Dcdc->t_max = (rx_var_t)bus_can_input->t_max_dcdc;
+    Rx_Dcdc->potencia = (rx_var_t)bus_can_input->potencia_dcdc;
 }
 
 /**
@@ -144,11 +139,15 @@ static void DECODE_DATA_Decode_Dcdc(void)
  * los datos en la estructura Rx_Inversor del tipo rx_inversor_vars_t y
  * que se encuentra en el bus_data.
  *
+ * @param ctx Contexto de la aplicación
  */
-static void DECODE_DATA_Decode_Inversor(void)
+RAMFUNC static void DECODE_DATA_Decode_Inversor(app_context_t* ctx)
 {
+    rx_inversor_vars_t* Rx_Inversor = &ctx->bus_data.Rx_Inversor;
+    const typedef_bus3_t* bus_can_input = &ctx->bus_can_input;
+
     /* Decodifica info de Inversor */
-    switch (bus_can_input.inversor_ok)
+    switch (bus_can_input->inversor_ok)
     {
     case CAN_VALUE_MODULE_OK:
     	Rx_Inversor->inversor_ok = kMODULE_INFO_OK;
@@ -159,18 +158,21 @@ static void DECODE_DATA_Decode_Inversor(void)
     }
 
 	/* Decodifica las variables analógicas de Inversor */
-    Rx_Inversor->velocidad = (rx_var_t)bus_can_input.velocidad_inv;
-    Rx_Inversor->V = (rx_var_t)bus_can_input.V_inv;
-    Rx_Inversor->I = (rx_var_t)bus_can_input.I_inv;
-    Rx_Inversor->temp_max = (rx_var_t)bus_can_input.temp_max_inv;
-    Rx_Inversor->temp_motor = (rx_var_t)bus_can_input.temp_motor_inv;
-    Rx_Inversor->potencia = (rx_var_t)bus_can_input.potencia_inv;
+    Rx_Inversor->velocidad = (rx_var_t)bus_can_input->velocidad_inv;
+    Rx_Inversor->V = (rx_var_t)bus_can_input->V_inv;
+    Rx_Inversor->I = (rx_var_t)bus_can_input->I_inv;
+    Rx_Inversor->temp_max = (rx_var_t)bus_can_input->temp_max_inv;
+    Rx_Inversor->temp_motor = (rx_var_t)bus_can_input->temp_motor_inv;
+    Rx_Inversor->potencia = (rx_var_t)bus_can_input->potencia_inv;
 }
 
-static void DECODE_DATA_Decode_Perifericos(void)
+RAMFUNC static void DECODE_DATA_Decode_Perifericos(app_context_t* ctx)
 {
+    rx_peripherals_vars_t* Rx_Peripherals = &ctx->bus_data.Rx_Peripherals;
+    const typedef_bus3_t* bus_can_input = &ctx->bus_can_input;
+
     /* Decodifica info de Perifericos */
-    switch (bus_can_input.perifericos_ok)
+    switch (bus_can_input->perifericos_ok)
     {
     case CAN_VALUE_MODULE_OK:
         Rx_Peripherals->perifericos_ok = kMODULE_INFO_OK;
@@ -181,7 +183,7 @@ static void DECODE_DATA_Decode_Perifericos(void)
     }
 
 	/* Decodifica botones de modos de manejo */
-    switch (bus_can_input.botones_cambio_estado)
+    switch (bus_can_input->botones_cambio_estado)
     {
     case CAN_VALUE_BTN_NONE:
     	Rx_Peripherals->botones_cambio_estado = kBTN_NONE;
@@ -198,7 +200,7 @@ static void DECODE_DATA_Decode_Perifericos(void)
     }
 
     /* Decodifica estado de hombre muerto */
-    switch (bus_can_input.hombre_muerto)
+    switch (bus_can_input->hombre_muerto)
     {
     case CAN_VALUE_HOMBRE_MUERTO_ON:
         Rx_Peripherals->hombre_muerto = kHOMBRE_MUERTO_ON;
@@ -208,5 +210,8 @@ static void DECODE_DATA_Decode_Perifericos(void)
     }
 
     /* Decodifica las variables analógicas de Periféricos */
-    Rx_Peripherals->pedal = (rx_var_t)bus_can_input.pedal;
+    Rx_Peripherals->pedal = (rx_var_t)bus_can_input->pedal;
+
+    /* Marca de tiempo de llegada de la muestra de pedal */
+    ctx->bus_data.pedal_timestamp = bus_can_input->pedal_timestamp;
 }
@@ -32,17 +32,11 @@ enum DrivingModes_States
     kSPORT     /**< Estado modo de manejo SPORT */
 };
 
-/** @brief Estado de la máquina de estados */
-static uint8_t driving_modes_state = kINIT;
-
-/** @brief Puntero a estructura de tipo rx_peripherals_vars_t que contiene los valores de las variables decodificadas de periféricos */
-static rx_peripherals_vars_t* Rx_Peripherals = &bus_data.Rx_Peripherals;
-
 /***********************************************************************************************************************
  * Private functions prototypes
  **********************************************************************************************************************/
 
-static void DRIVING_MODES_StateMachine(void);
+static void DRIVING_MODES_StateMachine(app_context_t* ctx);
 
 static void DRIVING_MODES_Send_DrivingMode(driving_mode_t to_send, typedef_bus2_t* bus_can_output);
 
@@ -50,6 +44,17 @@ static void DRIVING_MODES_Send_DrivingMode(driving_mode_t to_send, typedef_bus2_
  * Public functions implementation
  **********************************************************************************************************************/
 
+/**
+ * @brief Inicializa el estado de la máquina de modos de manejo de un contexto.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void DRIVING_MODES_Init(app_context_t* ctx)
+{
+    ctx->driving_modes_state = kINIT;
+}
+
 /**
  * @brief Función principal máquina de modos de manejo.
  *
@@ -57,12 +62,12 @@ static void DRIVING_MODES_Send_DrivingMode(driving_mode_t to_send, typedef_bus2_
  * 
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void DRIVING_MODES_Process(void)
+void DRIVING_MODES_Process(app_context_t* ctx)
 {
-    DRIVING_MODES_StateMachine();
+    DRIVING_MODES_StateMachine(ctx);
 }
 
 /***********************************************************************************************************************
@@ -79,77 +84,81 @@ void DRIVING_MODES_Process(void)
  * de periféricos, es decir, la estructura de tipo rx_peripherals_vars_t que se encuentra
  * en el bus_data.
  *
+ * @param ctx Contexto de la aplicación
  */
-static void DRIVING_MODES_StateMachine(void)
+static void DRIVING_MODES_StateMachine(app_context_t* ctx)
 {
-    switch (driving_modes_state)
+    typedef_bus1_t* bus_data = &ctx->bus_data;
+    const rx_peripherals_vars_t* Rx_Peripherals = &ctx->bus_data.Rx_Peripherals;
+
+    switch (ctx->driving_modes_state)
     {
     case kINIT:
-        if (bus_data.driving_mode == kDRIVING_MODE_ECO)
+        if (bus_data->driving_mode == kDRIVING_MODE_ECO)
         {
-            driving_modes_state = kECO;
+            ctx->driving_modes_state = kECO;
         }
-        else if(bus_data.driving_mode == kDRIVING_MODE_NORMAL)
+        else if(bus_data->driving_mode == kDRIVING_MODE_NORMAL)
         {
-            driving_modes_state = kNORMAL;
+            ctx->driving_modes_state = kNORMAL;
         }
-        else if(bus_data.driving_mode == kDRIVING_MODE_SPORT)
+        else if(bus_data->driving_mode == kDRIVING_MODE_SPORT)
         {
-            driving_modes_state = kSPORT;
+            ctx->driving_modes_state = kSPORT;
         }
         break;
 
     case kECO:
 
         /* Actualiza modo de manejo a ECO en bus de datos */
-        bus_data.driving_mode = kDRIVING_MODE_ECO;
+        bus_data->driving_mode = kDRIVING_MODE_ECO;
 
         /* Actualiza modo de manejo a ECO en bus de salida CAN */
-        DRIVING_MODES_Send_DrivingMode(bus_data.driving_mode, &bus_can_output);
+        DRIVING_MODES_Send_DrivingMode(bus_data->driving_mode, &ctx->bus_can_output);
 
-        if (Rx_Peripherals->botones_cambio_estado == kBTN_NORMAL && (bus_data.failure == kFAILURE_OK || bus_data.failure == kFAILURE_CAUTION1))
+        if (Rx_Peripherals->botones_cambio_estado == kBTN_NORMAL && (bus_data->failure == kFAILURE_OK || bus_data->failure == kFAILURE_CAUTION1))
         {
-            driving_modes_state = kNORMAL;
+            ctx->driving_modes_state = kNORMAL;
         }
-        else if (Rx_Peripherals->botones_cambio_estado == kBTN_SPORT && bus_data.failure == kFAILURE_OK)
+        else if (Rx_Peripherals->botones_cambio_estado == kBTN_SPORT && bus_data->failure == kFAILURE_OK)
         {
-            driving_modes_state = kSPORT;
+            ctx->driving_modes_state = kSPORT;
         }
         break;
 
     case kNORMAL:
 
         /* Actualiza modo de manejo a NORMAL en bus de datos */
-        bus_data.driving_mode = kDRIVING_MODE_NORMAL;
+        bus_data->driving_mode = kDRIVING_MODE_NORMAL;
 
         /* Actualiza modo de manejo a NORMAL en bus de salida CAN */
-        DRIVING_MODES_Send_DrivingMode(bus_data.driving_mode, &bus_can_output);
+        DRIVING_MODES_Send_DrivingMode(bus_data->driving_mode, &ctx->bus_can_output);
 
-        if (Rx_Peripherals->botones_cambio_estado == kBTN_ECO || bus_data.failure == kFAILURE_CAUTION2)
+        if (Rx_Peripherals->botones_cambio_estado == kBTN_ECO || bus_data->failure == kFAILURE_CAUTION2)
         {
-            driving_modes_state = kECO;
+            ctx->driving_modes_state = kECO;
         }
-        else if (Rx_Peripherals->botones_cambio_estado == kBTN_SPORT && bus_data.failure == kFAILURE_OK)
+        else if (Rx_Peripherals->botones_cambio_estado == kBTN_SPORT && bus_data->failure == kFAILURE_OK)
         {
-            driving_modes_state = kSPORT;
+            ctx->driving_modes_state = kSPORT;
         }
         break;
 
     case kSPORT:
 
         /* Actualiza modo de manejo a SPORT en bus de datos */
-        bus_data.driving_mode = kDRIVING_MODE_SPORT;
+        bus_data->driving_mode = kDRIVING_MODE_SPORT;
 
         /* Actualiza modo de manejo a SPORT en bus de salida CAN */
-        DRIVING_MODES_Send_DrivingMode(bus_data.driving_mode, &bus_can_output);
+        DRIVING_MODES_Send_DrivingMode(bus_data->driving_mode, &ctx->bus_can_output);
 
-        if (Rx_Peripherals->botones_cambio_estado == kBTN_ECO || bus_data.failure == kFAILURE_CAUTION2)
+        if (Rx_Peripherals->botones_cambio_estado == kBTN_ECO || bus_data->failure == kFAILURE_CAUTION2)
         {
-            driving_modes_state = kECO;
+            ctx->driving_modes_state = kECO;
         }
-        else if (Rx_Peripherals->botones_cambio_estado == kBTN_NORMAL || bus_data.failure == kFAILURE_CAUTION1)
+        else if (Rx_Peripherals->botones_cambio_estado == kBTN_NORMAL || bus_data->failure == kFAILURE_CAUTION1)
         {
-            driving_modes_state = kNORMAL;
+            ctx->driving_modes_state = kNORMAL;
         }
         break;
 
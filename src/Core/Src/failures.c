@@ -15,6 +15,9 @@
 
 #include "failures.h"
 
+/* C includes */
+#include <string.h>
+
 /***********************************************************************************************************************
  * Private macros
  **********************************************************************************************************************/
@@ -35,14 +38,11 @@ enum FailuresStates
     kAUTOKILL  /**< Estado falla AUTOKILL */
 };
 
-/** @brief Estado de la máquina de estados */
-static uint8_t failures_state = kCAUTION1;
-
 /***********************************************************************************************************************
  * Private functions prototypes
  **********************************************************************************************************************/
 
-static void FAILURES_StateMachine(void);
+static void FAILURES_StateMachine(app_context_t* ctx);
 
 static void FAILURES_Send_Failure(failure_t to_send, typedef_bus2_t* bus_can_output);
 
@@ -50,12 +50,34 @@ static void FAILURES_Send_ControlInfo(module_info_t to_send, typedef_bus2_t* bus
 
 static void FAILURES_Send_Autokill(typedef_bus2_t* bus_can_output);
 
-static bool FAILURES_Is_Autokill(void);
+static bool FAILURES_Is_Autokill(const typedef_bus1_t* bus_data);
+
+static bool FAILURES_Is_Critical(const typedef_bus1_t* bus_data);
+
+static int FAILURES_Count_ProblemModules(const typedef_bus1_t* bus_data);
+
+static const failures_persistence_t* FAILURES_Get_Window(app_context_t* ctx, uint8_t next_state);
+
+static void FAILURES_Filter_Transition(app_context_t* ctx, uint8_t next_state);
 
 /***********************************************************************************************************************
  * Public functions implementation
  **********************************************************************************************************************/
 
+/**
+ * @brief Inicializa el estado de la máquina de fallas de un contexto.
+ *
+ * @param ctx Contexto de la aplicación
+ * @retval None
+ */
+void FAILURES_Init(app_context_t* ctx)
+{
+    ctx->failures_state = kCAUTION1;
+    ctx->failures_sample = false;
+
+    memset(&ctx->failures_filter, 0, sizeof(ctx->failures_filter));
+}
+
 /**
  * @brief Función principal máquina de fallas.
  *
@@ -66,12 +88,12 @@ static bool FAILURES_Is_Autokill(void);
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void FAILURES_Process(void)
+void FAILURES_Process(app_context_t* ctx)
 {
-    FAILURES_StateMachine();
+    FAILURES_StateMachine(ctx);
 }
 
 /***********************************************************************************************************************
@@ -87,6 +109,9 @@ void FAILURES_Process(void)
  * DCDC e inversor y conforme a ello realiza las transiciones entre las diferentes fallas
  * posibles: OK, CAUTION1, CAUTION2, y AUTOKILL.
  *
+ * Cada transición se filtra por persistencia (ver FAILURES_Filter_Transition), de modo que una
+ * observación aislada de bus_data no provoca cambio de falla.
+ *
  * Lee las variables bms_status, dcdc_status e inversor_status del bus_data.
  *
  * Escribe en la variable failure del bus_data.
@@ -95,121 +120,260 @@ void FAILURES_Process(void)
  *
  * Escribe en la variable autokill del bus_can_output.
  *
+ * @param ctx Contexto de la aplicación
  */
-static void FAILURES_StateMachine(void)
+static void FAILURES_StateMachine(app_context_t* ctx)
 {
-    switch (failures_state)
+    typedef_bus1_t* bus_data = &ctx->bus_data;
+
+    /* Estado destino según las condiciones observadas en esta evaluación */
+    uint8_t next_state = ctx->failures_state;
+
+    switch (ctx->failures_state)
     {
     case kOK:
 
         /* Actualiza falla a OK en bus de datos */
-        bus_data.failure = kFAILURE_OK;
+        bus_data->failure = kFAILURE_OK;
 
         /* Actualiza falla a OK en bus de salida CAN */
-        FAILURES_Send_Failure(bus_data.failure, &bus_can_output);
+        FAILURES_Send_Failure(bus_data->failure, &ctx->bus_can_output);
 
-        if (FAILURES_Is_Autokill()) 
+        if (FAILURES_Is_Autokill(bus_data)) 
         {
-            failures_state = kAUTOKILL;
+            next_state = kAUTOKILL;
         }
-        else if (bus_data.bms_status == kMODULE_STATUS_PROBLEM
-            || bus_data.dcdc_status == kMODULE_STATUS_PROBLEM
-            || bus_data.inversor_status == kMODULE_STATUS_PROBLEM)
+        else if (bus_data->bms_status == kMODULE_STATUS_PROBLEM
+            || bus_data->dcdc_status == kMODULE_STATUS_PROBLEM
+            || bus_data->inversor_status == kMODULE_STATUS_PROBLEM)
         {
-            failures_state = kCAUTION2;
+            next_state = kCAUTION2;
         }
-        else if (bus_data.bms_status == kMODULE_STATUS_REGULAR
-            || bus_data.dcdc_status == kMODULE_STATUS_REGULAR
-            || bus_data.inversor_status == kMODULE_STATUS_REGULAR)
+        else if (bus_data->bms_status == kMODULE_STATUS_REGULAR
+            || bus_data->dcdc_status == kMODULE_STATUS_REGULAR
+            || bus_data->inversor_status == kMODULE_STATUS_REGULAR)
         {
-            failures_state = kCAUTION1;
+            next_state = kCAUTION1;
         }
         break;
 
     case kCAUTION1:
 
         /* Actualiza falla a CAUTION1 en bus de datos */
-        bus_data.failure = kFAILURE_CAUTION1;
+        bus_data->failure = kFAILURE_CAUTION1;
 
         /* Actualiza falla a CAUTION1 en bus de salida CAN */
-        FAILURES_Send_Failure(bus_data.failure, &bus_can_output);
+        FAILURES_Send_Failure(bus_data->failure, &ctx->bus_can_output);
 
-        if (FAILURES_Is_Autokill()) 
+        if (FAILURES_Is_Autokill(bus_data)) 
         {
-            failures_state = kAUTOKILL;
+            next_state = kAUTOKILL;
         }
-        else if (bus_data.bms_status == kMODULE_STATUS_PROBLEM
-            || bus_data.dcdc_status == kMODULE_STATUS_PROBLEM
-            || bus_data.inversor_status == kMODULE_STATUS_PROBLEM)
+        else if (bus_data->bms_status == kMODULE_STATUS_PROBLEM
+            || bus_data->dcdc_status == kMODULE_STATUS_PROBLEM
+            || bus_data->inversor_status == kMODULE_STATUS_PROBLEM)
         {
-            failures_state = kCAUTION2;
+            next_state = kCAUTION2;
         }
-        else if (bus_data.bms_status == kMODULE_STATUS_OK
-            && bus_data.dcdc_status == kMODULE_STATUS_OK
-            && bus_data.inversor_status == kMODULE_STATUS_OK)
+        else if (bus_data->bms_status == kMODULE_STATUS_OK
+            && bus_data->dcdc_status == kMODULE_STATUS_OK
+            && bus_data->inversor_status == kMODULE_STATUS_OK)
         {
-            failures_state = kOK;
+            next_state = kOK;
         }
         break;
 
     case kCAUTION2:
 
         /* Actualiza falla a CAUTION2 en bus de datos */
-        bus_data.failure = kFAILURE_CAUTION2;
+        bus_data->failure = kFAILURE_CAUTION2;
 
         /* Actualiza falla a CAUTION2 en bus de salida CAN */
-        FAILURES_Send_Failure(bus_data.failure, &bus_can_output);
+        FAILURES_Send_Failure(bus_data->failure, &ctx->bus_can_output);
 
-        if (FAILURES_Is_Autokill()) 
+        if (FAILURES_Is_Autokill(bus_data)) 
         {
-            failures_state = kAUTOKILL;
+            next_state = kAUTOKILL;
         }
-        else if ((bus_data.bms_status == kMODULE_STATUS_REGULAR || bus_data.bms_status == kMODULE_STATUS_OK)
-            && (bus_data.dcdc_status == kMODULE_STATUS_REGULAR || bus_data.dcdc_status == kMODULE_STATUS_OK)
-            && (bus_data.inversor_status == kMODULE_STATUS_REGULAR || bus_data.inversor_status == kMODULE_STATUS_OK))
+        else if ((bus_data->bms_status == kMODULE_STATUS_REGULAR || bus_data->bms_status == kMODULE_STATUS_OK)
+            && (bus_data->dcdc_status == kMODULE_STATUS_REGULAR || bus_data->dcdc_status == kMODULE_STATUS_OK)
+            && (bus_data->inversor_status == kMODULE_STATUS_REGULAR || bus_data->inversor_status == kMODULE_STATUS_OK))
         {
-            failures_state = kCAUTION1;
+            next_state = kCAUTION1;
         }
         break;
 
     case kAUTOKILL:
 
         /* Actualiza falla a AUTOKILL en bus de datos */
-        bus_data.failure = kFAILURE_AUTOKILL;
+        bus_data->failure = kFAILURE_AUTOKILL;
 
         /* Actualiza falla a AUTOKILL en bus de salida CAN */
-        FAILURES_Send_Failure(bus_data.failure, &bus_can_output);
+        FAILURES_Send_Failure(bus_data->failure, &ctx->bus_can_output);
 
         /* Actualiza info de control a ERROR en bus de salida CAN */
-        FAILURES_Send_ControlInfo(kMODULE_INFO_ERROR, &bus_can_output);
+        FAILURES_Send_ControlInfo(kMODULE_INFO_ERROR, &ctx->bus_can_output);
 
         /* Actualiza variable autokill en bus de salida CAN */
-        FAILURES_Send_Autokill(&bus_can_output);
+        FAILURES_Send_Autokill(&ctx->bus_can_output);
 
         break;
 
     default:
         break;
     }
+
+    /* Transición solo si la condición persiste durante su ventana */
+    FAILURES_Filter_Transition(ctx, next_state);
 }
 
 /**
  * @brief Condición para evento de AUTOKILL
  *
+ * @param bus_data  Puntero a estructura de tipo typedef_bus1_t (bus de datos)
  * @retval true     Se cumple condición autokill
  * @retval false    No se cumple condición autokill
  */
-static bool FAILURES_Is_Autokill(void)
+static bool FAILURES_Is_Autokill(const typedef_bus1_t* bus_data)
+{
+    return FAILURES_Count_ProblemModules(bus_data) >= NUM_OF_PROBLEM_MODULES ? true : false;
+}
+
+/**
+ * @brief Condición crítica para AUTOKILL por camino rápido
+ *
+ * @param bus_data  Puntero a estructura de tipo typedef_bus1_t (bus de datos)
+ * @retval true     Se cumple condición crítica
+ * @retval false    No se cumple condición crítica
+ */
+static bool FAILURES_Is_Critical(const typedef_bus1_t* bus_data)
+{
+    return FAILURES_Count_ProblemModules(bus_data) >= FAILURES_CRITICAL_NUM_OF_PROBLEM_MODULES ? true : false;
+}
+
+/**
+ * @brief Cuenta los módulos en estado PROBLEM
+ *
+ * @param bus_data  Puntero a estructura de tipo typedef_bus1_t (bus de datos)
+ * @return int Número de módulos en estado PROBLEM
+ */
+static int FAILURES_Count_ProblemModules(const typedef_bus1_t* bus_data)
 {
     int count = 0;
 
-	if (bus_data.bms_status == kMODULE_STATUS_PROBLEM) count++;
+	if (bus_data->bms_status == kMODULE_STATUS_PROBLEM) count++;
+
+	if (bus_data->dcdc_status == kMODULE_STATUS_PROBLEM) count++;
+
+	if (bus_data->inversor_status == kMODULE_STATUS_PROBLEM) count++;
+
+    return count;
+}
+
+/**
+ * @brief Ventana de persistencia de una transición según la configuración del contexto.
+ *
+ * Las transiciones a AUTOKILL usan la ventana de AUTOKILL, o la del camino rápido si la condición es crítica; el
+ * resto usa la ventana de escalamiento o de recuperación según si la falla destino es más o menos severa.
+ *
+ * @param ctx           Contexto de la aplicación
+ * @param next_state    Estado destino
+ * @return const failures_persistence_t*  Ventana de persistencia
+ */
+static const failures_persistence_t* FAILURES_Get_Window(app_context_t* ctx, uint8_t next_state)
+{
+    const failures_config_t* config = &ctx->config->failures;
+
+    if (next_state == kAUTOKILL)
+    {
+        return FAILURES_Is_Critical(&ctx->bus_data) ? &config->critical : &config->autokill;
+    }
+
+    return (next_state > ctx->failures_state) ? &config->escalate : &config->recover;
+}
+
+/**
+ * @brief Filtro de persistencia de transiciones de la máquina de fallas.
+ *
+ * Cada estado destino (nivel) tiene su propia ventana. Un nivel más severo que el actual está presente mientras el
+ * estado destino observado es ese nivel o uno más severo; uno menos severo, mientras el destino es ese nivel o uno
+ * menos severo. Así, un destino que alterna (p. ej. CAUTION2 y AUTOKILL con un módulo en PROBLEM y otro
+ * intermitente) no reinicia la ventana de los niveles que se mantienen presentes. La transición va al nivel más
+ * lejano cuya ventana se cumplió; un nivel cuya condición desaparece reinicia su ventana. El conteo avanza solo con
+ * muestras recibidas (failures_sample). Una condición crítica usa la ventana del camino rápido hacia AUTOKILL.
+ *
+ * @param ctx           Contexto de la aplicación
+ * @param next_state    Estado destino observado en la evaluación actual
+ */
+static void FAILURES_Filter_Transition(app_context_t* ctx, uint8_t next_state)
+{
+    failures_filter_t* filter = &ctx->failures_filter;
+    uint8_t state = ctx->failures_state;
+    uint8_t target = state;
+    uint32_t now;
+    bool sample = ctx->failures_sample;
+
+    ctx->failures_sample = false;
+
+    /* Sin condición de transición: reinicia todas las ventanas */
+    if (next_state == state)
+    {
+        for (uint8_t level = 0; level < FAILURES_NUM_OF_STATES; level++)
+        {
+            filter->level[level].active = false;
+        }
+
+        return;
+    }
 
-	if (bus_data.dcdc_status == kMODULE_STATUS_PROBLEM) count++;
+    now = HAL_GetTick();
 
-	if (bus_data.inversor_status == kMODULE_STATUS_PROBLEM) count++;
+    for (uint8_t level = 0; level < FAILURES_NUM_OF_STATES; level++)
+    {
+        failures_level_filter_t* level_filter = &filter->level[level];
+        const failures_persistence_t* window;
+        bool present = (level > state && next_state >= level) || (level < state && next_state <= level);
 
-    return count >= NUM_OF_PROBLEM_MODULES ? true : false;
+        /* Sin condición de transición a este nivel: reinicia su ventana */
+        if (!present)
+        {
+            level_filter->active = false;
+            continue;
+        }
+
+        /* Nueva condición de transición: inicia conteo */
+        if (!level_filter->active)
+        {
+            level_filter->active = true;
+            level_filter->count = 0;
+            level_filter->tickstart = now;
+        }
+
+        if (sample && level_filter->count < UINT16_MAX)
+        {
+            level_filter->count++;
+        }
+
+        window = FAILURES_Get_Window(ctx, level);
+
+        /* Escalamiento: el nivel cumplido más severo; recuperación: el menos severo (recorrido ascendente) */
+        if (level_filter->count >= window->min_count && (now - level_filter->tickstart) >= window->min_time_ms
+            && (level > state || target == state))
+        {
+            target = level;
+        }
+    }
+
+    if (target != state)
+    {
+        ctx->failures_state = target;
+
+        /* Las ventanas se miden desde el estado nuevo */
+        for (uint8_t level = 0; level < FAILURES_NUM_OF_STATES; level++)
+        {
+            filter->level[level].active = false;
+        }
+    }
 }
 
 /**
@@ -0,0 +1,210 @@
+/**
+ * @file idle.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Idle de la superloop con WFI y trabajo pendiente marcado por las ISRs
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "idle.h"
+
+#if USE_WFI_IDLE_FEATURE == 1
+
+/* Application includes */
+#include "cpu_load.h"
+#include "ramfunc.h"
+#include "timebase.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Bits IDLE_EVENT_* pendientes (escritos por ISRs) */
+static volatile uint32_t idle_pending = 0;
+
+/** @brief Instante en que el trabajo pendiente pasó de vacío a no vacío */
+static volatile uint32_t idle_pending_since_us = 0;
+
+/** @brief Ticks de SysTick desde el último IDLE_EVENT_TICK */
+static uint32_t idle_tick_count = 0;
+
+/** @brief Indica si ya hubo una primera espera (las estadísticas parten en ella) */
+static bool idle_started = false;
+
+/** @brief Instante de la última actualización del tiempo total */
+static uint32_t idle_last_us = 0;
+
+/** @brief Estadísticas desde la primera espera */
+static idle_stats_t idle_stats;
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa el idle: borra trabajo pendiente y estadísticas.
+ *
+ * No es static, por lo que puede ser usada por otros archivos. Llamar después de TIMEBASE_Init.
+ *
+ * @param None
+ * @retval None
+ */
+void IDLE_Init(void)
+{
+    idle_pending = 0;
+    idle_tick_count = 0;
+    idle_started = false;
+    idle_last_us = 0;
+
+    idle_stats = (idle_stats_t){0};
+
+#if USE_CPU_LOAD_FEATURE == 1
+    /* DWT->CYCCNT se detiene con el reloj del núcleo en sleep: el monitor de carga necesita que siga contando */
+    DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP_Msk;
+#endif /* USE_CPU_LOAD_FEATURE */
+}
+
+/**
+ * @brief Marca trabajo pendiente para la superloop.
+ *
+ * Puede llamarse desde ISRs de cualquier prioridad (sección crítica con PRIMASK).
+ *
+ * @param events    Bits IDLE_EVENT_*
+ * @retval None
+ */
+RAMFUNC void IDLE_Set_Pending_FromISR(uint32_t events)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if (idle_pending == 0U)
+    {
+        idle_pending_since_us = TIMEBASE_Get_Us();
+    }
+
+    idle_pending |= events;
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Tick de trabajo temporizado, desde SysTick_Handler.
+ *
+ * Marca IDLE_EVENT_TICK cada IDLE_TICK_PERIOD_MS llamadas.
+ *
+ * @param None
+ * @retval None
+ */
+RAMFUNC void IDLE_Tick_FromISR(void)
+{
+    if (++idle_tick_count >= IDLE_TICK_PERIOD_MS)
+    {
+        idle_tick_count = 0;
+
+        IDLE_Set_Pending_FromISR(IDLE_EVENT_TICK);
+    }
+}
+
+/**
+ * @brief Duerme con WFI hasta que haya trabajo pendiente y lo retorna (borrándolo).
+ *
+ * Si ya hay trabajo pendiente retorna sin dormir.
+ *
+ * @return uint32_t     Bits IDLE_EVENT_* pendientes
+ */
+uint32_t IDLE_Wait(void)
+{
+    uint32_t events;
+    uint32_t since_us;
+    uint32_t now_us;
+    uint32_t latency_us;
+
+    __disable_irq();
+
+    while (idle_pending == 0U)
+    {
+        uint32_t sleep_us = TIMEBASE_Get_Us();
+#if USE_CPU_LOAD_FEATURE == 1
+        uint32_t sleep_cycles = CPU_LOAD_GET_CYCLES();
+#endif /* USE_CPU_LOAD_FEATURE */
+
+        /* Con PRIMASK en 1 la interrupción pendiente despierta al núcleo pero su ISR corre al bajar PRIMASK */
+        __DSB();
+        __WFI();
+
+#if USE_CPU_LOAD_FEATURE == 1
+        CPU_LOAD_Sleep(CPU_LOAD_GET_CYCLES() - sleep_cycles);
+#endif /* USE_CPU_LOAD_FEATURE */
+        idle_stats.sleep_us += TIMEBASE_ELAPSED_US(sleep_us, TIMEBASE_Get_Us());
+        idle_stats.sleeps++;
+
+        /* Atiende las ISRs que despertaron al núcleo */
+        __enable_irq();
+        __disable_irq();
+
+        if (idle_pending == 0U)
+        {
+            idle_stats.spurious_wakeups++;
+        }
+    }
+
+    events = idle_pending;
+    since_us = idle_pending_since_us;
+    idle_pending = 0U;
+
+    __enable_irq();
+
+    now_us = TIMEBASE_Get_Us();
+
+    /* Primera espera (fin del arranque): el trabajo pendiente desde el arranque no es un despertar */
+    if (!idle_started)
+    {
+        idle_started = true;
+        idle_last_us = now_us;
+        idle_stats = (idle_stats_t){0};
+
+        return events;
+    }
+
+    latency_us = TIMEBASE_ELAPSED_US(since_us, now_us);
+
+    if (latency_us > idle_stats.wake_latency_max_us)
+    {
+        idle_stats.wake_latency_max_us = latency_us;
+    }
+
+    if (latency_us > IDLE_WAKE_LATENCY_MAX_US)
+    {
+        idle_stats.wake_latency_over++;
+    }
+
+    idle_stats.elapsed_us += TIMEBASE_ELAPSED_US(idle_last_us, now_us);
+    idle_stats.wakeups++;
+    idle_last_us = now_us;
+
+    return events;
+}
+
+/**
+ * @brief Retorna las estadísticas del idle desde la primera espera (fin del arranque).
+ *
+ * @param stats     Estadísticas a completar
+ * @retval None
+ */
+void IDLE_Get_Stats(idle_stats_t* stats)
+{
+    *stats = idle_stats;
+}
+
+#endif /* USE_WFI_IDLE_FEATURE */
@@ -47,34 +47,34 @@
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void INDICATORS_Process(void)
+void INDICATORS_Process(app_context_t* ctx)
 {
 	/*
-    if(bus_data.driving_mode == kDRIVING_MODE_ECO)
+    if(ctx->bus_data.driving_mode == kDRIVING_MODE_ECO)
     {
         BSP_LED_On(LED1);
         BSP_LED_Off(LED2);
         BSP_LED_Off(LED3);
     }
 
-    else if(bus_data.driving_mode == kDRIVING_MODE_NORMAL)
+    else if(ctx->bus_data.driving_mode == kDRIVING_MODE_NORMAL)
     {
         BSP_LED_Off(LED1);
         BSP_LED_On(LED2);
         BSP_LED_Off(LED3);
     }
 
-    else if(bus_data.driving_mode == kDRIVING_MODE_SPORT)
+    else if(ctx->bus_data.driving_mode == kDRIVING_MODE_SPORT)
     {
         BSP_LED_Off(LED1);
         BSP_LED_Off(LED2);
         BSP_LED_On(LED3);
     }
 
-    if(bus_data.failure == kFAILURE_AUTOKILL)
+    if(ctx->bus_data.failure == kFAILURE_AUTOKILL)
     {
         BSP_BUZZER_On();
 
@@ -89,22 +89,22 @@ void INDICATORS_Process(void)
  * 
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param None
+ * @param ctx Contexto de la aplicación
  * @retval None
  */
-void INDICATORS_Update_ModulesLEDs(void)
+void INDICATORS_Update_ModulesLEDs(app_context_t* ctx)
 {
-    if(bus_can_input.dcdc_ok == CAN_VALUE_MODULE_OK)
+    if(ctx->bus_can_input.dcdc_ok == CAN_VALUE_MODULE_OK)
     {
         BSP_LED_On(LED1);
     }
 
-    if(bus_can_input.perifericos_ok == CAN_VALUE_MODULE_OK)
+    if(ctx->bus_can_input.perifericos_ok == CAN_VALUE_MODULE_OK)
     {
         BSP_LED_On(LED2);
     }
 
-    if(bus_can_input.bms_ok == CAN_VALUE_MODULE_OK)
+    if(ctx->bus_can_input.bms_ok == CAN_VALUE_MODULE_OK)
     {
         BSP_LED_On(LED3);
     }
@@ -0,0 +1,127 @@
+/**
+ * @file latency.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Medición de latencia pedal-inversor
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Cada muestra de pedal (CAN 0x002) se marca con la base de tiempo en us (timebase.h) al llegar a la ISR de
+ * recepción. La marca viaja por bus_can_input, bus_data y bus_can_output junto al valor, y al dejar en mailbox la
+ * trama de nivel de velocidad (CAN 0x012) se registra la latencia en us. Las estadísticas reutilizan
+ * el formato del profiler (mínimo, máximo, media e histograma log2). Este archivo no depende de la HAL.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "latency.h"
+
+/* CAN application includes */
+#include "can_def.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Estadísticas de latencia en us */
+static profiler_stats_t latency_stats;
+
+/** @brief Marca de tiempo de la última muestra registrada */
+static uint32_t last_timestamp = LATENCY_NO_TIMESTAMP;
+
+/** @brief Registro de la siguiente trama a exportar */
+static uint8_t export_record = 0;
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa la medición de latencia.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void LATENCY_Init(void)
+{
+    LATENCY_Reset();
+}
+
+/**
+ * @brief Registra la salida a mailbox de una trama de nivel de velocidad.
+ *
+ * Registra la latencia desde la llegada de la muestra de pedal que originó la trama. Cada muestra
+ * se registra una sola vez (la primera trama que la transporta); tramas que repiten el valor de
+ * una muestra ya registrada se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param timestamp Marca de tiempo de llegada de la muestra de pedal (LATENCY_NO_TIMESTAMP si no hay)
+ * @param now       Valor actual de la base de tiempo en us
+ * @retval None
+ */
+void LATENCY_Record_Tx(uint32_t timestamp, uint32_t now)
+{
+    if (timestamp == LATENCY_NO_TIMESTAMP || timestamp == last_timestamp)
+    {
+        return;
+    }
+
+    last_timestamp = timestamp;
+
+    PROFILER_Stats_Update(&latency_stats, TIMEBASE_ELAPSED_US(timestamp, now));
+}
+
+/**
+ * @brief Retorna las estadísticas de latencia pedal-inversor en us.
+ *
+ * @return const profiler_stats_t*
+ */
+const profiler_stats_t* LATENCY_Get_Stats(void)
+{
+    return &latency_stats;
+}
+
+/**
+ * @brief Reinicia las estadísticas de latencia.
+ *
+ * @param None
+ * @retval None
+ */
+void LATENCY_Reset(void)
+{
+    memset(&latency_stats, 0, sizeof(latency_stats));
+
+    last_timestamp = LATENCY_NO_TIMESTAMP;
+    export_record = 0;
+}
+
+/**
+ * @brief Prepara la siguiente trama de diagnóstico de latencia.
+ *
+ * Mismo formato que las tramas del profiler (ver PROFILER_Encode_Frame), en us y con etapa 0.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @retval None
+ */
+void LATENCY_Export_Next(can_frame_t* frame)
+{
+    frame->id = CAN_ID_CONTROL_DIAG_LATENCIA;
+    frame->payload_length = PROFILER_Encode_Frame(&latency_stats, 0, export_record, frame->payload_buff);
+
+    export_record++;
+
+    if (export_record >= PROFILER_RECORDS_PER_STAGE)
+    {
+        export_record = 0;
+    }
+}
@@ -22,6 +22,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "app_control.h"
+#include "app_rtos.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -85,6 +86,11 @@ int main(void)
 
   MX_APP_Init();
 
+#if USE_FREERTOS_FEATURE == 1
+  /* Las etapas corren como tareas (app_rtos.c): no retorna */
+  APP_RTOS_Start();
+#endif /* USE_FREERTOS_FEATURE */
+
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -140,12 +140,12 @@ const rx_inversor_limits_t inversor_sport_limits =
  **********************************************************************************************************************/
 
 #if USE_VEHICLE_VAR_MONITORING_FEATURE == 1
-static void MONITORING_Update_AnalogVariablesState(void);
-static void MONITORING_Update_ModulesStatus(void);
+static void MONITORING_Update_AnalogVariablesState(typedef_bus1_t* bus_data);
+static void MONITORING_Update_ModulesStatus(typedef_bus1_t* bus_data);
 
 #endif /* USE_VEHICLE_VAR_MONITORING_FEATURE */
 
-static void MONITORING_Update_ReceivedModulesStatus(void);
+static void MONITORING_Update_ReceivedModulesStatus(typedef_bus1_t* bus_data);
 
 /***********************************************************************************************************************
  * Public functions implementation
@@ -156,16 +156,16 @@ static void MONITORING_Update_ReceivedModulesStatus(void);
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param   None
+ * @param   ctx Contexto de la aplicación
  * @retval  None
  */
-void MONITORING_Process(void)
+void MONITORING_Process(app_context_t* ctx)
 {
-    MONITORING_Update_ReceivedModulesStatus();     	// actualiza estado recibido de los módulos (fallas internas)
+    MONITORING_Update_ReceivedModulesStatus(&ctx->bus_data);   // actualiza estado recibido de los módulos (fallas internas)
 
 #if USE_VEHICLE_VAR_MONITORING_FEATURE == 1
-    MONITORING_Update_AnalogVariablesState();       // variables analógicas recibidas que dan información general del estado del vehículo
-    MONITORING_Update_ModulesStatus();              // estado de los módulos de acuerdo al estado de las variables analógicas recibidas
+    MONITORING_Update_AnalogVariablesState(&ctx->bus_data);    // variables analógicas recibidas que dan información general del estado del vehículo
+    MONITORING_Update_ModulesStatus(&ctx->bus_data);           // estado de los módulos de acuerdo al estado de las variables analógicas recibidas
 
 #endif /* USE_VEHICLE_VAR_MONITORING_FEATURE */
 }
@@ -180,14 +180,15 @@ void MONITORING_Process(void)
  * Estado general de los módulos de acuerdo a las variables de estado de módulo recibidas. Sintetizan las variables
  * internas y los estados de falla definidos internamente por cada módulo del vehículo.
  *
+ * @param bus_data Puntero a estructura de tipo typedef_bus1_t (bus de datos)
  */
-static void MONITORING_Update_ReceivedModulesStatus(void)
+static void MONITORING_Update_ReceivedModulesStatus(typedef_bus1_t* bus_data)
 {
-    bus_data.bms_status = MONITORING_API_Get_Bms_ReceivedStatus(&bus_data.Rx_Bms);                  // actualiza variable estado del módulo BMS
+    bus_data->bms_status = MONITORING_API_Get_Bms_ReceivedStatus(&bus_data->Rx_Bms);                  // actualiza variable estado del módulo BMS
 
-    bus_data.dcdc_status = MONITORING_API_Get_Dcdc_ReceivedStatus(&bus_data.Rx_Dcdc);               // actualiza variable estado del módulo DCDC
+    bus_data->dcdc_status = MONITORING_API_Get_Dcdc_ReceivedStatus(&bus_data->Rx_Dcdc);               // actualiza variable estado del módulo DCDC
 
-    bus_data.inversor_status = MONITORING_API_Get_Inversor_ReceivedStatus(&bus_data.Rx_Inversor);   // actualiza variable estado del módulo inversor
+    bus_data->inversor_status = MONITORING_API_Get_Inversor_ReceivedStatus(&bus_data->Rx_Inversor);   // actualiza variable estado del módulo inversor
 }
 
 #if USE_VEHICLE_VAR_MONITORING_FEATURE == 1
@@ -197,27 +198,28 @@ static void MONITORING_Update_ReceivedModulesStatus(void)
  * Se realiza el monitoreo de las variables analógicas recibidas de los módulos. Estas variables analógicas se consideran
  * como variables generales del sistema que brindan información relevante del estado general del vehículo.
  *
+ * @param bus_data Puntero a estructura de tipo typedef_bus1_t (bus de datos)
  */
-static void MONITORING_Update_AnalogVariablesState(void)
+static void MONITORING_Update_AnalogVariablesState(typedef_bus1_t* bus_data)
 {
 
-    switch (bus_data.driving_mode)
+    switch (bus_data->driving_mode)
     {
     case kDRIVING_MODE_ECO:
 
         /* Actualiza estado de las variables del módulo BMS */
-        MONITORING_API_Bms_VariableMonitoring(  &bus_data.Rx_Bms,
-                                                &bus_data.St_Bms,
+        MONITORING_API_Bms_VariableMonitoring(  &bus_data->Rx_Bms,
+                                                &bus_data->St_Bms,
                                                 &bms_eco_limits);
 
         /* Actualiza estado de las variables del módulo DCDC */
-        MONITORING_API_Dcdc_VariableMonitoring( &bus_data.Rx_Dcdc,
-                                                &bus_data.St_Dcdc,
+        MONITORING_API_Dcdc_VariableMonitoring( &bus_data->Rx_Dcdc,
+                                                &bus_data->St_Dcdc,
                                                 &dcdc_eco_limits);
 
         /* Actualiza estado de las variables del módulo inversor */
-        MONITORING_API_Inversor_VariableMonitoring( &bus_data.Rx_Inversor,
-                                                    &bus_data.St_Inversor,
+        MONITORING_API_Inversor_VariableMonitoring( &bus_data->Rx_Inversor,
+                                                    &bus_data->St_Inversor,
                                                     &inversor_eco_limits);
 
         break;
@@ -225,18 +227,18 @@ static void MONITORING_Update_AnalogVariablesState(void)
     case kDRIVING_MODE_NORMAL:
 
         /* Actualiza estado de las variables del módulo BMS */
-        MONITORING_API_Bms_VariableMonitoring(  &bus_data.Rx_Bms,
-                                                &bus_data.St_Bms,
+        MONITORING_API_Bms_VariableMonitoring(  &bus_data->Rx_Bms,
+                                                &bus_data->St_Bms,
                                                 &bms_normal_limits);
 
         /* Actualiza estado de las variables del módulo DCDC */
-        MONITORING_API_Dcdc_VariableMonitoring( &bus_data.Rx_Dcdc,
-                                                &bus_data.St_Dcdc,
+        MONITORING_API_Dcdc_VariableMonitoring( &bus_data->Rx_Dcdc,
+                                                &bus_data->St_Dcdc,
                                                 &dcdc_normal_limits);
 
         /* Actualiza estado de las variables del módulo inversor */
-        MONITORING_API_Inversor_VariableMonitoring( &bus_data.Rx_Inversor,
-                                                    &bus_data.St_Inversor,
+        MONITORING_API_Inversor_VariableMonitoring( &bus_data->Rx_Inversor,
+                                                    &bus_data->St_Inversor,
                                                     &inversor_normal_limits);
 
         break;
@@ -244,18 +246,18 @@ static void MONITORING_Update_AnalogVariablesState(void)
     case kDRIVING_MODE_SPORT:
 
         /* Actualiza estado de las variables del módulo BMS */
-        MONITORING_API_Bms_VariableMonitoring(  &bus_data.Rx_Bms,
-                                                &bus_data.St_Bms,
+        MONITORING_API_Bms_VariableMonitoring(  &bus_data->Rx_Bms,
+                                                &bus_data->St_Bms,
                                                 &bms_sport_limits);
 
         /* Actualiza estado de las variables del módulo DCDC */
-        MONITORING_API_Dcdc_VariableMonitoring( &bus_data.Rx_Dcdc,
-                                                &bus_data.St_Dcdc,
+        MONITORING_API_Dcdc_VariableMonitoring( &bus_data->Rx_Dcdc,
+                                                &bus_data->St_Dcdc,
                                                 &dcdc_sport_limits);
 
         /* Actualiza estado de las variables del módulo inversor */
-        MONITORING_API_Inversor_VariableMonitoring( &bus_data.Rx_Inversor,
-                                                    &bus_data.St_Inversor,
+        MONITORING_API_Inversor_VariableMonitoring( &bus_data->Rx_Inversor,
+                                                    &bus_data->St_Inversor,
                                                     &inversor_sport_limits);
 
         break;
@@ -271,41 +273,42 @@ static void MONITORING_Update_AnalogVariablesState(void)
  * A partir de los estados de las variables analógicas de los módulos, que se encuentran guardados en la estructuras  St_Bms, St_Dcdc,
  * St_Inversor, actualiza la variable de estado general de cada uno de los módulos (BMS, DCDC, e inversor).
  *
+ * @param bus_data Puntero a estructura de tipo typedef_bus1_t (bus de datos)
  */
-static void MONITORING_Update_ModulesStatus(void)
+static void MONITORING_Update_ModulesStatus(typedef_bus1_t* bus_data)
 {
 	module_status_t analog_bms_status;
 	module_status_t analog_dcdc_status;
 	module_status_t analog_inversor_status;
 
     /* Las fallas internas tienen prioridad sobre el monitoreo de las variables del vehículo */
-    if (bus_data.bms_status != kMODULE_STATUS_PROBLEM)
+    if (bus_data->bms_status != kMODULE_STATUS_PROBLEM)
     {
-    	analog_bms_status = MONITORING_API_Get_Bms_Status(&bus_data.St_Bms);
+    	analog_bms_status = MONITORING_API_Get_Bms_Status(&bus_data->St_Bms);
 
     	if( analog_bms_status != kMODULE_STATUS_DATA_PROBLEM)
     	{
-    		bus_data.bms_status = analog_bms_status;				// actualiza variable estado del módulo BMS
+    		bus_data->bms_status = analog_bms_status;				// actualiza variable estado del módulo BMS
     	}
     }
 
-    if (bus_data.dcdc_status != kMODULE_STATUS_PROBLEM)
+    if (bus_data->dcdc_status != kMODULE_STATUS_PROBLEM)
     {
-    	analog_dcdc_status = MONITORING_API_Get_Dcdc_Status(&bus_data.St_Dcdc);
+    	analog_dcdc_status = MONITORING_API_Get_Dcdc_Status(&bus_data->St_Dcdc);
 
     	if( analog_dcdc_status != kMODULE_STATUS_DATA_PROBLEM)
     	{
-    		bus_data.dcdc_status = analog_dcdc_status;				// actualiza variable estado del módulo DCDC
+    		bus_data->dcdc_status = analog_dcdc_status;				// actualiza variable estado del módulo DCDC
     	}
     }
 
-    if (bus_data.inversor_status != kMODULE_STATUS_PROBLEM)
+    if (bus_data->inversor_status != kMODULE_STATUS_PROBLEM)
     {
-    	analog_inversor_status = MONITORING_API_Get_Inversor_Status(&bus_data.St_Inversor);
+    	analog_inversor_status = MONITORING_API_Get_Inversor_Status(&bus_data->St_Inversor);
 
     	if( analog_inversor_status != kMODULE_STATUS_DATA_PROBLEM)
     	{
-    		bus_data.inversor_status = analog_inversor_status;		// actualiza variable estado del módulo Inversor
+    		bus_data->inversor_status = analog_inversor_status;		// actualiza variable estado del módulo Inversor
     	}
     }
 }
@@ -30,59 +30,64 @@ void MONITORING_API_Bms_VariableMonitoring( rx_bms_vars_t* Rx_Bms,
                                             st_bms_vars_t* St_Bms,
                                             const rx_bms_limits_t* bms_limits)
 {
+    /* Copia local: los estados son campos de bits, se escriben en el bus una sola vez */
+    st_bms_vars_t st = *St_Bms;
+
     /* NIVEL DE LA BATERÍA */
 
     if( Rx_Bms->nivel_bateria > bms_limits->REG_nivel_bateria)
     {
-        St_Bms->nivel_bateria = kVAR_STATE_OK;
+        st.nivel_bateria = kVAR_STATE_OK;
     }
     if( Rx_Bms->nivel_bateria < bms_limits->REG_nivel_bateria)
     {
-        St_Bms->nivel_bateria = kVAR_STATE_REGULAR;
+        st.nivel_bateria = kVAR_STATE_REGULAR;
     }
     if( Rx_Bms->nivel_bateria < bms_limits->MIN_nivel_bateria)
     {
-        St_Bms->nivel_bateria = kVAR_STATE_PROBLEM;
+        st.nivel_bateria = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Bms->nivel_bateria == 0)
 	{
-		St_Bms->nivel_bateria = kVAR_STATE_DATA_PROBLEM;
+		st.nivel_bateria = kVAR_STATE_DATA_PROBLEM;
 	}
 
     /* VOLTAJE DE LA BATERÍA */
     if( Rx_Bms->voltaje < bms_limits->MAX_voltaje_bateria &&
         Rx_Bms->voltaje > bms_limits->MIN_voltaje_bateria)
     {
-        St_Bms->voltaje = kVAR_STATE_OK;
+        st.voltaje = kVAR_STATE_OK;
     }
     else
     {
-        St_Bms->voltaje = kVAR_STATE_PROBLEM;
+        st.voltaje = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Bms->voltaje == 0)
 	{
-		St_Bms->voltaje = kVAR_STATE_DATA_PROBLEM;
+		st.voltaje = kVAR_STATE_DATA_PROBLEM;
 	}
 
     /* POTENCIA DE SALIDA */
     if( Rx_Bms->potencia < bms_limits->MAX_potencia &&
         Rx_Bms->potencia < bms_limits->REG_potencia)
     {
-        St_Bms->potencia = kVAR_STATE_OK;
+        st.potencia = kVAR_STATE_OK;
     }
     else if( Rx_Bms->potencia > bms_limits->REG_potencia &&
              Rx_Bms->potencia < bms_limits->MAX_potencia)
     {
-        St_Bms->potencia = kVAR_STATE_REGULAR;
+        st.potencia = kVAR_STATE_REGULAR;
     }
     else if( Rx_Bms->potencia > bms_limits->MAX_potencia)
     {
-        St_Bms->potencia = kVAR_STATE_PROBLEM;
+        st.potencia = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Bms->potencia == 0)
 	{
-		St_Bms->potencia = kVAR_STATE_DATA_PROBLEM;
+		st.potencia = kVAR_STATE_DATA_PROBLEM;
 	}
+
+    *St_Bms = st;
 }
 
 /**
@@ -96,41 +101,46 @@ void MONITORING_API_Dcdc_VariableMonitoring(    rx_dcdc_vars_t* Rx_Dcdc,
                                                 st_dcdc_vars_t* St_Dcdc,
                                                 const rx_dcdc_limits_t* dcdc_limits)
 {
+    /* Copia local: los estados son campos de bits, se escriben en el bus una sola vez */
+    st_dcdc_vars_t st = *St_Dcdc;
+
     /* TEMPERATURA MÁXIMA DE MOSFETS */
     if( Rx_Dcdc->t_max < dcdc_limits->MAX_temp_max_mosfets &&
         Rx_Dcdc->t_max < dcdc_limits->REG_temp_max_mosfets)
     {
-        St_Dcdc->t_max = kVAR_STATE_OK;
+        st.t_max = kVAR_STATE_OK;
     }
     else if( Rx_Dcdc->t_max > dcdc_limits->REG_temp_max_mosfets &&
              Rx_Dcdc->t_max < dcdc_limits->MAX_temp_max_mosfets)
     {
-        St_Dcdc->t_max = kVAR_STATE_REGULAR;
+        st.t_max = kVAR_STATE_REGULAR;
     }
     else if( Rx_Dcdc->t_max > dcdc_limits->MAX_temp_max_mosfets)
     {
-        St_Dcdc->t_max = kVAR_STATE_PROBLEM;
+        st.t_max = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Dcdc->t_max == 0)
 	{
-		St_Dcdc->t_max = kVAR_STATE_DATA_PROBLEM;
+		st.t_max = kVAR_STATE_DATA_PROBLEM;
 	}
 
     /* VOLTAJE DE SALIDA */
     if( Rx_Dcdc->voltaje_salida < dcdc_limits->MAX_voltaje_salida &&
         Rx_Dcdc->voltaje_salida > dcdc_limits->MIN_voltaje_salida)
     {
-        St_Dcdc->voltaje_salida = kVAR_STATE_OK;
+        st.voltaje_salida = kVAR_STATE_OK;
     }
     else
     {
-        St_Dcdc->voltaje_salida = kVAR_STATE_PROBLEM;
+        st.voltaje_salida = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Dcdc->voltaje_salida == 0)
 	{
-		St_Dcdc->voltaje_salida = kVAR_STATE_DATA_PROBLEM;
+		st.voltaje_salida = kVAR_STATE_DATA_PROBLEM;
 	}
     /* ... */
+
+    *St_Dcdc = st;
 }
 
 /**
@@ -144,41 +154,46 @@ void MONITORING_API_Inversor_VariableMonitoring(    rx_inversor_vars_t* Rx_Inver
                                                     st_inversor_vars_t* St_Inversor,
                                                     const rx_inversor_limits_t* inversor_limits)
 {
+    /* Copia local: los estados son campos de bits, se escriben en el bus una sola vez */
+    st_inversor_vars_t st = *St_Inversor;
+
     /* TEMPERATURA MÁXIMA DE MOSFETS */
     if( Rx_Inversor->temp_max < inversor_limits->MAX_temp_max_mosfets &&
         Rx_Inversor->temp_max < inversor_limits->REG_temp_max_mosfets)
     {
-        St_Inversor->temp_max = kVAR_STATE_OK;
+        st.temp_max = kVAR_STATE_OK;
     }
     else if( Rx_Inversor->temp_max > inversor_limits->REG_temp_max_mosfets &&
              Rx_Inversor->temp_max < inversor_limits->MAX_temp_max_mosfets)
     {
-        St_Inversor->temp_max = kVAR_STATE_REGULAR;
+        st.temp_max = kVAR_STATE_REGULAR;
     }
     else if( Rx_Inversor->temp_max > inversor_limits->MAX_temp_max_mosfets)
     {
-        St_Inversor->temp_max = kVAR_STATE_PROBLEM;
+        st.temp_max = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Inversor->temp_max == 0)
 	{
-		St_Inversor->temp_max = kVAR_STATE_DATA_PROBLEM;
+		st.temp_max = kVAR_STATE_DATA_PROBLEM;
 	}
 
     /* VOLTAJE DE SALIDA */
     if( Rx_Inversor->V < inversor_limits->MAX_voltaje_salida &&
         Rx_Inversor->V > inversor_limits->MIN_voltaje_salida)
     {
-        St_Inversor->V = kVAR_STATE_OK;
+        st.V = kVAR_STATE_OK;
     }
     else
     {
-        St_Inversor->V = kVAR_STATE_PROBLEM;
+        st.V = kVAR_STATE_PROBLEM;
     }
 	if(Rx_Inversor->V == 0)
 	{
-		St_Inversor->V = kVAR_STATE_DATA_PROBLEM;
+		st.V = kVAR_STATE_DATA_PROBLEM;
 	}
     /* ... */
+
+    *St_Inversor = st;
 }
 
 /* ------------------------------------------------------------------------------------------------------------------ */
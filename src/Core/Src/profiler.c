@@ -0,0 +1,384 @@
+/**
+ * @file profiler.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Profiler de ciclos de las etapas de la aplicación y de las ISRs
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Las estadísticas se alimentan con mediciones de DWT->CYCCNT (ver macros PROFILER_* en profiler.h).
+ * Este archivo no depende de la HAL para que las estructuras y la codificación de tramas compilen
+ * también en host (herramienta de decodificación en Host/Tools).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "profiler.h"
+
+/* CAN application includes */
+#include "can_def.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+#if USE_PROFILER_FEATURE == 1
+
+/** @brief Profundidad de anidamiento de las ISRs medidas (ver PROFILER_ISR_ENTER) */
+volatile uint8_t profiler_isr_depth = 0;
+
+/** @brief Instante de la sonda de latencia pendiente (ver PROFILER_ISR_PROBE) */
+volatile uint32_t profiler_probe_t0 = 0;
+
+/** @brief Sonda de latencia pendiente */
+volatile uint8_t profiler_probe_pending = 0;
+
+#endif /* USE_PROFILER_FEATURE */
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Estadísticas de ciclos de cada etapa */
+static profiler_stats_t profiler_stats[kPROFILER_NUM_OF_STAGES];
+
+/** @brief Nombres de las etapas */
+static const char* const profiler_stage_names[kPROFILER_NUM_OF_STAGES] =
+{
+    "CAN_APP",
+    "DECODE_DATA",
+    "MONITORING",
+    "FAILURES",
+    "DRIVING_MODES",
+    "RAMPA_PEDAL",
+    "INDICATORS",
+    "ISR_CAN1_RX0",
+    "ISR_TIM7",
+    "CAN_TX",
+    "CAN_RX",
+    "ISR_NESTING",
+    "LAT_CAN1_RX0",
+    "LAT_TIM7"
+};
+
+/** @brief Etapa de la siguiente trama a exportar */
+static uint8_t export_stage = 0;
+
+/** @brief Registro de la siguiente trama a exportar */
+static uint8_t export_record = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void PROFILER_Put_U24(uint8_t* buff, uint32_t value);
+static uint32_t PROFILER_Get_U24(const uint8_t* buff);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Registra una medición de ciclos para una etapa.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param stage     Etapa medida
+ * @param cycles    Ciclos medidos
+ * @retval None
+ */
+void PROFILER_Record(profiler_stage_t stage, uint32_t cycles)
+{
+    if (stage >= kPROFILER_NUM_OF_STAGES)
+    {
+        return;
+    }
+
+    PROFILER_Stats_Update(&profiler_stats[stage], cycles);
+}
+
+/**
+ * @brief Actualiza estadísticas con una medición de ciclos.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param stats     Puntero a estadísticas a actualizar
+ * @param cycles    Ciclos medidos
+ * @retval None
+ */
+void PROFILER_Stats_Update(profiler_stats_t* stats, uint32_t cycles)
+{
+    uint8_t bin = PROFILER_Hist_Bin(cycles);
+
+    if (stats->count == 0 || cycles < stats->min)
+    {
+        stats->min = cycles;
+    }
+
+    if (cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+
+    stats->count++;
+    stats->sum += cycles;
+
+    /* Bins saturan en lugar de desbordar */
+    if (stats->hist[bin] < UINT16_MAX)
+    {
+        stats->hist[bin]++;
+    }
+}
+
+/**
+ * @brief Retorna el bin del histograma log2 que corresponde a una medición de ciclos.
+ *
+ * @param cycles    Ciclos medidos
+ * @return uint8_t  Índice de bin [0:PROFILER_HIST_BINS-1]
+ */
+uint8_t PROFILER_Hist_Bin(uint32_t cycles)
+{
+    int32_t bin;
+
+    if (cycles == 0)
+    {
+        return 0;
+    }
+
+    /* floor(log2(cycles)) relativo al primer bin */
+    bin = (31 - __builtin_clz(cycles)) - PROFILER_HIST_MIN_LOG2;
+
+    if (bin < 0)
+    {
+        bin = 0;
+    }
+    else if (bin > PROFILER_HIST_BINS - 1)
+    {
+        bin = PROFILER_HIST_BINS - 1;
+    }
+
+    return (uint8_t)bin;
+}
+
+/**
+ * @brief Retorna las estadísticas de una etapa.
+ *
+ * @param stage     Etapa
+ * @return const profiler_stats_t*
+ */
+const profiler_stats_t* PROFILER_Get_Stats(profiler_stage_t stage)
+{
+    if (stage >= kPROFILER_NUM_OF_STAGES)
+    {
+        return NULL;
+    }
+
+    return &profiler_stats[stage];
+}
+
+/**
+ * @brief Reinicia las estadísticas de todas las etapas.
+ *
+ * @param None
+ * @retval None
+ */
+void PROFILER_Reset(void)
+{
+    memset(profiler_stats, 0, sizeof(profiler_stats));
+
+    export_stage = 0;
+    export_record = 0;
+}
+
+/**
+ * @brief Codifica un registro de estadísticas de una etapa en una trama de diagnóstico.
+ *
+ * Formato (little-endian): byte 0 etapa, byte 1 registro, bytes 2-7 datos.
+ *  - Registro 0: mínimo (u24), máximo (u24)
+ *  - Registro 1: media (u24), conteo (u24)
+ *  - Registro 2 en adelante: PROFILER_HIST_BINS_PER_FRAME bins del histograma (u16 cada uno)
+ *
+ * @param stats     Estadísticas de la etapa
+ * @param stage     Etapa
+ * @param record    Registro a codificar [0:PROFILER_RECORDS_PER_STAGE-1]
+ * @param payload   Buffer de PROFILER_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t PROFILER_Encode_Frame(const profiler_stats_t* stats, uint8_t stage, uint8_t record, uint8_t* payload)
+{
+    uint32_t mean = 0;
+
+    memset(payload, 0, PROFILER_FRAME_LENGTH);
+
+    payload[0] = stage;
+    payload[1] = record;
+
+    if (record == 0)
+    {
+        PROFILER_Put_U24(&payload[2], stats->min);
+        PROFILER_Put_U24(&payload[5], stats->max);
+    }
+    else if (record == 1)
+    {
+        if (stats->count != 0)
+        {
+            mean = (uint32_t)(stats->sum / stats->count);
+        }
+
+        PROFILER_Put_U24(&payload[2], mean);
+        PROFILER_Put_U24(&payload[5], stats->count);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < PROFILER_HIST_BINS_PER_FRAME; i++)
+        {
+            uint8_t bin = (uint8_t)((record - 2) * PROFILER_HIST_BINS_PER_FRAME + i);
+
+            if (bin < PROFILER_HIST_BINS)
+            {
+                payload[2 + 2 * i] = (uint8_t)(stats->hist[bin] & 0xFF);
+                payload[3 + 2 * i] = (uint8_t)(stats->hist[bin] >> 8);
+            }
+        }
+    }
+
+    return PROFILER_FRAME_LENGTH;
+}
+
+/**
+ * @brief Decodifica una trama de diagnóstico del profiler en las estadísticas de su etapa.
+ *
+ * Solo actualiza los campos presentes en el registro recibido. La suma se reconstruye como media por conteo.
+ *
+ * @param payload   Trama recibida
+ * @param length    Largo de la trama
+ * @param stats     Arreglo de kPROFILER_NUM_OF_STAGES estadísticas a actualizar
+ * @retval true     Trama válida
+ * @retval false    Trama inválida
+ */
+bool PROFILER_Decode_Frame(const uint8_t* payload, uint8_t length, profiler_stats_t* stats)
+{
+    uint8_t stage = payload[0];
+    uint8_t record = payload[1];
+    profiler_stats_t* st;
+
+    if (length != PROFILER_FRAME_LENGTH || stage >= kPROFILER_NUM_OF_STAGES || record >= PROFILER_RECORDS_PER_STAGE)
+    {
+        return false;
+    }
+
+    st = &stats[stage];
+
+    if (record == 0)
+    {
+        st->min = PROFILER_Get_U24(&payload[2]);
+        st->max = PROFILER_Get_U24(&payload[5]);
+    }
+    else if (record == 1)
+    {
+        uint32_t mean = PROFILER_Get_U24(&payload[2]);
+
+        st->count = PROFILER_Get_U24(&payload[5]);
+        st->sum = (uint64_t)mean * st->count;
+    }
+    else
+    {
+        for (uint8_t i = 0; i < PROFILER_HIST_BINS_PER_FRAME; i++)
+        {
+            uint8_t bin = (uint8_t)((record - 2) * PROFILER_HIST_BINS_PER_FRAME + i);
+
+            if (bin < PROFILER_HIST_BINS)
+            {
+                st->hist[bin] = (uint16_t)(payload[2 + 2 * i] | (payload[3 + 2 * i] << 8));
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Prepara la siguiente trama de diagnóstico del profiler.
+ *
+ * Recorre en orden todos los registros de todas las etapas, una trama por llamada.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @retval None
+ */
+void PROFILER_Export_Next(can_frame_t* frame)
+{
+    frame->id = CAN_ID_CONTROL_DIAG_PROFILER;
+    frame->payload_length = PROFILER_Encode_Frame(&profiler_stats[export_stage], export_stage, export_record,
+                                                  frame->payload_buff);
+
+    /* Avanza al siguiente registro, y a la siguiente etapa al terminar los registros */
+    export_record++;
+
+    if (export_record >= PROFILER_RECORDS_PER_STAGE)
+    {
+        export_record = 0;
+        export_stage++;
+
+        if (export_stage >= kPROFILER_NUM_OF_STAGES)
+        {
+            export_stage = 0;
+        }
+    }
+}
+
+/**
+ * @brief Nombre de una etapa (para herramientas de diagnóstico).
+ *
+ * @param stage     Etapa
+ * @return const char*
+ */
+const char* PROFILER_Stage_Name(uint8_t stage)
+{
+    if (stage >= kPROFILER_NUM_OF_STAGES)
+    {
+        return "?";
+    }
+
+    return profiler_stage_names[stage];
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Escribe un valor de 24 bits little-endian, saturado a PROFILER_U24_MAX.
+ *
+ * @param buff      Buffer destino (3 bytes)
+ * @param value     Valor a escribir
+ * @retval None
+ */
+static void PROFILER_Put_U24(uint8_t* buff, uint32_t value)
+{
+    if (value > PROFILER_U24_MAX)
+    {
+        value = PROFILER_U24_MAX;
+    }
+
+    buff[0] = (uint8_t)(value & 0xFF);
+    buff[1] = (uint8_t)((value >> 8) & 0xFF);
+    buff[2] = (uint8_t)((value >> 16) & 0xFF);
+}
+
+/**
+ * @brief Lee un valor de 24 bits little-endian.
+ *
+ * @param buff      Buffer fuente (3 bytes)
+ * @return uint32_t Valor leído
+ */
+static uint32_t PROFILER_Get_U24(const uint8_t* buff)
+{
+    return (uint32_t)buff[0] | ((uint32_t)buff[1] << 8) | ((uint32_t)buff[2] << 16);
+}
@@ -15,6 +15,12 @@
 
 #include "rampa_pedal.h"
 
+/* Application includes */
+#include "ramfunc.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
 /***********************************************************************************************************************
  * Private macros
  **********************************************************************************************************************/
@@ -23,18 +29,11 @@
  * Private variables definitions
  **********************************************************************************************************************/
 
-/** Puntero a estructura de tipo rx_peripherals_vars_t que contiene los valores de las variables decodificadas de periféricos */
-static rx_peripherals_vars_t* Rx_Peripherals = &bus_data.Rx_Peripherals;
-
 /***********************************************************************************************************************
  * Private functions prototypes
  **********************************************************************************************************************/
 
-static float RAMPA_PEDAL_Get_Rampa_Eco(rx_var_t pedal);
-
-static float RAMPA_PEDAL_Get_Rampa_Normal(rx_var_t pedal);
-
-static float RAMPA_PEDAL_Get_Rampa_Sport(rx_var_t pedal);
+static float RAMPA_PEDAL_Get_Rampa(const rampa_pedal_map_t* map, rx_var_t pedal);
 
 static float RAMPA_PEDAL_Get_Rampa_HombreMuerto(rx_var_t pedal);
 
@@ -52,37 +51,45 @@ static void RAMPA_PEDAL_Send_HM_State(hm_state_t to_send, typedef_bus2_t* bus_ca
  * Se encarga de transformar el valor de pedal registrado de periféricos a un valor de
  * velocidad que será empleado por inversor. Para cada modo de manejo se tiene una
  * función de transferencia diferente para determinar el valor de velocidad asociado al
- * valor de pedal registrado desde periféricos.
+ * valor de pedal registrado desde periféricos, tomada de la configuración del contexto.
  *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param   None
+ * @param   ctx Contexto de la aplicación
  * @retval  None
  */
-void RAMPA_PEDAL_Process(void)
+RAMFUNC void RAMPA_PEDAL_Process(app_context_t* ctx)
 {
-    if (Rx_Peripherals->hombre_muerto == kHOMBRE_MUERTO_ON)
+    typedef_bus1_t* bus_data = &ctx->bus_data;
+    const rx_peripherals_vars_t* Rx_Peripherals = &ctx->bus_data.Rx_Peripherals;
+    const app_config_t* config = ctx->config;
+    hm_state_t hombre_muerto = Rx_Peripherals->hombre_muerto;
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+    uint32_t primask;
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
+    if (hombre_muerto == kHOMBRE_MUERTO_ON)
     {
         /* Actualiza velocidad inversor en bus de datos */
-        bus_data.velocidad_inversor = RAMPA_PEDAL_Get_Rampa_HombreMuerto(Rx_Peripherals->pedal);
+        bus_data->velocidad_inversor = RAMPA_PEDAL_Get_Rampa_HombreMuerto(Rx_Peripherals->pedal);
     }
-    else if (Rx_Peripherals->hombre_muerto == kHOMBRE_MUERTO_OFF)
+    else if (hombre_muerto == kHOMBRE_MUERTO_OFF)
     {
-        switch (bus_data.driving_mode)
+        switch (bus_data->driving_mode)
         {
         case kDRIVING_MODE_ECO:
             /* Actualiza velocidad inversor en bus de datos */
-            bus_data.velocidad_inversor = RAMPA_PEDAL_Get_Rampa_Eco(Rx_Peripherals->pedal);
+            bus_data->velocidad_inversor = RAMPA_PEDAL_Get_Rampa(&config->pedal_eco, Rx_Peripherals->pedal);
             break;
         
         case kDRIVING_MODE_NORMAL:
             /* Actualiza velocidad inversor en bus de datos */
-            bus_data.velocidad_inversor = RAMPA_PEDAL_Get_Rampa_Normal(Rx_Peripherals->pedal);
+            bus_data->velocidad_inversor = RAMPA_PEDAL_Get_Rampa(&config->pedal_normal, Rx_Peripherals->pedal);
             break;
         
         case kDRIVING_MODE_SPORT:
             /* Actualiza velocidad inversor en bus de datos */
-            bus_data.velocidad_inversor = RAMPA_PEDAL_Get_Rampa_Sport(Rx_Peripherals->pedal);
+            bus_data->velocidad_inversor = RAMPA_PEDAL_Get_Rampa(&config->pedal_sport, Rx_Peripherals->pedal);
             break;
         
         default:
@@ -90,11 +97,32 @@ void RAMPA_PEDAL_Process(void)
         }
     }
 
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+    /* La ISR de recepción puede ver hombre muerto presionado en cualquier punto de la pasada y dejar el corte de
+       velocidad en el bus de salida: se consulta con interrupciones enmascaradas, en la misma sección que escribe
+       el bus de salida, para no pisar ese corte con la velocidad de un snapshot anterior a la trama */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (ctx->hombre_muerto_isr == kHOMBRE_MUERTO_ON)
+    {
+        hombre_muerto = kHOMBRE_MUERTO_ON;
+        bus_data->velocidad_inversor = RAMPA_PEDAL_Get_Rampa_HombreMuerto(Rx_Peripherals->pedal);
+    }
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
+
     /* Actualiza velocidad inversor en bus de salida CAN */
-    RAMPA_PEDAL_Send_Velocidad(bus_data.velocidad_inversor, &bus_can_output);
+    RAMPA_PEDAL_Send_Velocidad(bus_data->velocidad_inversor, &ctx->bus_can_output);
+
+    /* Marca de tiempo de la muestra de pedal que originó la velocidad */
+    ctx->bus_can_output.nivel_velocidad_timestamp = bus_data->pedal_timestamp;
 
 	/* Actualiza estado hombre muerto a bus de salida CAN */
-	RAMPA_PEDAL_Send_HM_State(Rx_Peripherals->hombre_muerto, &bus_can_output);
+	RAMPA_PEDAL_Send_HM_State(hombre_muerto, &ctx->bus_can_output);
+
+#if USE_DEADMAN_FAST_PATH_FEATURE == 1
+    __set_PRIMASK(primask);
+#endif /* USE_DEADMAN_FAST_PATH_FEATURE */
 }
 
 /***********************************************************************************************************************
@@ -103,102 +131,24 @@ void RAMPA_PEDAL_Process(void)
 
 
 /**
- * @brief Rampa pedal para modo ECO
+ * @brief Rampa pedal de un modo de manejo
  *
- * @param pedal     Pedal de periféricos
- * @return float  Velocidad [0:100]
- */
-static float RAMPA_PEDAL_Get_Rampa_Eco(rx_var_t pedal) {
-
-    float velocidad = 0;
-
-    if (pedal >= 0 && pedal < 20)
-    {
-        velocidad = pedal * 0.25;
-    }
-    else if (pedal >= 20 && pedal < 40)
-    {
-        velocidad = (0.5 * pedal) - 5;
-    }
-    else if (pedal >= 40 && pedal < 60)
-    {
-        velocidad = (0.75 * pedal) - 15;
-    }
-    else if (pedal >= 60 && pedal < 80)
-    {
-        velocidad = (1.5 * pedal) - 60;
-    }
-    else if (pedal >= 80 && pedal < 100)
-    {
-        velocidad = (2 * pedal) - 100;
-    }
-
-    return velocidad;
-}
-
-/**
- * @brief Rampa pedal para modo NORMAL
+ * Evalúa el tramo lineal que corresponde al pedal. Fuera de [0:100) la velocidad es 0.
  *
+ * @param map       Rampa del modo de manejo
  * @param pedal     Pedal de periféricos
  * @return float  Velocidad [0:100]
  */
-static float RAMPA_PEDAL_Get_Rampa_Normal(rx_var_t pedal) {
+RAMFUNC static float RAMPA_PEDAL_Get_Rampa(const rampa_pedal_map_t* map, rx_var_t pedal) {
 
     float velocidad = 0;
+    int segment;
 
-    if (pedal >= 0 && pedal < 20)
-    {
-        velocidad = pedal * 0.5;
-    }
-    else if (pedal >= 20 && pedal < 40)
-    {
-        velocidad = pedal - 10;
-    }
-    else if (pedal >= 40 && pedal < 60)
-    {
-        velocidad = (2 * pedal) - 50;
-    }
-    else if (pedal >= 60 && pedal < 80)
+    if (pedal >= 0 && pedal < (RAMPA_PEDAL_NUM_OF_SEGMENTS * RAMPA_PEDAL_SEGMENT_WIDTH))
     {
-        velocidad = pedal + 10;
-    }
-    else if (pedal >= 80 && pedal < 100)
-    {
-        velocidad = (0.5 * pedal) + 50;
-    }
-
-    return velocidad;
-}
+        segment = (int)(pedal / RAMPA_PEDAL_SEGMENT_WIDTH);
 
-/**
- * @brief Rampa pedal para modo SPORT
- *
- * @param pedal     Pedal de periféricos
- * @return float  Velocidad [0:100]
- */
-static float RAMPA_PEDAL_Get_Rampa_Sport(rx_var_t pedal) {
-
-    float velocidad = 0;
-
-    if (pedal >= 0 && pedal < 20)
-    {
-        velocidad = pedal * 1.5;
-    }
-    else if (pedal >= 20 && pedal < 40)
-    {
-        velocidad = (1.25 * pedal) + 5;
-    }
-    else if (pedal >= 40 && pedal < 60)
-    {
-        velocidad = (1 * pedal) + 15;
-    }
-    else if (pedal >= 60 && pedal < 80)
-    {
-        velocidad = (0.75 * pedal) + 30;
-    }
-    else if (pedal >= 80 && pedal < 100)
-    {
-        velocidad = (0.5 * pedal) + 50;
+        velocidad = (map->segment[segment].slope * pedal) + map->segment[segment].offset;
     }
 
     return velocidad;
@@ -210,7 +160,7 @@ static float RAMPA_PEDAL_Get_Rampa_Sport(rx_var_t pedal) {
  * @param pedal     Pedal de periféricos
  * @return float  Velocidad [0:100]
  */
-static float RAMPA_PEDAL_Get_Rampa_HombreMuerto(rx_var_t pedal) {
+RAMFUNC static float RAMPA_PEDAL_Get_Rampa_HombreMuerto(rx_var_t pedal) {
     return 0.0;
 }
 
@@ -220,7 +170,7 @@ static float RAMPA_PEDAL_Get_Rampa_HombreMuerto(rx_var_t pedal) {
  * @param to_send           Velocidad a enviar
  * @param bus_can_output    Puntero a estructura de tipo typedef_bus2_t (bus de salida CAN)
  */
-static void RAMPA_PEDAL_Send_Velocidad(float to_send, typedef_bus2_t* bus_can_output)
+RAMFUNC static void RAMPA_PEDAL_Send_Velocidad(float to_send, typedef_bus2_t* bus_can_output)
 {
     bus_can_output->nivel_velocidad = (uint8_t)round(to_send);
 }
@@ -231,7 +181,7 @@ static void RAMPA_PEDAL_Send_Velocidad(float to_send, typedef_bus2_t* bus_can_ou
  * @param to_send           Estado de hombre muerto a enviar
  * @param bus_can_output    Puntero a estructura de tipo typedef_bus2_t (bus de salida CAN)
  */
-static void RAMPA_PEDAL_Send_HM_State(hm_state_t to_send, typedef_bus2_t* bus_can_output)
+RAMFUNC static void RAMPA_PEDAL_Send_HM_State(hm_state_t to_send, typedef_bus2_t* bus_can_output)
 {
     /* Envío a bus de salida CAN */
     switch (to_send)
@@ -0,0 +1,673 @@
+/**
+ * @file rx_timing.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Estadísticas de llegada por ID de las tramas CAN recibidas
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Cada trama recibida con ID de la tabla actualiza, en la ISR de recepción, conteo, suma de periodos, periodo
+ * mínimo y máximo, y el jitter como promedio móvil de |periodo - periodo anterior| con ganancia
+ * 1/2^RX_TIMING_JITTER_SHIFT (estimador de RFC 3550, en punto fijo). La media (división de 64 bits) se calcula
+ * solo al consultar. Las tramas con contador de secuencia actualizan además perdidas, fuera de orden y duplicadas
+ * según la distancia al contador esperado (aritmética de 8 bits). La pasada principal vuelca la tabla, una trama
+ * por trigger de transmisión, al recibir una petición de diagnóstico.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "rx_timing.h"
+
+/* Application includes */
+#include "profiler.h"
+#include "ramfunc.h"
+#include "timebase.h"
+
+/* CAN application includes */
+#include "can_def.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Entrada de la tabla directa para IDs sin estadísticas */
+#define RX_TIMING_NO_INDEX                  0xFFU
+
+/** @brief Mayor salto hacia adelante del contador de secuencia (mitad del rango de 8 bits) */
+#define RX_TIMING_SEQ_MAX_GAP               127U
+
+/** @brief Escala de la tasa de pérdida: centésimas de % */
+#define RX_TIMING_LOSS_SCALE                10000U
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tipo de dato estructura para el acumulado de llegadas de un ID (tiempos en us)
+ *
+ */
+typedef struct
+{
+    uint32_t    count;                      /**< Tramas recibidas */
+    uint32_t    last_us;                    /**< Llegada de la última trama */
+    uint32_t    period_last_us;             /**< Último periodo */
+    uint32_t    period_min_us;              /**< Periodo mínimo */
+    uint32_t    period_max_us;              /**< Periodo máximo */
+    uint32_t    jitter_scaled;              /**< Jitter por 2^RX_TIMING_JITTER_SHIFT */
+    uint64_t    period_sum_us;              /**< Suma de periodos (count - 1 periodos) */
+    uint32_t    seq_count;                  /**< Tramas con contador de secuencia */
+    uint32_t    seq_lost;                   /**< Tramas perdidas */
+    uint32_t    seq_reordered;              /**< Tramas fuera de orden */
+    uint32_t    seq_duplicates;             /**< Tramas duplicadas */
+    uint8_t     seq_expected;               /**< Próximo contador esperado (válido con seq_count > 0) */
+
+} rx_timing_entry_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief IDs con estadísticas, en el orden de CAN_APP_Store_ReceivedMessage */
+static const uint16_t rx_timing_ids[RX_TIMING_NUM_OF_IDS] = {CAN_ID_PERIFERICOS_PEDAL,
+                                                             CAN_ID_PERIFERICOS_HOMBRE_MUERTO,
+                                                             CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO,
+                                                             CAN_ID_PERIFERICOS_OK,
+                                                             CAN_ID_BMS_VOLTAJE,
+                                                             CAN_ID_BMS_CORRIENTE,
+                                                             CAN_ID_BMS_VOLTAJE_MIN_CELDA,
+                                                             CAN_ID_BMS_POTENCIA,
+                                                             CAN_ID_BMS_T_MAX,
+                                                             CAN_ID_BMS_NIVEL_BATERIA,
+                                                             CAN_ID_BMS_OK,
+                                                             CAN_ID_DCDC_VOLTAJE_BATERIA,
+                                                             CAN_ID_DCDC_VOLTAJE_SALIDA,
+                                                             CAN_ID_DCDC_T_MAX,
+                                                             CAN_ID_DCDC_POTENCIA,
+                                                             CAN_ID_DCDC_OK,
+                                                             CAN_ID_INVERSOR_VELOCIDAD,
+                                                             CAN_ID_INVERSOR_V,
+                                                             CAN_ID_INVERSOR_I,
+                                                             CAN_ID_INVERSOR_TEMP_MAX,
+                                                             CAN_ID_INVERSOR_TEMP_MOTOR,
+                                                             CAN_ID_INVERSOR_POTENCIA,
+                                                             CAN_ID_INVERSOR_OK};
+
+#if USE_RX_TIMING_FEATURE == 1
+
+/** @brief Tabla directa ID -> entrada (RX_TIMING_NO_INDEX si el ID no tiene estadísticas) */
+static uint8_t rx_timing_index[RX_TIMING_MAX_ID + 1U];
+
+/** @brief Acumulado de llegadas por entrada */
+static rx_timing_entry_t rx_timing_table[RX_TIMING_NUM_OF_IDS];
+
+/** @brief Indica un volcado en curso */
+static volatile bool export_active = false;
+
+/** @brief Entrada de la siguiente trama del volcado */
+static uint8_t export_index = 0;
+
+/** @brief Registro de la siguiente trama del volcado */
+static uint8_t export_record = 0;
+
+#endif /* USE_RX_TIMING_FEATURE */
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void RX_TIMING_Put_U24(uint8_t* buff, uint32_t value);
+static uint32_t RX_TIMING_Get_U24(const uint8_t* buff);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+#if USE_RX_TIMING_FEATURE == 1
+
+/**
+ * @brief Inicializa las estadísticas de llegada por ID.
+ *
+ * No es static, por lo que puede ser usada por otros archivos. Llamar antes de iniciar la recepción CAN.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Init(void)
+{
+    memset(rx_timing_index, RX_TIMING_NO_INDEX, sizeof(rx_timing_index));
+
+    for (uint8_t i = 0; i < RX_TIMING_NUM_OF_IDS; i++)
+    {
+        rx_timing_index[rx_timing_ids[i]] = i;
+    }
+
+    export_active = false;
+
+    RX_TIMING_Reset();
+}
+
+/**
+ * @brief Registra la llegada de una trama, desde la ISR de recepción.
+ *
+ * O(1): IDs sin estadísticas se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id        Identificador de la trama
+ * @param now_us    Marca de tiempo de llegada en us (base de tiempo)
+ * @retval None
+ */
+RAMFUNC void RX_TIMING_Record(uint32_t id, uint32_t now_us)
+{
+    rx_timing_entry_t* entry;
+    uint32_t period;
+    uint32_t delta;
+    uint8_t index;
+
+    if (id > RX_TIMING_MAX_ID)
+    {
+        return;
+    }
+
+    index = rx_timing_index[id];
+
+    if (index == RX_TIMING_NO_INDEX)
+    {
+        return;
+    }
+
+    entry = &rx_timing_table[index];
+
+    if (entry->count != 0U)
+    {
+        period = TIMEBASE_ELAPSED_US(entry->last_us, now_us);
+
+        entry->period_sum_us += period;
+
+        if (period < entry->period_min_us)
+        {
+            entry->period_min_us = period;
+        }
+
+        if (period > entry->period_max_us)
+        {
+            entry->period_max_us = period;
+        }
+
+        /* Jitter desde el segundo periodo: J += (|D| - J) / 2^SHIFT, con J escalado por 2^SHIFT */
+        if (entry->count >= 2U)
+        {
+            delta = (period > entry->period_last_us) ? (period - entry->period_last_us)
+                                                     : (entry->period_last_us - period);
+
+            entry->jitter_scaled += delta - (entry->jitter_scaled >> RX_TIMING_JITTER_SHIFT);
+        }
+
+        entry->period_last_us = period;
+    }
+
+    entry->last_us = now_us;
+    entry->count++;
+}
+
+/**
+ * @brief Registra el contador de secuencia de una trama, desde la ISR de recepción.
+ *
+ * Para tramas de módulos que traen contador (largo CAN_SEQUENCE_LENGTH, contador en CAN_SEQUENCE_BYTE). Un salto
+ * hacia adelante de hasta 127 cuenta como tramas perdidas; un contador hasta RX_TIMING_SEQ_REORDER_WINDOW atrás,
+ * como trama fuera de orden (descuenta una perdida) o duplicada (el último contador); más atrás se toma como
+ * reinicio del módulo y solo se resincroniza. O(1): IDs sin estadísticas se ignoran.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id        Identificador de la trama
+ * @param sequence  Contador de secuencia recibido
+ * @retval None
+ */
+RAMFUNC void RX_TIMING_Record_Sequence(uint32_t id, uint8_t sequence)
+{
+    rx_timing_entry_t* entry;
+    uint8_t ahead;
+    uint8_t behind;
+    uint8_t index;
+
+    if (id > RX_TIMING_MAX_ID)
+    {
+        return;
+    }
+
+    index = rx_timing_index[id];
+
+    if (index == RX_TIMING_NO_INDEX)
+    {
+        return;
+    }
+
+    entry = &rx_timing_table[index];
+
+    if (entry->seq_count++ == 0U)
+    {
+        entry->seq_expected = (uint8_t)(sequence + 1U);
+        return;
+    }
+
+    ahead = (uint8_t)(sequence - entry->seq_expected);
+    behind = (uint8_t)(entry->seq_expected - sequence);
+
+    if (ahead <= RX_TIMING_SEQ_MAX_GAP)
+    {
+        /* En orden (ahead 0) o tras ahead tramas perdidas */
+        entry->seq_lost += ahead;
+        entry->seq_expected = (uint8_t)(sequence + 1U);
+    }
+    else if (behind == 1U)
+    {
+        entry->seq_duplicates++;
+    }
+    else if (behind <= RX_TIMING_SEQ_REORDER_WINDOW)
+    {
+        /* Llega tarde una trama ya contada como perdida */
+        entry->seq_reordered++;
+
+        if (entry->seq_lost != 0U)
+        {
+            entry->seq_lost--;
+        }
+    }
+    else
+    {
+        /* Reinicio del módulo: el contador vuelve a empezar */
+        entry->seq_expected = (uint8_t)(sequence + 1U);
+    }
+}
+
+/**
+ * @brief Atiende una petición de diagnóstico (CAN_ID_CONTROL_DIAG_PETICION).
+ *
+ * RX_TIMING_CMD_DUMP inicia (o reinicia) el volcado de la tabla; RX_TIMING_CMD_RESET borra las estadísticas.
+ * Una petición sin datos (DLC 0) se ignora.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param frame     Trama de petición recibida
+ * @retval None
+ */
+void RX_TIMING_Request(const can_frame_t* frame)
+{
+    uint32_t primask;
+
+    /* Sin datos, el byte 0 es lo que quedó de la trama anterior en el objeto de recepción */
+    if (frame->payload_length == 0U)
+    {
+        return;
+    }
+
+    /* El comando es el byte 0 */
+    switch (frame->payload_buff[0])
+    {
+    case RX_TIMING_CMD_DUMP:
+        primask = __get_PRIMASK();
+        __disable_irq();
+
+        export_index = 0;
+        export_record = 0;
+        export_active = true;
+
+        __set_PRIMASK(primask);
+        break;
+    case RX_TIMING_CMD_RESET:
+        RX_TIMING_Reset();
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Reinicia las estadísticas de llegada por ID.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    /* Con FreeRTOS la petición llega en una tarea: la ISR de recepción no debe ver la tabla a medio borrar */
+    __disable_irq();
+
+    memset(rx_timing_table, 0, sizeof(rx_timing_table));
+
+    for (uint8_t i = 0; i < RX_TIMING_NUM_OF_IDS; i++)
+    {
+        rx_timing_table[i].period_min_us = UINT32_MAX;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Retorna las estadísticas de una entrada de la tabla.
+ *
+ * @param index     Entrada [0:RX_TIMING_NUM_OF_IDS-1]
+ * @param now_us    Valor actual de la base de tiempo en us (para la edad de la última trama)
+ * @param stats     Estadísticas a completar
+ * @retval true     Entrada válida
+ * @retval false    Entrada fuera de la tabla
+ */
+bool RX_TIMING_Get_Stats(uint8_t index, uint32_t now_us, rx_timing_stats_t* stats)
+{
+    rx_timing_entry_t entry;
+    uint32_t primask;
+
+    if (index >= RX_TIMING_NUM_OF_IDS)
+    {
+        return false;
+    }
+
+    /* Copia consistente: la ISR de recepción actualiza la entrada */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    entry = rx_timing_table[index];
+
+    __set_PRIMASK(primask);
+
+    memset(stats, 0, sizeof(*stats));
+
+    stats->id = rx_timing_ids[index];
+    stats->count = entry.count;
+
+    if (entry.count >= 2U)
+    {
+        stats->period_mean_us = (uint32_t)(entry.period_sum_us / (entry.count - 1U));
+        stats->period_min_us = entry.period_min_us;
+        stats->period_max_us = entry.period_max_us;
+        stats->jitter_us = entry.jitter_scaled >> RX_TIMING_JITTER_SHIFT;
+    }
+
+    if (entry.count != 0U)
+    {
+        stats->age_us = TIMEBASE_ELAPSED_US(entry.last_us, now_us);
+    }
+
+    stats->seq_count = entry.seq_count;
+    stats->seq_lost = entry.seq_lost;
+    stats->seq_reordered = entry.seq_reordered;
+    stats->seq_duplicates = entry.seq_duplicates;
+    stats->loss_rate = RX_TIMING_Loss_Rate(entry.seq_count - entry.seq_duplicates, entry.seq_lost);
+
+    return true;
+}
+
+/**
+ * @brief Prepara la trama del volcado en curso.
+ *
+ * No avanza el volcado: avanzar con RX_TIMING_Export_Done una vez que la trama quedó en mailbox.
+ *
+ * @param frame     Trama CAN a completar (id, largo y datos)
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval true     Hay un volcado en curso y la trama quedó preparada
+ * @retval false    Sin volcado en curso
+ */
+bool RX_TIMING_Export_Next(can_frame_t* frame, uint32_t now_us)
+{
+    rx_timing_stats_t stats;
+    uint8_t index;
+    uint8_t record;
+    uint32_t primask;
+
+    if (!export_active)
+    {
+        return false;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    index = export_index;
+    record = export_record;
+
+    __set_PRIMASK(primask);
+
+    RX_TIMING_Get_Stats(index, now_us, &stats);
+
+    frame->id = CAN_ID_CONTROL_DIAG_RECEPCION;
+    frame->payload_length = RX_TIMING_Encode_Frame(&stats, record, frame->payload_buff);
+
+    return true;
+}
+
+/**
+ * @brief Avanza el volcado en curso al siguiente registro; termina tras el último registro del último ID.
+ *
+ * @param None
+ * @retval None
+ */
+void RX_TIMING_Export_Done(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    export_record++;
+
+    if (export_record >= RX_TIMING_RECORDS_PER_ID)
+    {
+        export_record = 0;
+        export_index++;
+
+        if (export_index >= RX_TIMING_NUM_OF_IDS)
+        {
+            export_index = 0;
+            export_active = false;
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+#endif /* USE_RX_TIMING_FEATURE */
+
+/**
+ * @brief Codifica un registro de las estadísticas de un ID en una trama de volcado.
+ *
+ * Formato (little-endian): byte 0 ID, byte 1 registro, bytes 2-7 datos.
+ *  - Registro 0: conteo (u24), periodo medio (u24)
+ *  - Registro 1: periodo mínimo (u24), periodo máximo (u24)
+ *  - Registro 2: jitter (u24), edad de la última trama (u24)
+ *  - Registro 3: tramas con contador de secuencia (u24), perdidas (u24)
+ *  - Registro 4: fuera de orden (u24), duplicadas (u24)
+ * Los campos saturan en 0xFFFFFF.
+ *
+ * @param stats     Estadísticas del ID
+ * @param record    Registro a codificar [0:RX_TIMING_RECORDS_PER_ID-1]
+ * @param payload   Buffer de RX_TIMING_FRAME_LENGTH bytes
+ * @return uint8_t  Largo de la trama
+ */
+uint8_t RX_TIMING_Encode_Frame(const rx_timing_stats_t* stats, uint8_t record, uint8_t* payload)
+{
+    memset(payload, 0, RX_TIMING_FRAME_LENGTH);
+
+    payload[0] = (uint8_t)stats->id;
+    payload[1] = record;
+
+    if (record == 0)
+    {
+        RX_TIMING_Put_U24(&payload[2], stats->count);
+        RX_TIMING_Put_U24(&payload[5], stats->period_mean_us);
+    }
+    else if (record == 1)
+    {
+        RX_TIMING_Put_U24(&payload[2], stats->period_min_us);
+        RX_TIMING_Put_U24(&payload[5], stats->period_max_us);
+    }
+    else if (record == 2)
+    {
+        RX_TIMING_Put_U24(&payload[2], stats->jitter_us);
+        RX_TIMING_Put_U24(&payload[5], stats->age_us);
+    }
+    else if (record == 3)
+    {
+        RX_TIMING_Put_U24(&payload[2], stats->seq_count);
+        RX_TIMING_Put_U24(&payload[5], stats->seq_lost);
+    }
+    else
+    {
+        RX_TIMING_Put_U24(&payload[2], stats->seq_reordered);
+        RX_TIMING_Put_U24(&payload[5], stats->seq_duplicates);
+    }
+
+    return RX_TIMING_FRAME_LENGTH;
+}
+
+/**
+ * @brief Decodifica una trama de volcado en las estadísticas de su ID.
+ *
+ * Solo actualiza los campos presentes en el registro recibido.
+ *
+ * @param payload   Trama recibida
+ * @param length    Largo de la trama
+ * @param stats     Arreglo de RX_TIMING_NUM_OF_IDS estadísticas, en el orden de la tabla
+ * @retval true     Trama válida
+ * @retval false    Trama inválida
+ */
+bool RX_TIMING_Decode_Frame(const uint8_t* payload, uint8_t length, rx_timing_stats_t* stats)
+{
+    uint8_t record = payload[1];
+    rx_timing_stats_t* st = NULL;
+
+    if (length != RX_TIMING_FRAME_LENGTH || record >= RX_TIMING_RECORDS_PER_ID)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < RX_TIMING_NUM_OF_IDS; i++)
+    {
+        if (rx_timing_ids[i] == payload[0])
+        {
+            st = &stats[i];
+            break;
+        }
+    }
+
+    if (st == NULL)
+    {
+        return false;
+    }
+
+    st->id = payload[0];
+
+    if (record == 0)
+    {
+        st->count = RX_TIMING_Get_U24(&payload[2]);
+        st->period_mean_us = RX_TIMING_Get_U24(&payload[5]);
+    }
+    else if (record == 1)
+    {
+        st->period_min_us = RX_TIMING_Get_U24(&payload[2]);
+        st->period_max_us = RX_TIMING_Get_U24(&payload[5]);
+    }
+    else if (record == 2)
+    {
+        st->jitter_us = RX_TIMING_Get_U24(&payload[2]);
+        st->age_us = RX_TIMING_Get_U24(&payload[5]);
+    }
+    else if (record == 3)
+    {
+        st->seq_count = RX_TIMING_Get_U24(&payload[2]);
+        st->seq_lost = RX_TIMING_Get_U24(&payload[5]);
+    }
+    else
+    {
+        st->seq_reordered = RX_TIMING_Get_U24(&payload[2]);
+        st->seq_duplicates = RX_TIMING_Get_U24(&payload[5]);
+    }
+
+    if (record >= 3U && st->seq_duplicates <= st->seq_count)
+    {
+        st->loss_rate = RX_TIMING_Loss_Rate(st->seq_count - st->seq_duplicates, st->seq_lost);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Tasa de pérdida en centésimas de % (10000 = 100 %).
+ *
+ * @param received  Tramas distintas recibidas con contador (sin duplicadas)
+ * @param lost      Tramas perdidas
+ * @return uint16_t Pérdidas sobre recibidas más perdidas
+ */
+uint16_t RX_TIMING_Loss_Rate(uint32_t received, uint32_t lost)
+{
+    uint64_t total = (uint64_t)received + lost;
+
+    if (total == 0U)
+    {
+        return 0;
+    }
+
+    return (uint16_t)(((uint64_t)lost * RX_TIMING_LOSS_SCALE + total / 2U) / total);
+}
+
+/**
+ * @brief Retorna el ID de una entrada de la tabla (para herramientas de diagnóstico).
+ *
+ * @param index     Entrada [0:RX_TIMING_NUM_OF_IDS-1]
+ * @return uint32_t ID, 0 si la entrada está fuera de la tabla
+ */
+uint32_t RX_TIMING_Get_Id(uint8_t index)
+{
+    if (index >= RX_TIMING_NUM_OF_IDS)
+    {
+        return 0;
+    }
+
+    return rx_timing_ids[index];
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Escribe un valor de 24 bits little-endian, saturado.
+ *
+ * @param buff      Buffer destino (3 bytes)
+ * @param value     Valor a escribir
+ * @retval None
+ */
+static void RX_TIMING_Put_U24(uint8_t* buff, uint32_t value)
+{
+    if (value > PROFILER_U24_MAX)
+    {
+        value = PROFILER_U24_MAX;
+    }
+
+    buff[0] = (uint8_t)(value & 0xFF);
+    buff[1] = (uint8_t)((value >> 8) & 0xFF);
+    buff[2] = (uint8_t)((value >> 16) & 0xFF);
+}
+
+/**
+ * @brief Lee un valor de 24 bits little-endian.
+ *
+ * @param buff      Buffer fuente (3 bytes)
+ * @return uint32_t Valor leído
+ */
+static uint32_t RX_TIMING_Get_U24(const uint8_t* buff)
+{
+    return (uint32_t)buff[0] | ((uint32_t)buff[1] << 8) | ((uint32_t)buff[2] << 16);
+}
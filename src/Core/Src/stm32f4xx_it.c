@@ -22,6 +22,14 @@
 #include "stm32f4xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "profiler.h"
+#include "app_rtos.h"
+#include "idle.h"
+
+#if USE_FREERTOS_FEATURE == 1
+#include "FreeRTOS.h"
+#include "task.h"
+#endif /* USE_FREERTOS_FEATURE */
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -46,7 +54,10 @@
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
-
+#if USE_FREERTOS_FEATURE == 1
+/* Tick del port ARM_CM4F (port.c) */
+extern void xPortSysTickHandler(void);
+#endif /* USE_FREERTOS_FEATURE */
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -139,19 +150,6 @@ void UsageFault_Handler(void)
   }
 }
 
-/**
-  * @brief This function handles System service call via SWI instruction.
-  */
-void SVC_Handler(void)
-{
-  /* USER CODE BEGIN SVCall_IRQn 0 */
-
-  /* USER CODE END SVCall_IRQn 0 */
-  /* USER CODE BEGIN SVCall_IRQn 1 */
-
-  /* USER CODE END SVCall_IRQn 1 */
-}
-
 /**
   * @brief This function handles Debug monitor.
   */
@@ -165,19 +163,6 @@ void DebugMon_Handler(void)
   /* USER CODE END DebugMonitor_IRQn 1 */
 }
 
-/**
-  * @brief This function handles Pendable request for system service.
-  */
-void PendSV_Handler(void)
-{
-  /* USER CODE BEGIN PendSV_IRQn 0 */
-
-  /* USER CODE END PendSV_IRQn 0 */
-  /* USER CODE BEGIN PendSV_IRQn 1 */
-
-  /* USER CODE END PendSV_IRQn 1 */
-}
-
 /**
   * @brief This function handles System tick timer.
   */
@@ -188,7 +173,17 @@ void SysTick_Handler(void)
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
-
+#if USE_WFI_IDLE_FEATURE == 1
+  /* Trabajo temporizado de la superloop */
+  IDLE_Tick_FromISR();
+#endif /* USE_WFI_IDLE_FEATURE */
+#if USE_FREERTOS_FEATURE == 1
+  /* SysTick es también el tick de FreeRTOS (misma frecuencia de 1 kHz) */
+  if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    xPortSysTickHandler();
+  }
+#endif /* USE_FREERTOS_FEATURE */
   /* USER CODE END SysTick_IRQn 1 */
 }
 
@@ -205,11 +200,12 @@ void SysTick_Handler(void)
 void CAN1_RX0_IRQHandler(void)
 {
   /* USER CODE BEGIN CAN1_RX0_IRQn 0 */
-
+  PROFILER_ISR_PROBE_LATENCY(kPROFILER_STAGE_LAT_CAN1_RX0);
+  PROFILER_ISR_ENTER();
   /* USER CODE END CAN1_RX0_IRQn 0 */
   HAL_CAN_IRQHandler(&hcan1);
   /* USER CODE BEGIN CAN1_RX0_IRQn 1 */
-
+  PROFILER_ISR_EXIT(kPROFILER_STAGE_ISR_CAN1_RX0);
   /* USER CODE END CAN1_RX0_IRQn 1 */
 }
 
@@ -219,15 +215,35 @@ void CAN1_RX0_IRQHandler(void)
 void TIM7_IRQHandler(void)
 {
   /* USER CODE BEGIN TIM7_IRQn 0 */
+  PROFILER_ISR_TIMER_LATENCY(kPROFILER_STAGE_LAT_TIM7, TIM7);
+  PROFILER_ISR_ENTER();
 
+  /* Sonda: la recepción CAN debe interrumpir a esta ISR (ver irq_priority.h) */
+  PROFILER_ISR_PROBE(CAN1_RX0_IRQn);
   /* USER CODE END TIM7_IRQn 0 */
   HAL_TIM_IRQHandler(&htim7);
   /* USER CODE BEGIN TIM7_IRQn 1 */
-
+  PROFILER_ISR_EXIT(kPROFILER_STAGE_ISR_TIM7);
   /* USER CODE END TIM7_IRQn 1 */
 }
 
 /* USER CODE BEGIN 1 */
+#if USE_FREERTOS_FEATURE == 0
+/* CubeMX no genera SVC_Handler ni PendSV_Handler (Control.ioc): con FreeRTOS son los del port (FreeRTOSConfig.h) */
 
+/**
+  * @brief This function handles System service call via SWI instruction.
+  */
+void SVC_Handler(void)
+{
+}
+
+/**
+  * @brief This function handles Pendable request for system service.
+  */
+void PendSV_Handler(void)
+{
+}
+#endif /* USE_FREERTOS_FEATURE */
 /* USER CODE END 1 */
 
@@ -0,0 +1,57 @@
+/**
+ * @file timebase.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Base de tiempo libre de 32 bits en us sobre TIM2
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "timebase.h"
+
+/* Application includes */
+#include "ramfunc.h"
+
+/* STM32 HAL include */
+#include "tim.h"
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Configura e inicia la base de tiempo (parte en 0).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param None
+ * @retval None
+ */
+void TIMEBASE_Init(void)
+{
+    /* TIM2 cuenta a 1 MHz hasta 0xFFFFFFFF, sin interrupción */
+    MX_TIM2_Init();
+
+    if (HAL_TIM_Base_Start(&htim2) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
+
+/**
+ * @brief Retorna el valor actual de la base de tiempo en us.
+ *
+ * Puede llamarse desde ISRs.
+ *
+ * @return uint32_t
+ */
+RAMFUNC uint32_t TIMEBASE_Get_Us(void)
+{
+    return TIM2->CNT;
+}
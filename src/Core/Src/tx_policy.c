@@ -0,0 +1,94 @@
+/**
+ * @file tx_policy.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Política de transmisión por cambio con banda muerta e intervalos mínimo y máximo
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "tx_policy.h"
+
+/* Application includes */
+#include "ramfunc.h"
+#include "timebase.h"
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicia el estado de transmisión de una señal.
+ *
+ * El valor actual queda como enviado: la señal sale con su próximo cambio o, sin cambios, first_us después (se
+ * satura en el intervalo máximo; sin intervalo máximo solo sale por cambio).
+ *
+ * @param config    Política de la señal
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor actual de la señal
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @param first_us  Tiempo hasta el primer reenvío en us
+ * @retval None
+ */
+void TX_POLICY_Start(const tx_policy_config_t* config, tx_policy_state_t* state, uint8_t value, uint32_t now_us,
+                     uint32_t first_us)
+{
+    if (first_us > config->max_interval_us)
+    {
+        first_us = config->max_interval_us;
+    }
+
+    /* Último envío ficticio de modo que el intervalo máximo se cumpla en first_us */
+    TX_POLICY_Sent(state, value, now_us - config->max_interval_us + first_us);
+}
+
+/**
+ * @brief Retorna si una señal debe enviarse ahora según su política.
+ *
+ * @param config    Política de la señal
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor actual de la señal
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval true     Enviar (cambio fuera de la banda muerta con el intervalo mínimo cumplido o intervalo máximo
+ *                  cumplido)
+ * @retval false    No enviar
+ */
+RAMFUNC bool TX_POLICY_Is_Due(const tx_policy_config_t* config, const tx_policy_state_t* state, uint8_t value,
+                              uint32_t now_us)
+{
+    uint8_t change;
+
+    if (config->max_interval_us != 0U && TIMEBASE_IS_EXPIRED(state->last_us, now_us, config->max_interval_us))
+    {
+        return true;
+    }
+
+    change = (value > state->value) ? (uint8_t)(value - state->value) : (uint8_t)(state->value - value);
+
+    if (change <= config->deadband)
+    {
+        return false;
+    }
+
+    return TIMEBASE_IS_EXPIRED(state->last_us, now_us, config->min_interval_us);
+}
+
+/**
+ * @brief Registra el envío de una señal (solo si la trama quedó en mailbox).
+ *
+ * @param state     Estado de transmisión de la señal
+ * @param value     Valor enviado
+ * @param now_us    Valor actual de la base de tiempo en us
+ * @retval None
+ */
+RAMFUNC void TX_POLICY_Sent(tx_policy_state_t* state, uint8_t value, uint32_t now_us)
+{
+    state->value = value;
+    state->last_us = now_us;
+}
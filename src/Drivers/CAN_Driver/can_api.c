@@ -102,8 +102,11 @@ can_status_t CAN_API_Read_Message( CAN_t *obj)
     can_status_t status;
 
     status = obj->Fn_Read_Can_Data( &obj->Frame.id,
+                                    &obj->Frame.DLC,
                                     obj->Frame.payload_buff);
 
+    obj->Frame.payload_length = (obj->Frame.DLC > PAYLOAD_MAX_LENGTH) ? PAYLOAD_MAX_LENGTH : obj->Frame.DLC;
+
     return status;
 }
 
@@ -96,7 +96,7 @@ typedef can_status_t (*send_can_data_t)(uint32_t, uint8_t, uint8_t, uint8_t, uin
  * @brief CAN read data driver function type declaration
  *
  */
-typedef can_status_t (*read_can_data_t)(uint32_t *, uint8_t *);
+typedef can_status_t (*read_can_data_t)(uint32_t *, uint8_t *, uint8_t *);
 
 /**
  * @brief CAN get message count driver function type declaration
@@ -178,11 +178,4 @@ can_status_t CAN_API_Read_Message( CAN_t *obj);
  */
 can_status_t CAN_API_Get_Message_Count( CAN_t *obj);
 
-/***********************************************************************************************************************
- * Global variables declarations
- **********************************************************************************************************************/
-
-/** @brief CAN structure instance */
-extern CAN_t can_obj;
-
 #endif /* _CAN_API_H_ */
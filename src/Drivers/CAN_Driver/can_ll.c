@@ -0,0 +1,150 @@
+/**
+ * @file can_ll.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Implementación backend CAN de bajo nivel (registros bxCAN) para tarjeta Control
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "can_ll.h"
+
+/* Application includes */
+#include "ramfunc.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Bits de mailbox de transmisión vacío */
+#define CAN_LL_TSR_TME_ALL          (CAN_TSR_TME0 | CAN_TSR_TME1 | CAN_TSR_TME2)
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Función inicialización de periférico CAN (la misma del wrapper HAL).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param   None
+ * @retval  can_status_t
+ */
+can_status_t CAN_LL_Init(void)
+{
+	/* Inicialización no crítica en tiempo: CAN1, filtros, notificación de FIFO 0 y TIM7 como en el wrapper HAL */
+	return CAN_Wrapper_Init();
+}
+
+/**
+ * @brief Función transmisión de datos CAN escribiendo los registros del primer mailbox libre.
+ *
+ * Respeta ide y rtr como can_socketcan.c: con EXTENDED_FRAME id es el identificador de 29 bits (EXID e IDE en
+ * TIR) y con RTR_MSG la trama es remota (RTR en TIR, dlc es el largo pedido y data no se transmite).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id Standard or extended identifier
+ * @param ide Type of identifier
+ * @param rtr Type of frame
+ * @param dlc Length of frame
+ * @param data Data to transmit (se leen siempre PAYLOAD_MAX_LENGTH bytes)
+ * @retval CAN_STATUS_OK        Trama en mailbox
+ * @retval CAN_STATUS_ERROR     Los tres mailbox están ocupados
+ */
+RAMFUNC can_status_t CAN_LL_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data)
+{
+	CAN_TypeDef* can = CAN_LL_INSTANCE;
+	uint32_t tsr = can->TSR;
+	CAN_TxMailBox_TypeDef* mailbox;
+	uint32_t tir;
+
+	if ((tsr & CAN_LL_TSR_TME_ALL) == 0U)
+	{
+		return CAN_STATUS_ERROR;
+	}
+
+	/* Con algún mailbox vacío, CODE indica el siguiente libre (sin búsqueda) */
+	mailbox = &can->sTxMailBox[(tsr & CAN_TSR_CODE) >> CAN_TSR_CODE_Pos];
+
+	/* Largo sin marca de tiempo global, datos en dos palabras (payload_buff no está alineado a 4) */
+	mailbox->TDTR = (uint32_t)dlc & CAN_TDT0R_DLC;
+	mailbox->TDLR = __UNALIGNED_UINT32_READ(&data[0]);
+	mailbox->TDHR = __UNALIGNED_UINT32_READ(&data[4]);
+
+	/* Identificador estándar (STID) o extendido (STID:EXID, 29 bits desde el bit 3) */
+	tir = (ide == EXTENDED_FRAME) ? (((id << CAN_TI0R_EXID_Pos) & (CAN_TI0R_STID | CAN_TI0R_EXID)) | CAN_TI0R_IDE)
+	                              : ((id << CAN_TI0R_STID_Pos) & CAN_TI0R_STID);
+
+	if (rtr == RTR_MSG)
+	{
+		tir |= CAN_TI0R_RTR;
+	}
+
+	/* TXRQ en la misma escritura inicia la transmisión */
+	mailbox->TIR = tir | CAN_TI0R_TXRQ;
+
+	return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Función recepción de datos CAN leyendo los registros de la FIFO 0.
+ *
+ * Libera la trama de la FIFO. La interfaz de lectura no entrega IDE ni RTR: una trama extendida entrega su
+ * identificador de 29 bits (como can_socketcan.c) y una remota su DLC con los datos que tenga el mailbox. Los
+ * filtros de CAN_Wrapper_Init solo aceptan tramas estándar.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id Received identifier
+ * @param dlc Received length of frame
+ * @param data Received data (se escriben siempre PAYLOAD_MAX_LENGTH bytes)
+ * @retval CAN_STATUS_OK        Trama leída
+ * @retval CAN_STATUS_ERROR     FIFO 0 vacía
+ */
+RAMFUNC can_status_t CAN_LL_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data)
+{
+	CAN_TypeDef* can = CAN_LL_INSTANCE;
+	CAN_FIFOMailBox_TypeDef* mailbox = &can->sFIFOMailBox[CAN_RX_FIFO0];
+	uint32_t rir;
+
+	if ((can->RF0R & CAN_RF0R_FMP0) == 0U)
+	{
+		return CAN_STATUS_ERROR;
+	}
+
+	/* Received standard or extended identifier */
+	rir = mailbox->RIR;
+	*id = (rir & CAN_RI0R_IDE) ? ((rir & (CAN_RI0R_STID | CAN_RI0R_EXID)) >> CAN_RI0R_EXID_Pos)
+	                           : ((rir & CAN_RI0R_STID) >> CAN_RI0R_STID_Pos);
+
+	/* Received length of frame */
+	*dlc = (uint8_t)((mailbox->RDTR & CAN_RDT0R_DLC) >> CAN_RDT0R_DLC_Pos);
+
+	__UNALIGNED_UINT32_WRITE(&data[0], mailbox->RDLR);
+	__UNALIGNED_UINT32_WRITE(&data[4], mailbox->RDHR);
+
+	/* Libera la trama; escribir 0 en FULL0/FOVR0 (rc_w1) no borra esas banderas */
+	can->RF0R = CAN_RF0R_RFOM0;
+
+	return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Función conteo dato recibido por CAN.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @return can_status_t
+ */
+can_status_t CAN_LL_DataCount(void)
+{
+	return CAN_STATUS_OK;
+}
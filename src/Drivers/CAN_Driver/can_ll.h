@@ -0,0 +1,96 @@
+/**
+ * @file can_ll.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para can_ll.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Backend CAN de bajo nivel: misma interfaz que can_wrapper.h (se registra con CAN_API_Init), pero la transmisión
+ * y la recepción escriben y leen directamente los registros de mailbox del bxCAN (TIR/TDTR/TDLR/TDHR y
+ * RIR/RDLR/RDHR) con copias de palabras de 32 bits, sin pasar por HAL_CAN_AddTxMessage ni HAL_CAN_GetRxMessage.
+ * La inicialización (bit timing, filtros, interrupciones y TIM7) es la del wrapper HAL.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _CAN_LL_H_
+#define _CAN_LL_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* CAN driver include */
+#include "can_api.h"
+#include "can_wrapper.h"
+
+/* STM32 HAL include */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Periférico bxCAN usado */
+#define CAN_LL_INSTANCE                     CAN1
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Función inicialización de periférico CAN (la misma del wrapper HAL).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param   None
+ * @retval  can_status_t
+ */
+can_status_t CAN_LL_Init(void);
+
+/**
+ * @brief Función transmisión de datos CAN escribiendo los registros del primer mailbox libre.
+ *
+ * Respeta ide y rtr como can_socketcan.c: con EXTENDED_FRAME id es el identificador de 29 bits (EXID e IDE en
+ * TIR) y con RTR_MSG la trama es remota (RTR en TIR, dlc es el largo pedido y data no se transmite).
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id Standard or extended identifier
+ * @param ide Type of identifier
+ * @param rtr Type of frame
+ * @param dlc Length of frame
+ * @param data Data to transmit (se leen siempre PAYLOAD_MAX_LENGTH bytes)
+ * @retval CAN_STATUS_OK        Trama en mailbox
+ * @retval CAN_STATUS_ERROR     Los tres mailbox están ocupados
+ */
+can_status_t CAN_LL_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data);
+
+/**
+ * @brief Función recepción de datos CAN leyendo los registros de la FIFO 0.
+ *
+ * Libera la trama de la FIFO. La interfaz de lectura no entrega IDE ni RTR: una trama extendida entrega su
+ * identificador de 29 bits (como can_socketcan.c) y una remota su DLC con los datos que tenga el mailbox. Los
+ * filtros de CAN_Wrapper_Init solo aceptan tramas estándar.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @param id Received identifier
+ * @param dlc Received length of frame
+ * @param data Received data (se escriben siempre PAYLOAD_MAX_LENGTH bytes)
+ * @retval CAN_STATUS_OK        Trama leída
+ * @retval CAN_STATUS_ERROR     FIFO 0 vacía
+ */
+can_status_t CAN_LL_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data);
+
+/**
+ * @brief Función conteo dato recibido por CAN.
+ *
+ * No es static, por lo que puede ser usada por otros archivos.
+ *
+ * @return can_status_t
+ */
+can_status_t CAN_LL_DataCount(void);
+
+#endif /* _CAN_LL_H_ */
@@ -0,0 +1,289 @@
+/**
+ * @file can_socketcan.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Implementación SocketCAN (Linux) de las funciones del driver CAN_t
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Alternativa a can_wrapper.c para ejecutar la aplicación de Control como proceso en Linux sobre
+ * vcan0 o una interfaz CAN real. Solo compila en host (Host/Makefile); no forma parte del proyecto
+ * de STM32CubeIDE.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "can_socketcan.h"
+
+/* Linux includes */
+#include <errno.h>
+#include <fcntl.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Máscara de filtros: bits 10..3 del identificador, solo tramas estándar de datos */
+#define CAN_SOCKETCAN_FILTER_MASK           (0x7F8U | CAN_EFF_FLAG | CAN_RTR_FLAG)
+
+/** @brief Número de filtros de recepción */
+#define CAN_SOCKETCAN_NUM_OF_FILTERS        4
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Nombre de interfaz */
+static char ifname[IFNAMSIZ] = CAN_SOCKETCAN_DEFAULT_IFNAME;
+
+/** @brief Descriptor de socket */
+static int sock = -1;
+
+/** @brief Trama en entrega */
+static struct can_frame rx_frame;
+
+/** @brief Estadísticas */
+static can_socketcan_stats_t stats;
+
+/** @brief Filtros de recepción: mismos rangos que los filtros de hardware (ver can_wrapper.c) */
+static const struct can_filter rx_filters[CAN_SOCKETCAN_NUM_OF_FILTERS] =
+{
+    {0x000, CAN_SOCKETCAN_FILTER_MASK},     /* Control y Periféricos */
+    {0x020, CAN_SOCKETCAN_FILTER_MASK},     /* BMS */
+    {0x030, CAN_SOCKETCAN_FILTER_MASK},     /* DCDC */
+    {0x040, CAN_SOCKETCAN_FILTER_MASK}      /* Inversor */
+};
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Define la interfaz SocketCAN a usar (antes de CAN_SocketCAN_Init).
+ *
+ * @param name      Nombre de interfaz (p. ej. "vcan0" o "can0")
+ * @retval None
+ */
+void CAN_SocketCAN_Set_Interface(const char* name)
+{
+    strncpy(ifname, name, sizeof(ifname) - 1);
+    ifname[sizeof(ifname) - 1] = '\0';
+}
+
+/**
+ * @brief Función inicialización de socket CAN_RAW no bloqueante.
+ *
+ * Aplica los mismos filtros de recepción que los filtros de hardware de la tarjeta y habilita
+ * marcas de tiempo de recepción del kernel y contador de descartes.
+ *
+ * @param None
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_Init(void)
+{
+    struct sockaddr_can addr;
+    struct ifreq ifr;
+    const int enable = 1;
+
+    memset(&stats, 0, sizeof(stats));
+
+    sock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+    if (sock < 0)
+    {
+        return CAN_STATUS_ERROR;
+    }
+
+    /* ifname siempre termina en '\0' y tiene el largo de ifr_name */
+    memset(&ifr, 0, sizeof(ifr));
+    memcpy(ifr.ifr_name, ifname, sizeof(ifr.ifr_name));
+
+    if (ioctl(sock, SIOCGIFINDEX, &ifr) < 0)
+    {
+        close(sock);
+        sock = -1;
+
+        return CAN_STATUS_ERROR;
+    }
+
+    /* Filtros, marcas de tiempo del kernel y contador de descartes de la cola del socket */
+    setsockopt(sock, SOL_CAN_RAW, CAN_RAW_FILTER, rx_filters, sizeof(rx_filters));
+    setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable));
+    setsockopt(sock, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        close(sock);
+        sock = -1;
+
+        return CAN_STATUS_ERROR;
+    }
+
+    fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+
+    return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Función transmisión de trama (no bloqueante).
+ *
+ * @param id        Identificador
+ * @param ide       Tipo de identificador
+ * @param rtr       Tipo de trama
+ * @param dlc       Largo
+ * @param data      Datos
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data)
+{
+    struct can_frame frame;
+
+    memset(&frame, 0, sizeof(frame));
+
+    frame.can_id = (ide == EXTENDED_FRAME) ? ((id & CAN_EFF_MASK) | CAN_EFF_FLAG) : (id & CAN_SFF_MASK);
+    frame.can_id |= (rtr == RTR_MSG) ? CAN_RTR_FLAG : 0;
+    frame.can_dlc = (dlc > CAN_MAX_DLEN) ? CAN_MAX_DLEN : dlc;
+
+    memcpy(frame.data, data, frame.can_dlc);
+
+    if (sock < 0 || write(sock, &frame, sizeof(frame)) != (ssize_t)sizeof(frame))
+    {
+        stats.tx_errors++;
+
+        return CAN_STATUS_ERROR;
+    }
+
+    stats.tx_frames++;
+
+    return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Función lectura de la trama recibida que se está entregando.
+ *
+ * @param id        Identificador leído
+ * @param dlc       Largo leído
+ * @param data      Datos leídos (PAYLOAD_MAX_LENGTH bytes)
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data)
+{
+    *id = rx_frame.can_id & ((rx_frame.can_id & CAN_EFF_FLAG) ? CAN_EFF_MASK : CAN_SFF_MASK);
+    *dlc = rx_frame.can_dlc;
+
+    memcpy(data, rx_frame.data, PAYLOAD_MAX_LENGTH);
+
+    return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Función número de mensajes.
+ *
+ * @param None
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_DataCount(void)
+{
+    return CAN_STATUS_OK;
+}
+
+/**
+ * @brief Lee sin bloquear las tramas disponibles en el socket.
+ *
+ * Por cada trama llama a rx_pending con la marca de tiempo de recepción del kernel (CLOCK_REALTIME, ns).
+ * Lee como máximo CAN_SOCKETCAN_POLL_BUDGET tramas por llamada.
+ *
+ * @param rx_pending    Función llamada por cada trama
+ * @return uint32_t     Tramas leídas
+ */
+uint32_t CAN_SocketCAN_Poll(can_socketcan_rx_pending_t rx_pending)
+{
+    uint32_t count = 0;
+
+    while (sock >= 0 && count < CAN_SOCKETCAN_POLL_BUDGET)
+    {
+        char control[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(uint32_t))];
+        struct iovec iov = {&rx_frame, sizeof(rx_frame)};
+        struct msghdr msg;
+        struct cmsghdr* cmsg;
+        uint64_t timestamp_ns = 0;
+        ssize_t nbytes;
+
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        nbytes = recvmsg(sock, &msg, 0);
+
+        if (nbytes < (ssize_t)sizeof(struct can_frame))
+        {
+            /* EAGAIN: no hay más tramas */
+            break;
+        }
+
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMPNS)
+            {
+                struct timespec ts;
+
+                memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                timestamp_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+            }
+            else if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+            {
+                /* Contador acumulado de descartes del kernel */
+                memcpy(&stats.rx_dropped, CMSG_DATA(cmsg), sizeof(uint32_t));
+            }
+        }
+
+        stats.rx_frames++;
+        count++;
+
+        if (rx_pending != NULL)
+        {
+            rx_pending(timestamp_ns);
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Retorna el descriptor del socket (para esperar con poll/select), -1 si no está abierto.
+ *
+ * @return int
+ */
+int CAN_SocketCAN_Get_Fd(void)
+{
+    return sock;
+}
+
+/**
+ * @brief Retorna estadísticas del backend.
+ *
+ * @param out       Estadísticas a completar
+ * @retval None
+ */
+void CAN_SocketCAN_Get_Stats(can_socketcan_stats_t* out)
+{
+    *out = stats;
+}
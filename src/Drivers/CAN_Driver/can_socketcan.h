@@ -0,0 +1,139 @@
+/**
+ * @file can_socketcan.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Archivo header para can_socketcan.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _CAN_SOCKETCAN_H_
+#define _CAN_SOCKETCAN_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+/* CAN driver include */
+#include "can_api.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Interfaz SocketCAN por defecto */
+#define CAN_SOCKETCAN_DEFAULT_IFNAME        "vcan0"
+
+/** @brief Bitrate del bus en bit/s (el de MX_CAN1_Init; vcan no tiene bitrate, can0 se configura con ip link) */
+#define CAN_SOCKETCAN_BITRATE               250000U
+
+/** @brief Tramas leídas como máximo por llamada a CAN_SocketCAN_Poll */
+#define CAN_SOCKETCAN_POLL_BUDGET           64
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Función llamada por cada trama recibida (equivalente a la ISR de recepción)
+ *
+ * Dentro de la función, CAN_SocketCAN_ReceiveData entrega la trama recibida.
+ *
+ */
+typedef void (*can_socketcan_rx_pending_t)(uint64_t timestamp_ns);
+
+/**
+ * @brief Estadísticas del backend SocketCAN
+ *
+ */
+typedef struct
+{
+    uint32_t    rx_frames;          /**< Tramas recibidas */
+    uint32_t    rx_dropped;         /**< Tramas descartadas por el kernel (cola de socket llena, SO_RXQ_OVFL) */
+    uint32_t    tx_frames;          /**< Tramas transmitidas */
+    uint32_t    tx_errors;          /**< Tramas no transmitidas (cola de interfaz llena u otro error) */
+
+} can_socketcan_stats_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Define la interfaz SocketCAN a usar (antes de CAN_SocketCAN_Init).
+ *
+ * @param ifname    Nombre de interfaz (p. ej. "vcan0" o "can0")
+ * @retval None
+ */
+void CAN_SocketCAN_Set_Interface(const char* ifname);
+
+/**
+ * @brief Función inicialización de socket CAN_RAW no bloqueante.
+ *
+ * Aplica los mismos filtros de recepción que los filtros de hardware de la tarjeta y habilita
+ * marcas de tiempo de recepción del kernel y contador de descartes.
+ *
+ * @param None
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_Init(void);
+
+/**
+ * @brief Función transmisión de trama (no bloqueante).
+ *
+ * @param id        Identificador
+ * @param ide       Tipo de identificador
+ * @param rtr       Tipo de trama
+ * @param dlc       Largo
+ * @param data      Datos
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data);
+
+/**
+ * @brief Función lectura de la trama recibida que se está entregando.
+ *
+ * @param id        Identificador leído
+ * @param dlc       Largo leído
+ * @param data      Datos leídos (PAYLOAD_MAX_LENGTH bytes)
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data);
+
+/**
+ * @brief Función número de mensajes.
+ *
+ * @param None
+ * @return can_status_t
+ */
+can_status_t CAN_SocketCAN_DataCount(void);
+
+/**
+ * @brief Lee sin bloquear las tramas disponibles en el socket.
+ *
+ * Por cada trama llama a rx_pending con la marca de tiempo de recepción del kernel (CLOCK_REALTIME, ns).
+ * Lee como máximo CAN_SOCKETCAN_POLL_BUDGET tramas por llamada.
+ *
+ * @param rx_pending    Función llamada por cada trama
+ * @return uint32_t     Tramas leídas
+ */
+uint32_t CAN_SocketCAN_Poll(can_socketcan_rx_pending_t rx_pending);
+
+/**
+ * @brief Retorna el descriptor del socket (para esperar con poll/select), -1 si no está abierto.
+ *
+ * @return int
+ */
+int CAN_SocketCAN_Get_Fd(void);
+
+/**
+ * @brief Retorna estadísticas del backend.
+ *
+ * @param stats     Estadísticas a completar
+ * @retval None
+ */
+void CAN_SocketCAN_Get_Stats(can_socketcan_stats_t* stats);
+
+#endif /* _CAN_SOCKETCAN_H_ */
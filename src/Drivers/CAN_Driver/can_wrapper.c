@@ -85,14 +85,18 @@ can_status_t CAN_Wrapper_Init(void)
 /**
  * @brief Función wrapper transmisión de datos CAN.
  *
+ * Deja la trama en un mailbox libre. Si los tres están ocupados (o la HAL rechaza la trama) retorna
+ * CAN_STATUS_ERROR y la trama no se transmite: el llamador decide si la reintenta.
+ *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param id Standard identifier
+ * @param id Standard or extended identifier (según ide)
  * @param ide Type of identifier
  * @param rtr Type of frame
  * @param dlc Length of frame
  * @param data Data to transmit
- * @retval None
+ * @retval CAN_STATUS_OK     Trama en mailbox
+ * @retval CAN_STATUS_ERROR  Mailboxes ocupados o error de la HAL
  */
 can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data)
 {
@@ -104,13 +108,17 @@ can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uin
 
     /* CAN message transmission configuration */
 	TxHeader.StdId = id;            			// standard identifier value
+	TxHeader.ExtId = id;            			// extended identifier value
 	TxHeader.DLC = dlc; 						// length of frame
-	TxHeader.IDE = CAN_ID_STD; 					// type of identifier
-	TxHeader.RTR = CAN_RTR_DATA;    			// type of frame
+	TxHeader.IDE = (ide == EXTENDED_FRAME) ? CAN_ID_EXT : CAN_ID_STD; 	// type of identifier
+	TxHeader.RTR = (rtr == RTR_MSG) ? CAN_RTR_REMOTE : CAN_RTR_DATA;  	// type of frame
 	TxHeader.TransmitGlobalTime = DISABLE;
 
-	/* Start CAN transmission process */
-	HAL_CAN_AddTxMessage(&hcan1, &TxHeader, data, &TxMailbox);
+	/* Start CAN transmission process (HAL_ERROR si no hay mailbox libre) */
+	if (HAL_CAN_AddTxMessage(&hcan1, &TxHeader, data, &TxMailbox) != HAL_OK)
+	{
+		return CAN_STATUS_ERROR;
+	}
 
 	return CAN_STATUS_OK;
 }
@@ -121,10 +129,11 @@ can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uin
  * No es static, por lo que puede ser usada por otros archivos.
  *
  * @param id Received identifier
+ * @param dlc Received length of frame
  * @param data Received data
  * @retval  None
  */
-can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *data)
+can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data)
 {
 	/*
 	 *  STM32 CAN receive message
@@ -133,8 +142,11 @@ can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *data)
 	/* Get CAN received message */
     HAL_CAN_GetRxMessage(&hcan1, CAN_RX_FIFO0, &RxHeader, data);
 
-    /* Received standard identifier */
-    *id = RxHeader.StdId;
+    /* Received standard or extended identifier */
+    *id = (RxHeader.IDE == CAN_ID_EXT) ? RxHeader.ExtId : RxHeader.StdId;
+
+    /* Received length of frame */
+    *dlc = (uint8_t)RxHeader.DLC;
 
 	return CAN_STATUS_OK;
 }
@@ -46,14 +46,18 @@ can_status_t CAN_Wrapper_Init(void);
 /**
  * @brief Función wrapper transmisión de datos CAN.
  *
+ * Deja la trama en un mailbox libre. Si los tres están ocupados (o la HAL rechaza la trama) retorna
+ * CAN_STATUS_ERROR y la trama no se transmite: el llamador decide si la reintenta.
+ *
  * No es static, por lo que puede ser usada por otros archivos.
  *
- * @param id Standard identifier
+ * @param id Standard or extended identifier (según ide)
  * @param ide Type of identifier
  * @param rtr Type of frame
  * @param dlc Length of frame
  * @param data Data to transmit
- * @retval None
+ * @retval CAN_STATUS_OK     Trama en mailbox
+ * @retval CAN_STATUS_ERROR  Mailboxes ocupados o error de la HAL
  */
 can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data);
 
@@ -63,10 +67,11 @@ can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uin
  * No es static, por lo que puede ser usada por otros archivos.
  *
  * @param id Received identifier
+ * @param dlc Received length of frame
  * @param data Received data
  * @retval  can_status_t
  */
-can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *data);
+can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data);
 
 /**
  * @brief Función wrapper conteo dato recibido por CAN.
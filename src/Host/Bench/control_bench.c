@@ -0,0 +1,685 @@
+/**
+ * @file control_bench.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Microbenchmark de las etapas de la aplicación de Control con umbral de regresión
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Mide ns/op en host de CAN_APP_Store_ReceivedMessage, DECODE_DATA_Process, MONITORING_Process, FAILURES_Process,
+ * DRIVING_MODES_Process, RAMPA_PEDAL_Process y de una pasada completa de kRUNNING (MX_APP_Run_Pass).
+ *
+ * Entradas representativas: BENCH_CONTEXTS instancias (app_context_t) llevadas a su estado haciendo correr la
+ * aplicación un tiempo sorteado con tráfico nominal (pedal cada 10 ms, estados cada 100 ms, botones y hombre
+ * muerto), con algunos módulos reportando ERROR según una distribución fija. Las tramas para
+ * CAN_APP_Store_ReceivedMessage siguen la mezcla de IDs de la red (pedal 10 veces por cada trama de estado).
+ *
+ * En cada ronda se mide cada etapa por turno: se restauran las instancias (fuera de la medición) y se hace una
+ * llamada por instancia; por etapa se reporta la mediana y el mínimo de ns/op entre rondas. Los ns/op incluyen la
+ * llamada indirecta del benchmark.
+ *
+ * Cada ronda mide además un lazo de calibración fijo (enteros, float y saltos predecibles, sin código de la
+ * aplicación) de la misma forma que las etapas, justo antes de cada una. Por etapa se reporta también la mediana
+ * entre rondas de la razón ns/op de la etapa / ns/op de la calibración medida antes: la velocidad de la máquina y
+ * las perturbaciones lentas se cancelan, y la razón se puede comparar entre máquinas.
+ *
+ * Con -b compara la razón de cada etapa con la de un archivo base (mismo formato JSON que -o) y termina con
+ * código 1 si alguna empeora más del umbral.
+ *
+ * Uso: ./build/control_bench [-r <rondas>] [-x <semilla>] [-o <salida.json>] [-b <base.json>] [-t <umbral_%>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "instance_hal.h"
+
+/* Application includes */
+#include "app_context.h"
+#include "app_control.h"
+#include "can_app.h"
+#include "can_def.h"
+#include "decode_data.h"
+#include "driving_modes.h"
+#include "failures.h"
+#include "monitoring.h"
+#include "rampa_pedal.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Instancias de entrada (potencia de 2) */
+#define BENCH_CONTEXTS                      64U
+
+/** @brief Tramas de entrada de CAN_APP_Store_ReceivedMessage (potencia de 2) */
+#define BENCH_FRAMES                        1024U
+
+/** @brief Tiempo de preparación mínimo y máximo de una instancia en ms */
+#define BENCH_WARMUP_MIN_MS                 500U
+#define BENCH_WARMUP_MAX_MS                 3000U
+
+/** @brief Tiempo virtual durante la medición en ms (la preparación de cada instancia termina justo antes) */
+#define BENCH_TIME_MS                       (BENCH_WARMUP_MAX_MS + 1000U)
+
+/** @brief Pasos del lazo de calibración */
+#define BENCH_CALIBRATION_STEPS             32U
+
+/** @brief Largo máximo del archivo base */
+#define BENCH_BASELINE_MAX_SIZE             8192U
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Función medida sobre una instancia */
+typedef void (*bench_fn_t)(app_context_t* ctx, uint32_t i);
+
+/** @brief Etapa medida */
+typedef struct
+{
+    const char*     name;               /**< Nombre en el JSON */
+    bench_fn_t      fn;                 /**< Función */
+    double          median_ns;          /**< Mediana de ns/op entre rondas */
+    double          min_ns;             /**< Mínimo de ns/op entre rondas */
+    double          ratio;              /**< Mediana de la razón ns/op de la etapa / ns/op de la calibración */
+
+} bench_stage_t;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Bench_Calibration(app_context_t* ctx, uint32_t i);
+static void Bench_Can_Store(app_context_t* ctx, uint32_t i);
+static void Bench_Decode(app_context_t* ctx, uint32_t i);
+static void Bench_Monitoring(app_context_t* ctx, uint32_t i);
+static void Bench_Failures(app_context_t* ctx, uint32_t i);
+static void Bench_Driving_Modes(app_context_t* ctx, uint32_t i);
+static void Bench_Rampa_Pedal(app_context_t* ctx, uint32_t i);
+static void Bench_Run_Pass(app_context_t* ctx, uint32_t i);
+
+static void Bench_Prepare_Inputs(uint64_t* state);
+static void Bench_Prepare_Context(app_context_t* ctx, uint64_t* state);
+static void Bench_Deliver(app_context_t* ctx, uint32_t id, uint8_t value);
+static double Bench_Measure_Stage(const bench_stage_t* stage, uint32_t round);
+static void Bench_Median_Min(bench_stage_t* stage, double* values, uint32_t rounds);
+static void Bench_Measure(uint32_t rounds, double* samples, double* calibration, double* ratios);
+static int Bench_Compare_Baseline(const char* path, double threshold_pct);
+static void Bench_Write_Json(FILE* file, uint32_t rounds);
+static int Bench_Compare_Double(const void* a, const void* b);
+static uint64_t Bench_Rand(uint64_t* state);
+static uint32_t Bench_Rand_Range(uint64_t* state, uint32_t min, uint32_t max);
+static double Wall_Time_Ns(void);
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Lazo de calibración (se mide como una etapa más, pero no se compara) */
+static bench_stage_t calibration_stage = {"calibration", Bench_Calibration, 0.0, 0.0, 1.0};
+
+/** @brief Etapas medidas */
+static bench_stage_t stages[] =
+{
+    {"can_app_store_received_message",  Bench_Can_Store,        0.0, 0.0, 0.0},
+    {"decode_data_process",             Bench_Decode,           0.0, 0.0, 0.0},
+    {"monitoring_process",              Bench_Monitoring,       0.0, 0.0, 0.0},
+    {"failures_process",                Bench_Failures,         0.0, 0.0, 0.0},
+    {"driving_modes_process",           Bench_Driving_Modes,    0.0, 0.0, 0.0},
+    {"rampa_pedal_process",             Bench_Rampa_Pedal,      0.0, 0.0, 0.0},
+    {"app_run_pass",                    Bench_Run_Pass,         0.0, 0.0, 0.0},
+};
+
+/** @brief Número de etapas */
+#define BENCH_NUM_OF_STAGES                 (sizeof(stages) / sizeof(stages[0]))
+
+/** @brief Instancias preparadas (no se modifican durante la medición) */
+static app_context_t pristine[BENCH_CONTEXTS];
+
+/** @brief Instancias sobre las que se mide */
+static app_context_t work[BENCH_CONTEXTS];
+
+/** @brief Tramas de entrada */
+static can_frame_t frames[BENCH_FRAMES];
+
+/** @brief Resultado del lazo de calibración (evita que el compilador lo elimine) */
+static volatile uint32_t calibration_sink;
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    uint32_t rounds = 5000;
+    uint64_t state = 1;
+    const char* json_name = NULL;
+    const char* baseline_name = NULL;
+    double threshold_pct = 20.0;
+    double* samples;
+    double* calibration;
+    double* ratios;
+    int regressions = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-r") == 0)
+        {
+            rounds = strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-x") == 0)
+        {
+            state = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-o") == 0)
+        {
+            json_name = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            baseline_name = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-t") == 0)
+        {
+            threshold_pct = strtod(argv[i + 1], NULL);
+        }
+    }
+
+    if (rounds == 0 || threshold_pct < 0.0)
+    {
+        fprintf(stderr, "opciones no válidas (rondas > 0, umbral >= 0)\n");
+        return EXIT_FAILURE;
+    }
+
+    samples = malloc(BENCH_NUM_OF_STAGES * rounds * sizeof(double));
+    calibration = malloc(rounds * sizeof(double));
+    ratios = malloc(BENCH_NUM_OF_STAGES * rounds * sizeof(double));
+
+    if (samples == NULL || calibration == NULL || ratios == NULL)
+    {
+        fprintf(stderr, "sin memoria para %lu rondas\n", (unsigned long)rounds);
+        return EXIT_FAILURE;
+    }
+
+    INSTANCE_HAL_Reset();
+
+    Bench_Prepare_Inputs(&state);
+
+    INSTANCE_HAL_Set_Time_Ms(BENCH_TIME_MS);
+
+    Bench_Measure(rounds, samples, calibration, ratios);
+
+    printf("%-34s %12s %12s %9s\n", "etapa", "ns/op", "min ns/op", "razón");
+    printf("%-34s %12.2f %12.2f %9.3f\n", calibration_stage.name, calibration_stage.median_ns,
+           calibration_stage.min_ns, calibration_stage.ratio);
+
+    for (size_t s = 0; s < BENCH_NUM_OF_STAGES; s++)
+    {
+        printf("%-34s %12.2f %12.2f %9.3f\n", stages[s].name, stages[s].median_ns, stages[s].min_ns,
+               stages[s].ratio);
+    }
+
+    free(samples);
+    free(calibration);
+    free(ratios);
+
+    if (json_name != NULL)
+    {
+        FILE* json = fopen(json_name, "w");
+
+        if (json == NULL)
+        {
+            fprintf(stderr, "no se pudo abrir %s\n", json_name);
+            return EXIT_FAILURE;
+        }
+
+        Bench_Write_Json(json, rounds);
+        fclose(json);
+    }
+
+    if (baseline_name != NULL)
+    {
+        regressions = Bench_Compare_Baseline(baseline_name, threshold_pct);
+
+        if (regressions < 0)
+        {
+            return EXIT_FAILURE;
+        }
+
+        printf("\n%d etapa(s) sobre el umbral de %.1f %% respecto de %s\n", regressions, threshold_pct,
+               baseline_name);
+    }
+
+    return (regressions > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * Stage functions implementation
+ **********************************************************************************************************************/
+
+/* Trabajo fijo sin memoria compartida: depende solo de la velocidad de la máquina */
+static void Bench_Calibration(app_context_t* ctx, uint32_t i)
+{
+    uint32_t x = i | 1U;
+    float acc = 0.0f;
+
+    for (uint32_t k = 0; k < BENCH_CALIBRATION_STEPS; k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+
+        /* Salto predecible: el costo no depende de los datos de la ronda */
+        if ((k & 3U) == 0U)
+        {
+            acc += (float)(x & 0xFFU) * 0.5f;
+        }
+    }
+
+    calibration_sink = x + (uint32_t)acc;
+}
+
+static void Bench_Can_Store(app_context_t* ctx, uint32_t i)
+{
+    CAN_APP_Store_ReceivedMessage(ctx, &frames[i & (BENCH_FRAMES - 1U)]);
+}
+
+static void Bench_Decode(app_context_t* ctx, uint32_t i)
+{
+    /* Sin bandera la etapa no hace nada; en la pasada la activa CAN_APP_Process */
+    ctx->flag_decodificar = DECODIFICA;
+
+    DECODE_DATA_Process(ctx);
+}
+
+static void Bench_Monitoring(app_context_t* ctx, uint32_t i)
+{
+    MONITORING_Process(ctx);
+}
+
+static void Bench_Failures(app_context_t* ctx, uint32_t i)
+{
+    FAILURES_Process(ctx);
+}
+
+static void Bench_Driving_Modes(app_context_t* ctx, uint32_t i)
+{
+    DRIVING_MODES_Process(ctx);
+}
+
+static void Bench_Rampa_Pedal(app_context_t* ctx, uint32_t i)
+{
+    RAMPA_PEDAL_Process(ctx);
+}
+
+static void Bench_Run_Pass(app_context_t* ctx, uint32_t i)
+{
+    MX_APP_Run_Pass(ctx);
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Prepara instancias y tramas de entrada.
+ *
+ * @param state     Estado del generador
+ * @retval None
+ */
+static void Bench_Prepare_Inputs(uint64_t* state)
+{
+    /* Mezcla de IDs en 100 ms de red: pedal cada 10 ms, el resto una vez */
+    static const uint32_t status_ids[] =
+    {
+        CAN_ID_PERIFERICOS_HOMBRE_MUERTO, CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO, CAN_ID_PERIFERICOS_OK,
+        CAN_ID_BMS_VOLTAJE, CAN_ID_BMS_CORRIENTE, CAN_ID_BMS_VOLTAJE_MIN_CELDA, CAN_ID_BMS_POTENCIA,
+        CAN_ID_BMS_T_MAX, CAN_ID_BMS_NIVEL_BATERIA, CAN_ID_BMS_OK,
+        CAN_ID_DCDC_VOLTAJE_BATERIA, CAN_ID_DCDC_VOLTAJE_SALIDA, CAN_ID_DCDC_T_MAX, CAN_ID_DCDC_OK,
+        CAN_ID_DCDC_POTENCIA,
+        CAN_ID_INVERSOR_VELOCIDAD, CAN_ID_INVERSOR_V, CAN_ID_INVERSOR_I, CAN_ID_INVERSOR_TEMP_MAX,
+        CAN_ID_INVERSOR_TEMP_MOTOR, CAN_ID_INVERSOR_POTENCIA, CAN_ID_INVERSOR_OK
+    };
+    const uint32_t num_status = sizeof(status_ids) / sizeof(status_ids[0]);
+    const uint32_t num_pedal = 10;
+
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++)
+    {
+        uint32_t pick = Bench_Rand_Range(state, 0, num_status + num_pedal - 1);
+
+        memset(&frames[i], 0, sizeof(frames[i]));
+
+        frames[i].id = (pick < num_pedal) ? CAN_ID_PERIFERICOS_PEDAL : status_ids[pick - num_pedal];
+        frames[i].payload_length = 1;
+        frames[i].payload_buff[0] = (uint8_t)Bench_Rand_Range(state, 0, 99);
+    }
+
+    for (uint32_t k = 0; k < BENCH_CONTEXTS; k++)
+    {
+        Bench_Prepare_Context(&pristine[k], state);
+    }
+}
+
+/**
+ * @brief Lleva una instancia a un estado representativo haciendo correr la aplicación con tráfico sorteado.
+ *
+ * Módulos BMS y DCDC con ERROR: ninguno 80 %, uno 12 %, ambos 8 % (desde un instante sorteado). Al terminar,
+ * la mitad de las instancias queda con recepción pendiente y una de cada diez con trigger de transmisión.
+ *
+ * @param ctx       Instancia
+ * @param state     Estado del generador
+ * @retval None
+ */
+static void Bench_Prepare_Context(app_context_t* ctx, uint64_t* state)
+{
+    static const uint8_t buttons[] = {CAN_VALUE_BTN_NONE, CAN_VALUE_BTN_ECO, CAN_VALUE_BTN_NORMAL, CAN_VALUE_BTN_SPORT};
+    uint32_t warmup_ms = Bench_Rand_Range(state, BENCH_WARMUP_MIN_MS, BENCH_WARMUP_MAX_MS);
+    uint32_t faults_draw = Bench_Rand_Range(state, 0, 99);
+    uint32_t fault_start_ms = BENCH_TIME_MS - warmup_ms + Bench_Rand_Range(state, 0, warmup_ms);
+    uint8_t pedal = (uint8_t)Bench_Rand_Range(state, 0, 99);
+    uint8_t button = buttons[Bench_Rand_Range(state, 0, 3)];
+    uint8_t hombre_muerto = (Bench_Rand_Range(state, 0, 9) == 0) ? CAN_VALUE_HOMBRE_MUERTO_ON
+                                                                    : CAN_VALUE_HOMBRE_MUERTO_OFF;
+    bool bms_fault = (faults_draw >= 80);
+    bool dcdc_fault = (faults_draw >= 92);
+
+    APP_CONTEXT_Init(ctx, &app_config_default);
+
+    if (CAN_API_Init(&ctx->can_obj, STANDARD_FRAME, NORMAL_MSG, CAN_Wrapper_Init, CAN_Wrapper_TransmitData,
+                     CAN_Wrapper_ReceiveData, CAN_Wrapper_DataCount) != CAN_STATUS_OK)
+    {
+        Error_Handler();
+    }
+
+    for (uint32_t t = BENCH_TIME_MS - warmup_ms; t < BENCH_TIME_MS; t++)
+    {
+        INSTANCE_HAL_Set_Time_Ms(t);
+
+        if (t % 10U == 0)
+        {
+            Bench_Deliver(ctx, CAN_ID_PERIFERICOS_PEDAL, pedal);
+
+            pedal = (uint8_t)((pedal + 1) % 100);
+        }
+
+        if (t % 100U == 0)
+        {
+            bool faulty = (t >= fault_start_ms);
+
+            Bench_Deliver(ctx, CAN_ID_PERIFERICOS_OK, CAN_VALUE_MODULE_OK);
+            Bench_Deliver(ctx, CAN_ID_BMS_OK, (bms_fault && faulty) ? CAN_VALUE_MODULE_ERROR : CAN_VALUE_MODULE_OK);
+            Bench_Deliver(ctx, CAN_ID_DCDC_OK, (dcdc_fault && faulty) ? CAN_VALUE_MODULE_ERROR : CAN_VALUE_MODULE_OK);
+            Bench_Deliver(ctx, CAN_ID_INVERSOR_OK, CAN_VALUE_MODULE_OK);
+            Bench_Deliver(ctx, CAN_ID_PERIFERICOS_HOMBRE_MUERTO, hombre_muerto);
+            Bench_Deliver(ctx, CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO, (t % 1000U == 0) ? button : CAN_VALUE_BTN_NONE);
+        }
+
+        if (t % 100U == 50U)
+        {
+            ctx->flag_tx_can = CAN_TX_READY;
+        }
+
+        MX_APP_Run_Pass(ctx);
+    }
+
+    ctx->flag_rx_can = (Bench_Rand_Range(state, 0, 1) == 0) ? CAN_MSG_RECEIVED : CAN_MSG_NOT_RECEIVED;
+    ctx->flag_tx_can = (Bench_Rand_Range(state, 0, 9) == 0) ? CAN_TX_READY : CAN_TX_NOT_READY;
+}
+
+/**
+ * @brief Entrega una trama de un byte a la instancia, como la ISR de recepción en la tarjeta.
+ *
+ * @param ctx       Instancia
+ * @param id        Identificador
+ * @param value     Dato
+ * @retval None
+ */
+static void Bench_Deliver(app_context_t* ctx, uint32_t id, uint8_t value)
+{
+    can_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+
+    frame.id = id;
+    frame.payload_length = 1;
+    frame.payload_buff[0] = value;
+
+    CAN_APP_Store_ReceivedMessage(ctx, &frame);
+
+    ctx->flag_rx_can = CAN_MSG_RECEIVED;
+}
+
+/**
+ * @brief Mide una etapa: restaura las instancias y llama una vez por instancia.
+ *
+ * @param stage     Etapa
+ * @param round     Ronda
+ * @return double   ns/op
+ */
+static double Bench_Measure_Stage(const bench_stage_t* stage, uint32_t round)
+{
+    double start;
+
+    memcpy(work, pristine, sizeof(work));
+
+    start = Wall_Time_Ns();
+
+    for (uint32_t k = 0; k < BENCH_CONTEXTS; k++)
+    {
+        stage->fn(&work[k], round * BENCH_CONTEXTS + k);
+    }
+
+    return (Wall_Time_Ns() - start) / (double)BENCH_CONTEXTS;
+}
+
+/**
+ * @brief Mediana y mínimo de las muestras (las ordena).
+ *
+ * @param stage     Etapa donde se guardan
+ * @param values    Muestras
+ * @param rounds    Número de muestras
+ * @retval None
+ */
+static void Bench_Median_Min(bench_stage_t* stage, double* values, uint32_t rounds)
+{
+    qsort(values, rounds, sizeof(double), Bench_Compare_Double);
+
+    stage->median_ns = values[rounds / 2];
+    stage->min_ns = values[0];
+}
+
+/**
+ * @brief Mide la calibración y todas las etapas, una vez cada una por ronda.
+ *
+ * Las etapas se alternan dentro de cada ronda, así una perturbación de la máquina afecta a todas por igual. La
+ * calibración se mide justo antes de cada etapa y la razón de esa etapa usa esa medición.
+ *
+ * @param rounds        Rondas
+ * @param samples       Memoria para BENCH_NUM_OF_STAGES * rounds muestras
+ * @param calibration   Memoria para rounds muestras de calibración
+ * @param ratios        Memoria para BENCH_NUM_OF_STAGES * rounds razones
+ * @retval None
+ */
+static void Bench_Measure(uint32_t rounds, double* samples, double* calibration, double* ratios)
+{
+    for (uint32_t r = 0; r < rounds; r++)
+    {
+        calibration[r] = 0.0;
+
+        for (size_t s = 0; s < BENCH_NUM_OF_STAGES; s++)
+        {
+            double reference = Bench_Measure_Stage(&calibration_stage, r);
+
+            samples[s * rounds + r] = Bench_Measure_Stage(&stages[s], r);
+            ratios[s * rounds + r] = samples[s * rounds + r] / reference;
+            calibration[r] += reference / (double)BENCH_NUM_OF_STAGES;
+        }
+    }
+
+    for (size_t s = 0; s < BENCH_NUM_OF_STAGES; s++)
+    {
+        double* stage_ratios = &ratios[s * rounds];
+
+        qsort(stage_ratios, rounds, sizeof(double), Bench_Compare_Double);
+        stages[s].ratio = stage_ratios[rounds / 2];
+
+        Bench_Median_Min(&stages[s], &samples[s * rounds], rounds);
+    }
+
+    Bench_Median_Min(&calibration_stage, calibration, rounds);
+}
+
+/**
+ * @brief Compara la razón a la calibración de cada etapa con la del archivo base.
+ *
+ * Solo reconoce el formato que escribe Bench_Write_Json: por etapa, "name" seguido de "ratio". Los ns/op del
+ * archivo base no se comparan: dependen de la máquina.
+ *
+ * @param path          Archivo base
+ * @param threshold_pct Umbral de regresión en %
+ * @return int          Etapas sobre el umbral, -1 si no se pudo leer el archivo
+ */
+static int Bench_Compare_Baseline(const char* path, double threshold_pct)
+{
+    static char text[BENCH_BASELINE_MAX_SIZE];
+    FILE* file = fopen(path, "r");
+    size_t length;
+    int regressions = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "no se pudo abrir %s\n", path);
+        return -1;
+    }
+
+    length = fread(text, 1, sizeof(text) - 1, file);
+    text[length] = '\0';
+    fclose(file);
+
+    printf("\n%-34s %12s %12s %9s\n", "etapa", "base razón", "razón", "cambio");
+
+    for (size_t s = 0; s < BENCH_NUM_OF_STAGES; s++)
+    {
+        char key[64];
+        const char* entry;
+        double base;
+        double change;
+
+        snprintf(key, sizeof(key), "\"name\": \"%s\"", stages[s].name);
+
+        entry = strstr(text, key);
+        entry = (entry != NULL) ? strstr(entry, "\"ratio\":") : NULL;
+
+        if (entry == NULL)
+        {
+            printf("%-34s %12s %12.3f %9s\n", stages[s].name, "-", stages[s].ratio, "sin base");
+            continue;
+        }
+
+        base = strtod(entry + strlen("\"ratio\":"), NULL);
+        change = (base > 0.0) ? 100.0 * (stages[s].ratio - base) / base : 0.0;
+
+        printf("%-34s %12.3f %12.3f %+8.1f%%%s\n", stages[s].name, base, stages[s].ratio, change,
+               (change > threshold_pct) ? "  REGRESIÓN" : "");
+
+        if (change > threshold_pct)
+        {
+            regressions++;
+        }
+    }
+
+    return regressions;
+}
+
+/**
+ * @brief Escribe los resultados en JSON.
+ *
+ * @param file      Archivo
+ * @param rounds    Rondas medidas
+ * @retval None
+ */
+static void Bench_Write_Json(FILE* file, uint32_t rounds)
+{
+    fprintf(file, "{\n  \"benchmark\": \"control_bench\",\n  \"unit\": \"ns/op\",\n");
+    fprintf(file, "  \"contexts\": %u,\n  \"rounds\": %lu,\n", BENCH_CONTEXTS, (unsigned long)rounds);
+    fprintf(file, "  \"calibration\": {\"steps\": %u, \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f},\n",
+            BENCH_CALIBRATION_STEPS, calibration_stage.median_ns, calibration_stage.min_ns);
+    fprintf(file, "  \"stages\": [\n");
+
+    for (size_t s = 0; s < BENCH_NUM_OF_STAGES; s++)
+    {
+        fprintf(file, "    {\"name\": \"%s\", \"ratio\": %.4f, \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f}%s\n",
+                stages[s].name, stages[s].ratio, stages[s].median_ns, stages[s].min_ns,
+                (s + 1 < BENCH_NUM_OF_STAGES) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+}
+
+/**
+ * @brief Comparación de double para qsort.
+ *
+ * @param a         Primer valor
+ * @param b         Segundo valor
+ * @return int
+ */
+static int Bench_Compare_Double(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Generador splitmix64.
+ *
+ * @param state     Estado
+ * @return uint64_t Número pseudoaleatorio
+ */
+static uint64_t Bench_Rand(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Entero pseudoaleatorio en [min:max].
+ *
+ * @param state     Estado
+ * @param min       Mínimo
+ * @param max       Máximo
+ * @return uint32_t
+ */
+static uint32_t Bench_Rand_Range(uint64_t* state, uint32_t min, uint32_t max)
+{
+    return min + (uint32_t)(Bench_Rand(state) % ((uint64_t)max - min + 1U));
+}
+
+/**
+ * @brief Tiempo real monotónico en ns.
+ *
+ * @return double
+ */
+static double Wall_Time_Ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
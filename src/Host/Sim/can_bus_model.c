@@ -0,0 +1,216 @@
+/**
+ * @file can_bus_model.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Modelo a nivel de bit de un bus CAN 2.0A: largo de trama con bit stuffing y arbitraje
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "can_bus_model.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Polinomio CRC-15 de CAN */
+#define CAN_BUS_CRC15_POLY                  0x4599U
+
+/** @brief Bits de SOF a CRC de una trama de 8 bytes sin stuffing */
+#define CAN_BUS_MAX_RAW_BITS                (1 + 11 + 3 + 4 + 64 + 15)
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static uint32_t CAN_BUS_Put_Bits(uint8_t* bits, uint32_t n, uint32_t value, uint32_t width);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void CAN_BUS_Init(can_bus_t* bus, uint32_t bitrate)
+{
+    memset(bus, 0, sizeof(*bus));
+
+    bus->bit_time_us = 1000000U / bitrate;
+
+    memset(bus->node_capacity, CAN_BUS_MAILBOXES, sizeof(bus->node_capacity));
+}
+
+void CAN_BUS_Set_Node_Capacity(can_bus_t* bus, uint8_t node, uint8_t capacity)
+{
+    if (node < CAN_BUS_MAX_NODES)
+    {
+        capacity = (capacity == 0) ? 1 : capacity;
+        bus->node_capacity[node] = (capacity > CAN_BUS_MAX_NODE_QUEUE) ? CAN_BUS_MAX_NODE_QUEUE : capacity;
+    }
+}
+
+uint32_t CAN_BUS_Frame_Bits(uint32_t id, const uint8_t* data, uint8_t dlc)
+{
+    uint8_t bits[CAN_BUS_MAX_RAW_BITS];
+    uint32_t n = 0;
+    uint32_t crc = 0;
+    uint32_t stuffed = 0;
+    uint32_t run = 0;
+    uint8_t last = 2;
+
+    dlc = (dlc > 8) ? 8 : dlc;
+
+    /* SOF, identificador, RTR, IDE, r0 y DLC */
+    n = CAN_BUS_Put_Bits(bits, n, 0, 1);
+    n = CAN_BUS_Put_Bits(bits, n, id & 0x7FFU, 11);
+    n = CAN_BUS_Put_Bits(bits, n, 0, 3);
+    n = CAN_BUS_Put_Bits(bits, n, dlc, 4);
+
+    for (uint8_t i = 0; i < dlc; i++)
+    {
+        n = CAN_BUS_Put_Bits(bits, n, data[i], 8);
+    }
+
+    /* CRC-15 sobre SOF..datos */
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint32_t crc_next = bits[i] ^ ((crc >> 14) & 1U);
+
+        crc = (crc << 1) & 0x7FFFU;
+
+        if (crc_next)
+        {
+            crc ^= CAN_BUS_CRC15_POLY;
+        }
+    }
+
+    n = CAN_BUS_Put_Bits(bits, n, crc, 15);
+
+    /* Bit stuffing: tras 5 bits iguales se inserta uno complementario, que cuenta para la próxima racha */
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (bits[i] == last)
+        {
+            run++;
+        }
+        else
+        {
+            last = bits[i];
+            run = 1;
+        }
+
+        if (run == 5)
+        {
+            stuffed++;
+            last = (uint8_t)!last;
+            run = 1;
+        }
+    }
+
+    return n + stuffed + CAN_BUS_TRAILER_BITS;
+}
+
+bool CAN_BUS_Enqueue(can_bus_t* bus, const can_bus_frame_t* frame)
+{
+    if (frame->node >= CAN_BUS_MAX_NODES || bus->node_count[frame->node] >= bus->node_capacity[frame->node])
+    {
+        return false;
+    }
+
+    bus->pending[bus->count] = *frame;
+    bus->pending[bus->count].seq = bus->seq++;
+    bus->count++;
+    bus->node_count[frame->node]++;
+
+    return true;
+}
+
+uint64_t CAN_BUS_Next_Arbitration_Us(const can_bus_t* bus)
+{
+    uint64_t first = UINT64_MAX;
+
+    for (uint16_t i = 0; i < bus->count; i++)
+    {
+        if (bus->pending[i].t_enqueue_us < first)
+        {
+            first = bus->pending[i].t_enqueue_us;
+        }
+    }
+
+    if (first == UINT64_MAX)
+    {
+        return UINT64_MAX;
+    }
+
+    return (first > bus->free_us) ? first : bus->free_us;
+}
+
+bool CAN_BUS_Arbitrate(can_bus_t* bus, can_bus_frame_t* winner, uint64_t* start_us, uint64_t* end_us,
+                       uint32_t* bits)
+{
+    uint64_t t = CAN_BUS_Next_Arbitration_Us(bus);
+    int best = -1;
+
+    if (t == UINT64_MAX)
+    {
+        return false;
+    }
+
+    /* Participan las tramas presentes al inicio del arbitraje; gana el menor identificador */
+    for (uint16_t i = 0; i < bus->count; i++)
+    {
+        const can_bus_frame_t* f = &bus->pending[i];
+
+        if (f->t_enqueue_us > t)
+        {
+            continue;
+        }
+
+        if (best < 0 || f->id < bus->pending[best].id ||
+            (f->id == bus->pending[best].id && f->seq < bus->pending[best].seq))
+        {
+            best = i;
+        }
+    }
+
+    *winner = bus->pending[best];
+    *bits = CAN_BUS_Frame_Bits(winner->id, winner->data, winner->dlc);
+    *start_us = t;
+    *end_us = t + (uint64_t)(*bits) * bus->bit_time_us;
+
+    bus->free_us = *end_us;
+    bus->node_count[winner->node]--;
+    bus->pending[best] = bus->pending[--bus->count];
+
+    return true;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Agrega bits (MSB primero) a la secuencia.
+ *
+ * @param bits      Secuencia
+ * @param n         Bits actuales
+ * @param value     Valor
+ * @param width     Número de bits
+ * @return uint32_t Bits después de agregar
+ */
+static uint32_t CAN_BUS_Put_Bits(uint8_t* bits, uint32_t n, uint32_t value, uint32_t width)
+{
+    for (uint32_t i = width; i > 0; i--)
+    {
+        bits[n++] = (uint8_t)((value >> (i - 1)) & 1U);
+    }
+
+    return n;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file can_bus_model.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Modelo a nivel de bit de un bus CAN 2.0A: largo de trama con bit stuffing y arbitraje
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Cada nodo deja tramas en su cola de transmisión: por defecto CAN_BUS_MAILBOXES mailboxes, como bxCAN, sin
+ * cola de software (si están ocupados la trama se pierde, como con HAL_CAN_AddTxMessage). Con el bus libre,
+ * gana el arbitraje el menor identificador entre todas las tramas pendientes de todos los nodos; la
+ * trama ocupa el bus el número exacto de bits que resulta de su contenido (CRC-15 y bit stuffing
+ * calculados sobre SOF..CRC, más delimitadores, ACK, EOF e intermission).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _CAN_BUS_MODEL_H_
+#define _CAN_BUS_MODEL_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Máximo de nodos en el bus */
+#define CAN_BUS_MAX_NODES                   8
+
+/** @brief Mailboxes de transmisión por nodo (capacidad por defecto de la cola de un nodo) */
+#define CAN_BUS_MAILBOXES                   3
+
+/** @brief Capacidad máxima de la cola de transmisión de un nodo (mailboxes más cola de software) */
+#define CAN_BUS_MAX_NODE_QUEUE              32
+
+/** @brief Máximo de tramas pendientes en el bus */
+#define CAN_BUS_MAX_PENDING                 (CAN_BUS_MAX_NODES * CAN_BUS_MAX_NODE_QUEUE)
+
+/** @brief Bits fijos después del CRC: delimitador CRC, ACK (2), EOF (7) e intermission (3) */
+#define CAN_BUS_TRAILER_BITS                13U
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Trama en el bus
+ *
+ */
+typedef struct
+{
+    uint32_t    id;                             /**< Identificador estándar */
+    uint8_t     data[8];                        /**< Datos */
+    uint8_t     dlc;                            /**< Largo */
+    uint8_t     node;                           /**< Nodo transmisor */
+    uint64_t    t_enqueue_us;                   /**< Instante en que entró a mailbox */
+    uint64_t    tag;                            /**< Dato libre del usuario */
+    uint32_t    seq;                            /**< Orden de llegada (desempate) */
+
+} can_bus_frame_t;
+
+/**
+ * @brief Estado del bus
+ *
+ */
+typedef struct
+{
+    uint32_t        bit_time_us;                            /**< Tiempo de bit en us */
+    uint64_t        free_us;                                /**< Instante en que el bus queda libre */
+    can_bus_frame_t pending[CAN_BUS_MAX_PENDING];           /**< Tramas pendientes */
+    uint16_t        count;                                  /**< Número de tramas pendientes */
+    uint8_t         node_count[CAN_BUS_MAX_NODES];          /**< Tramas pendientes por nodo */
+    uint8_t         node_capacity[CAN_BUS_MAX_NODES];       /**< Capacidad de la cola de cada nodo */
+    uint32_t        seq;                                    /**< Contador de orden de llegada */
+
+} can_bus_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicializa el bus.
+ *
+ * @param bus       Bus
+ * @param bitrate   Velocidad en bit/s (divisor de 1 MHz: 125000, 250000, 500000, 1000000)
+ * @retval None
+ */
+void CAN_BUS_Init(can_bus_t* bus, uint32_t bitrate);
+
+/**
+ * @brief Define la capacidad de la cola de transmisión de un nodo.
+ *
+ * @param bus       Bus
+ * @param node      Nodo
+ * @param capacity  Tramas [1:CAN_BUS_MAX_NODE_QUEUE]
+ * @retval None
+ */
+void CAN_BUS_Set_Node_Capacity(can_bus_t* bus, uint8_t node, uint8_t capacity);
+
+/**
+ * @brief Calcula el largo en bits de una trama de datos estándar, con bit stuffing e intermission.
+ *
+ * @param id        Identificador estándar
+ * @param data      Datos
+ * @param dlc       Largo [0:8]
+ * @return uint32_t Bits
+ */
+uint32_t CAN_BUS_Frame_Bits(uint32_t id, const uint8_t* data, uint8_t dlc);
+
+/**
+ * @brief Deja una trama en la cola de transmisión del nodo.
+ *
+ * Debe llamarse en orden de tiempo respecto de CAN_BUS_Arbitrate.
+ *
+ * @param bus       Bus
+ * @param frame     Trama (node, id, data, dlc, t_enqueue_us y tag)
+ * @retval true     Trama en cola
+ * @retval false    Cola del nodo llena, trama descartada
+ */
+bool CAN_BUS_Enqueue(can_bus_t* bus, const can_bus_frame_t* frame);
+
+/**
+ * @brief Retorna el instante del próximo arbitraje.
+ *
+ * @param bus       Bus
+ * @return uint64_t Instante en us, UINT64_MAX si no hay tramas pendientes
+ */
+uint64_t CAN_BUS_Next_Arbitration_Us(const can_bus_t* bus);
+
+/**
+ * @brief Realiza el próximo arbitraje y transmite la trama ganadora.
+ *
+ * @param bus       Bus
+ * @param winner    Trama transmitida
+ * @param start_us  Inicio de la trama (SOF)
+ * @param end_us    Fin de la trama, incluida la intermission (bus libre)
+ * @param bits      Bits de la trama
+ * @retval true     Trama transmitida
+ * @retval false    No hay tramas pendientes
+ */
+bool CAN_BUS_Arbitrate(can_bus_t* bus, can_bus_frame_t* winner, uint64_t* start_us, uint64_t* end_us,
+                       uint32_t* bits);
+
+#endif /* _CAN_BUS_MODEL_H_ */
@@ -0,0 +1,424 @@
+/**
+ * @file can_rx_load.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Prueba de carga de recepción CAN: costo de CPU de interrupción por trama vs recepción adaptativa
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Ejecuta la aplicación de Control en tiempo virtual (HAL de simulación, idle en WFI) con el escenario nominal de
+ * control_sim más tramas de carga a una tasa fija (ID 0x047: pasa el filtro del Inversor y CAN_APP la descarta),
+ * para varias tasas y dos políticas de recepción: solo interrupción por trama (umbral de entrada en UINT32_MAX) y
+ * adaptativa con los umbrales de can_hw.h. Cada corrida es un proceso hijo (estado global de la aplicación).
+ *
+ * Las interrupciones, tramas y pasadas las cuenta la aplicación (CAN_HW_Get_Rx_Stats, IDLE_Get_Stats); el costo en
+ * ciclos de cada una es un parámetro del modelo: en la tarjeta se obtiene del profiler (ISR CAN1_RX0, CAN_RX y la
+ * suma de las etapas de una pasada). Carga de CPU = (interrupciones * ciclos_irq + tramas * ciclos_trama +
+ * pasadas * ciclos_pasada) / ciclos del intervalo medido. El costo de la lectura por pasada es la espera de las
+ * tramas en la FIFO, que mide el wrapper CAN simulado (llegada a lectura).
+ *
+ * Termina con código de error si la recepción adaptativa pierde tramas por FIFO llena.
+ *
+ * Uso: ./build/can_rx_load [-s <segundos>] [-m <tasa_max_tramas_s>] [-i <ciclos_irq>] [-f <ciclos_trama>]
+ *                          [-p <ciclos_pasada>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "can_def.h"
+#include "can_hw.h"
+#include "idle.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Identificador de las tramas de carga (filtro del Inversor, sin uso en CAN_APP) */
+#define RX_LOAD_ID                          0x047
+
+/** @brief Duración de una trama de carga de 1 byte en el bus a 250 kbit/s (~58 bits con stuffing) en us */
+#define RX_LOAD_FRAME_US                    232U
+
+/** @brief Periodo de pedal de Periféricos en us */
+#define RX_LOAD_PEDAL_PERIOD_US             10000U
+
+/** @brief Periodo de estado de los módulos en us */
+#define RX_LOAD_STATUS_PERIOD_US            100000U
+
+/** @brief Retardo de respuesta al echo en us */
+#define RX_LOAD_ECHO_DELAY_US               1000U
+
+/** @brief Tiempo desde el arranque hasta el inicio de la medición (la recepción adaptativa ya cambió de modo) */
+#define RX_LOAD_WARMUP_US                   1000000U
+
+/** @brief Tasas de carga probadas en tramas/s (hasta -m) */
+#define RX_LOAD_RATES                       {0, 250, 500, 1000, 1500, 2000, 2500, 3000, 3500, 4000}
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Resultado de una corrida (del proceso hijo al padre)
+ *
+ */
+typedef struct
+{
+    uint32_t    irqs;                       /**< Interrupciones de recepción (mensaje pendiente y FIFO llena) */
+    uint32_t    frames;                     /**< Tramas recibidas */
+    uint32_t    poll_frames;                /**< Tramas leídas por pasada */
+    uint32_t    passes;                     /**< Pasadas de la superloop (despertares del idle) */
+    uint32_t    switches;                   /**< Cambios de modo */
+    uint32_t    overruns;                   /**< Tramas perdidas por FIFO llena */
+    uint32_t    wait_max_us;                /**< Espera máxima de una trama en la FIFO (llegada a lectura) */
+    double      cpu_pct;                    /**< Carga de CPU del modelo */
+
+} rx_load_result_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Tasa de carga de la corrida en tramas/s */
+static uint32_t load_rate_fps = 0;
+
+/** @brief Indica que los módulos ya iniciaron su tráfico */
+static bool scenario_started = false;
+
+/** @brief Próxima trama de pedal */
+static uint64_t next_pedal_us = 0;
+
+/** @brief Próximo estado de módulos */
+static uint64_t next_status_us = 0;
+
+/** @brief Próxima trama de carga */
+static uint64_t next_load_us = 0;
+
+/** @brief Estado del generador de jitter de la carga */
+static uint32_t load_seed = 1;
+
+/** @brief Valor de pedal (diente de sierra) */
+static uint8_t pedal_value = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static rx_load_result_t Rx_Load_Run(uint32_t rate_fps, bool adaptive, uint64_t seconds, const uint32_t cycles[3]);
+static bool Rx_Load_Fork(uint32_t rate_fps, bool adaptive, uint64_t seconds, const uint32_t cycles[3],
+                         rx_load_result_t* result);
+static bool Rx_Load_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+static void Rx_Load_Advance_Hook(uint64_t target_us);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    static const uint32_t rates[] = RX_LOAD_RATES;
+    uint64_t seconds = 5;
+    uint32_t max_rate = 4000;
+    uint32_t cycles[3] = {150, 200, 1600};
+    uint32_t lost = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            seconds = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-m") == 0)
+        {
+            max_rate = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-i") == 0)
+        {
+            cycles[0] = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-f") == 0)
+        {
+            cycles[1] = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            cycles[2] = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+    }
+
+    if (seconds == 0)
+    {
+        fprintf(stderr, "opciones no válidas (segundos > 0)\n");
+        return 1;
+    }
+
+    printf("Modelo: %lu ciclos por interrupción, %lu por trama, %lu por pasada; %llu s medidos por corrida; "
+           "umbrales %u/%u tramas/s\n\n", (unsigned long)cycles[0], (unsigned long)cycles[1],
+           (unsigned long)cycles[2], (unsigned long long)seconds, CAN_HW_RX_POLL_ENTER_FPS, CAN_HW_RX_POLL_EXIT_FPS);
+
+    printf("%10s  %-10s %8s %8s %8s %8s %8s %8s %8s %10s %9s\n", "carga[tr/s]", "modo", "tramas", "interr",
+           "tr/int", "pasadas", "cambios", "perdidas", "CPU[%]", "ahorro[%]", "FIFO[us]");
+
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]) && rates[i] <= max_rate; i++)
+    {
+        rx_load_result_t irq;
+        rx_load_result_t adaptive;
+
+        if (!Rx_Load_Fork(rates[i], false, seconds, cycles, &irq) ||
+            !Rx_Load_Fork(rates[i], true, seconds, cycles, &adaptive))
+        {
+            fprintf(stderr, "corrida con carga %lu tramas/s falló\n", (unsigned long)rates[i]);
+            return 1;
+        }
+
+        printf("%10lu  %-10s %8lu %8lu %8.2f %8lu %8lu %8lu %8.2f %10s %9lu\n", (unsigned long)rates[i],
+               "por trama", (unsigned long)irq.frames, (unsigned long)irq.irqs,
+               irq.irqs ? (double)irq.frames / (double)irq.irqs : 0.0, (unsigned long)irq.passes,
+               (unsigned long)irq.switches, (unsigned long)irq.overruns, irq.cpu_pct, "",
+               (unsigned long)irq.wait_max_us);
+
+        printf("%10s  %-10s %8lu %8lu %8.2f %8lu %8lu %8lu %8.2f %10.1f %9lu\n", "", "adaptativa",
+               (unsigned long)adaptive.frames, (unsigned long)adaptive.irqs,
+               adaptive.irqs ? (double)(adaptive.frames - adaptive.poll_frames) / (double)adaptive.irqs : 0.0,
+               (unsigned long)adaptive.passes, (unsigned long)adaptive.switches, (unsigned long)adaptive.overruns,
+               adaptive.cpu_pct, irq.cpu_pct > 0.0 ? 100.0 * (irq.cpu_pct - adaptive.cpu_pct) / irq.cpu_pct : 0.0,
+               (unsigned long)adaptive.wait_max_us);
+
+        lost += adaptive.overruns;
+    }
+
+    if (lost != 0)
+    {
+        printf("\nFALLA: la recepción adaptativa perdió %lu tramas por FIFO llena\n", (unsigned long)lost);
+        return 1;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Ejecuta una corrida en un proceso hijo y lee su resultado.
+ *
+ * @param rate_fps  Tasa de carga en tramas/s
+ * @param adaptive  Recepción adaptativa (false: solo interrupción por trama)
+ * @param seconds   Segundos medidos
+ * @param cycles    Ciclos por interrupción, por trama y por pasada
+ * @param result    Resultado
+ * @retval true     Corrida terminada
+ * @retval false    Error al crear el proceso o corrida fallida
+ */
+static bool Rx_Load_Fork(uint32_t rate_fps, bool adaptive, uint64_t seconds, const uint32_t cycles[3],
+                         rx_load_result_t* result)
+{
+    int fds[2];
+    int status = 0;
+    pid_t pid;
+    bool ok;
+
+    if (pipe(fds) != 0)
+    {
+        return false;
+    }
+
+    fflush(stdout);
+
+    pid = fork();
+
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+
+        return false;
+    }
+
+    if (pid == 0)
+    {
+        rx_load_result_t child = Rx_Load_Run(rate_fps, adaptive, seconds, cycles);
+
+        close(fds[0]);
+
+        _exit((write(fds[1], &child, sizeof(child)) == (ssize_t)sizeof(child)) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+
+    ok = read(fds[0], result, sizeof(*result)) == (ssize_t)sizeof(*result);
+
+    close(fds[0]);
+    waitpid(pid, &status, 0);
+
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+/**
+ * @brief Corrida: arranque, calentamiento y medición de una tasa de carga con una política de recepción.
+ *
+ * @param rate_fps  Tasa de carga en tramas/s
+ * @param adaptive  Recepción adaptativa (false: solo interrupción por trama)
+ * @param seconds   Segundos medidos
+ * @param cycles    Ciclos por interrupción, por trama y por pasada
+ * @return rx_load_result_t
+ */
+static rx_load_result_t Rx_Load_Run(uint32_t rate_fps, bool adaptive, uint64_t seconds, const uint32_t cycles[3])
+{
+    rx_load_result_t result;
+    can_hw_rx_stats_t rx_start;
+    can_hw_rx_stats_t rx_end;
+    idle_stats_t idle_start;
+    idle_stats_t idle_end;
+    uint64_t pass_us = (cycles[2] + (SIM_CPU_HZ / 1000000UL) - 1U) / (SIM_CPU_HZ / 1000000UL);
+    uint64_t start_us;
+    uint64_t end_us;
+    uint32_t overruns;
+    double busy_cycles;
+
+    load_rate_fps = rate_fps;
+
+    SIM_Init();
+    SIM_Can_Set_Tx_Hook(Rx_Load_Tx_Hook);
+    SIM_Set_Advance_Hook(Rx_Load_Advance_Hook);
+
+    if (!adaptive)
+    {
+        CAN_HW_Set_Rx_Thresholds(UINT32_MAX, 0);
+    }
+
+    MX_APP_Init();
+
+    /* Primera pasada bloquea hasta que los módulos responden el echo */
+    MX_APP_Process();
+
+    end_us = SIM_Clock_Now_Us() + RX_LOAD_WARMUP_US;
+
+    while (SIM_Clock_Now_Us() < end_us)
+    {
+        MX_APP_Process();
+        SIM_Clock_Advance_Us(pass_us);
+    }
+
+    CAN_HW_Get_Rx_Stats(&rx_start);
+    IDLE_Get_Stats(&idle_start);
+    (void)SIM_Can_Take_Rx_Wait_Max_Us();
+    overruns = SIM_Can_Get_Rx_Overruns();
+    start_us = SIM_Clock_Now_Us();
+    end_us = start_us + seconds * 1000000U;
+
+    while (SIM_Clock_Now_Us() < end_us)
+    {
+        MX_APP_Process();
+        SIM_Clock_Advance_Us(pass_us);
+    }
+
+    CAN_HW_Get_Rx_Stats(&rx_end);
+    IDLE_Get_Stats(&idle_end);
+
+    result.irqs = (rx_end.irqs - rx_start.irqs) + (rx_end.full_irqs - rx_start.full_irqs);
+    result.frames = (rx_end.irq_frames - rx_start.irq_frames) + (rx_end.full_frames - rx_start.full_frames) +
+                    (rx_end.poll_frames - rx_start.poll_frames);
+    result.poll_frames = rx_end.poll_frames - rx_start.poll_frames;
+    result.passes = idle_end.wakeups - idle_start.wakeups;
+    result.switches = (rx_end.to_polled - rx_start.to_polled) + (rx_end.to_irq - rx_start.to_irq);
+    result.overruns = SIM_Can_Get_Rx_Overruns() - overruns;
+    result.wait_max_us = SIM_Can_Take_Rx_Wait_Max_Us();
+
+    busy_cycles = (double)result.irqs * cycles[0] + (double)result.frames * cycles[1] +
+                  (double)result.passes * cycles[2];
+    result.cpu_pct = 100.0 * busy_cycles / ((double)(SIM_Clock_Now_Us() - start_us) * (SIM_CPU_HZ / 1000000UL));
+
+    return result;
+}
+
+/**
+ * @brief Inicia el tráfico de los módulos y la carga al recibir el echo de Control.
+ *
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante de transmisión
+ * @retval true     Trama en mailbox (los mailboxes siempre la aceptan)
+ */
+static bool Rx_Load_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    if (id == CAN_ID_CONTROL_OK && !scenario_started)
+    {
+        scenario_started = true;
+        next_pedal_us = next_status_us = next_load_us = t_us + RX_LOAD_ECHO_DELAY_US;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Programa las tramas del escenario y de carga hasta el fin del tramo de avance.
+ *
+ * La carga tiene jitter de ±25 % del periodo (sin fase fija respecto de SysTick) y nunca dos tramas a menos de
+ * RX_LOAD_FRAME_US (un solo bus).
+ *
+ * @param target_us Fin del tramo
+ * @retval None
+ */
+static void Rx_Load_Advance_Hook(uint64_t target_us)
+{
+    static const uint32_t ok_ids[] = {CAN_ID_PERIFERICOS_OK, CAN_ID_BMS_OK, CAN_ID_DCDC_OK, CAN_ID_INVERSOR_OK};
+    const uint8_t ok = CAN_VALUE_MODULE_OK;
+    const uint8_t hm = CAN_VALUE_HOMBRE_MUERTO_OFF;
+    const uint8_t load = 0;
+
+    if (!scenario_started)
+    {
+        return;
+    }
+
+    while (next_pedal_us <= target_us)
+    {
+        SIM_Can_Schedule_Rx(next_pedal_us, CAN_ID_PERIFERICOS_PEDAL, &pedal_value, 1);
+
+        pedal_value = (uint8_t)((pedal_value + 1) % 100);
+        next_pedal_us += RX_LOAD_PEDAL_PERIOD_US;
+    }
+
+    while (next_status_us <= target_us)
+    {
+        for (size_t i = 0; i < sizeof(ok_ids) / sizeof(ok_ids[0]); i++)
+        {
+            SIM_Can_Schedule_Rx(next_status_us + i * RX_LOAD_FRAME_US, ok_ids[i], &ok, 1);
+        }
+
+        SIM_Can_Schedule_Rx(next_status_us + 4U * RX_LOAD_FRAME_US, CAN_ID_PERIFERICOS_HOMBRE_MUERTO, &hm, 1);
+
+        next_status_us += RX_LOAD_STATUS_PERIOD_US;
+    }
+
+    while (load_rate_fps != 0 && next_load_us <= target_us)
+    {
+        uint32_t period_us = 1000000U / load_rate_fps;
+        uint32_t gap_us;
+
+        SIM_Can_Schedule_Rx(next_load_us, RX_LOAD_ID, &load, 1);
+
+        /* Generador congruencial: misma secuencia en cada corrida */
+        load_seed = load_seed * 1103515245U + 12345U;
+        gap_us = period_us - period_us / 4U + (load_seed >> 16) % (period_us / 2U + 1U);
+
+        next_load_us += (gap_us < RX_LOAD_FRAME_US) ? RX_LOAD_FRAME_US : gap_us;
+    }
+}
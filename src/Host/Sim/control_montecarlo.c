@@ -0,0 +1,594 @@
+/**
+ * @file control_montecarlo.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Barrido Monte-Carlo de ventanas de fallas y rampas de pedal con muchas instancias de Control en paralelo
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Cada escenario es una instancia independiente de la aplicación (app_context_t) con su propia configuración:
+ * ventanas de persistencia de fallas y ganancia de las rampas de pedal sorteadas alrededor de app_config_default.
+ * Los escenarios se reparten entre hilos; cada hilo usa la HAL de instance_hal.h (tiempo virtual local al hilo).
+ *
+ * El runner ejecuta directamente la pasada de kRUNNING (MX_APP_Run_Pass) cada 1 ms de tiempo virtual, sin la
+ * espera de echo de arranque. Estímulo de cada escenario:
+ *   - Módulos envían su estado cada 100 ms y Periféricos el pedal (diente de sierra) cada 10 ms.
+ *   - Un botón de modo de manejo sorteado se mantiene presionado desde 1 s durante 200 ms.
+ *   - Glitch: BMS y DCDC reportan ERROR durante un tiempo sorteado en [0:500) ms (no debería provocar AUTOKILL).
+ *   - Con probabilidad 1/2, falla persistente de BMS y DCDC desde un instante sorteado (debe provocar AUTOKILL).
+ *   - Sin falla persistente, con probabilidad 1/4, objetivo alternante desde ese instante: BMS en ERROR y DCDC
+ *     intermitente (su estado cada 10 ms, alternando ERROR y OK), de modo que el destino de la máquina de fallas
+ *     alterna entre CAUTION2 y AUTOKILL. Debe salir de OK y llegar a CAUTION2.
+ *
+ * Resultados por escenario: instante de AUTOKILL, disparo falso (AUTOKILL sin falla persistente en curso),
+ * latencia de detección de la falla persistente, latencia hasta CAUTION2 con objetivo alternante y nivel de velocidad
+ * máximo. Termina con código de error si algún escenario con objetivo alternante no llega a CAUTION2. El sorteo de cada escenario depende
+ * solo de la semilla y de su índice, así los resultados no dependen del número de hilos.
+ *
+ * Uso: ./build/control_montecarlo [-n <escenarios>] [-j <hilos>] [-d <duracion_ms>] [-x <semilla>]
+ *                                 [-o <salida.csv>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "instance_hal.h"
+
+/* Application includes */
+#include "app_context.h"
+#include "app_control.h"
+#include "can_app.h"
+#include "can_def.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Periodo de la pasada de la aplicación en ms */
+#define MC_PASS_PERIOD_MS                   1U
+
+/** @brief Periodo de pedal de Periféricos en ms */
+#define MC_PEDAL_PERIOD_MS                  10U
+
+/** @brief Periodo de estado de los módulos en ms */
+#define MC_STATUS_PERIOD_MS                 100U
+
+/** @brief Periodo del trigger de transmisión (TIM7) en ms */
+#define MC_TX_PERIOD_MS                     100U
+
+/** @brief Inicio y duración de la pulsación de botón en ms */
+#define MC_BUTTON_START_MS                  1000U
+#define MC_BUTTON_LENGTH_MS                 200U
+
+/** @brief Duración máxima del glitch en ms */
+#define MC_GLITCH_MAX_MS                    500U
+
+/** @brief Duración mínima de un escenario en ms (glitch y falla persistente deben caber) */
+#define MC_MIN_DURATION_MS                  4000U
+
+/** @brief Máximo de hilos */
+#define MC_MAX_THREADS                      256
+
+/** @brief Periodo del estado intermitente de DCDC con objetivo alternante en ms */
+#define MC_FLICKER_PERIOD_MS                10U
+
+/** @brief Sin AUTOKILL (ni CAUTION2 con objetivo alternante) */
+#define MC_NO_AUTOKILL                      UINT32_MAX
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Escenario sorteado */
+typedef struct
+{
+    app_config_t    config;             /**< Configuración de la instancia */
+    float           pedal_gain;         /**< Ganancia aplicada a las rampas de pedal */
+    uint8_t         button;             /**< Valor CAN del botón presionado */
+    uint32_t        glitch_start_ms;    /**< Inicio del glitch */
+    uint32_t        glitch_ms;          /**< Duración del glitch */
+    bool            fault;              /**< Hay falla persistente */
+    uint32_t        fault_start_ms;     /**< Inicio de la falla persistente (o del objetivo alternante) */
+    bool            alternate;          /**< Hay objetivo alternante (sin falla persistente) */
+
+} mc_scenario_t;
+
+/** @brief Resultado de un escenario */
+typedef struct
+{
+    uint32_t        autokill_ms;        /**< Primer instante con falla AUTOKILL (MC_NO_AUTOKILL si no hubo) */
+    uint32_t        caution2_ms;        /**< Con objetivo alternante, primer instante en CAUTION2 o más severo */
+    uint8_t         nivel_max;          /**< Nivel de velocidad máximo en el bus de salida */
+    uint32_t        tx_frames;          /**< Tramas transmitidas */
+
+} mc_result_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Número de escenarios */
+static uint32_t scenario_count = 1000;
+
+/** @brief Duración de cada escenario en ms */
+static uint32_t duration_ms = 10000;
+
+/** @brief Semilla */
+static uint64_t seed = 1;
+
+/** @brief Próximo escenario a ejecutar */
+static atomic_uint next_scenario;
+
+/** @brief Resultados por escenario */
+static mc_result_t* results = NULL;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void* MC_Worker(void* arg);
+static void MC_Draw_Scenario(uint32_t index, mc_scenario_t* scenario);
+static void MC_Run_Scenario(const mc_scenario_t* scenario, mc_result_t* result);
+static void MC_Deliver(app_context_t* ctx, uint32_t id, uint8_t value);
+static void MC_Tx_Hook(void* user, uint32_t id, const uint8_t* data, uint8_t dlc);
+static void MC_Scale_Map(rampa_pedal_map_t* map, float gain);
+static uint64_t MC_Rand(uint64_t* state);
+static uint32_t MC_Rand_Range(uint64_t* state, uint32_t min, uint32_t max);
+static double Wall_Time_S(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* csv_name = NULL;
+    pthread_t workers[MC_MAX_THREADS];
+    uint32_t faults = 0;
+    uint32_t detected = 0;
+    uint32_t false_trips = 0;
+    uint64_t latency_sum = 0;
+    uint32_t latency_min = UINT32_MAX;
+    uint32_t latency_max = 0;
+    uint32_t alternates = 0;
+    uint32_t escalated = 0;
+    uint32_t escalate_max = 0;
+    double wall_start;
+    double wall;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-n") == 0)
+        {
+            scenario_count = strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-j") == 0)
+        {
+            threads = strtol(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            duration_ms = strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-x") == 0)
+        {
+            seed = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-o") == 0)
+        {
+            csv_name = argv[i + 1];
+        }
+    }
+
+    if (scenario_count == 0 || threads < 1 || threads > MC_MAX_THREADS || duration_ms < MC_MIN_DURATION_MS)
+    {
+        fprintf(stderr, "opciones no válidas (escenarios > 0, hilos [1:%d], duración >= %u ms)\n",
+                MC_MAX_THREADS, MC_MIN_DURATION_MS);
+        return EXIT_FAILURE;
+    }
+
+    results = calloc(scenario_count, sizeof(mc_result_t));
+
+    if (results == NULL)
+    {
+        fprintf(stderr, "sin memoria para %lu escenarios\n", (unsigned long)scenario_count);
+        return EXIT_FAILURE;
+    }
+
+    atomic_init(&next_scenario, 0);
+
+    wall_start = Wall_Time_S();
+
+    for (long t = 0; t < threads; t++)
+    {
+        if (pthread_create(&workers[t], NULL, MC_Worker, NULL) != 0)
+        {
+            fprintf(stderr, "no se pudo crear el hilo %ld\n", t);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (long t = 0; t < threads; t++)
+    {
+        pthread_join(workers[t], NULL);
+    }
+
+    wall = Wall_Time_S() - wall_start;
+
+    FILE* csv = (csv_name != NULL) ? fopen(csv_name, "w") : NULL;
+
+    if (csv_name != NULL && csv == NULL)
+    {
+        fprintf(stderr, "no se pudo abrir %s\n", csv_name);
+    }
+
+    if (csv != NULL)
+    {
+        fprintf(csv, "scenario,escalate_ms,recover_ms,autokill_count,autokill_ms,pedal_gain,button,glitch_start_ms,"
+                     "glitch_ms,fault_start_ms,autokill_t_ms,false_trip,latency_ms,nivel_max,tx_frames,alternate,"
+                     "caution2_latency_ms\n");
+    }
+
+    /* Resumen en orden de escenario (independiente del reparto entre hilos) */
+    for (uint32_t i = 0; i < scenario_count; i++)
+    {
+        mc_scenario_t scenario;
+        const mc_result_t* result = &results[i];
+        bool tripped = (result->autokill_ms != MC_NO_AUTOKILL);
+        bool false_trip;
+        uint32_t latency = 0;
+
+        MC_Draw_Scenario(i, &scenario);
+
+        false_trip = tripped && (!scenario.fault || result->autokill_ms < scenario.fault_start_ms);
+
+        if (scenario.fault)
+        {
+            faults++;
+        }
+
+        if (false_trip)
+        {
+            false_trips++;
+        }
+        else if (tripped)
+        {
+            latency = result->autokill_ms - scenario.fault_start_ms;
+
+            detected++;
+            latency_sum += latency;
+            latency_min = (latency < latency_min) ? latency : latency_min;
+            latency_max = (latency > latency_max) ? latency : latency_max;
+        }
+
+        if (scenario.alternate)
+        {
+            alternates++;
+
+            if (result->caution2_ms != MC_NO_AUTOKILL)
+            {
+                uint32_t escalate = result->caution2_ms - scenario.fault_start_ms;
+
+                escalated++;
+                escalate_max = (escalate > escalate_max) ? escalate : escalate_max;
+            }
+        }
+
+        if (csv != NULL)
+        {
+            fprintf(csv, "%lu,%u,%u,%u,%u,%.3f,%u,%lu,%lu,%ld,%ld,%d,%lu,%u,%lu,%d,%ld\n", (unsigned long)i,
+                    scenario.config.failures.escalate.min_time_ms, scenario.config.failures.recover.min_time_ms,
+                    scenario.config.failures.autokill.min_count, scenario.config.failures.autokill.min_time_ms,
+                    scenario.pedal_gain, scenario.button, (unsigned long)scenario.glitch_start_ms,
+                    (unsigned long)scenario.glitch_ms, scenario.fault ? (long)scenario.fault_start_ms : -1L,
+                    tripped ? (long)result->autokill_ms : -1L, false_trip ? 1 : 0, (unsigned long)latency,
+                    result->nivel_max, (unsigned long)result->tx_frames, scenario.alternate ? 1 : 0,
+                    (scenario.alternate && result->caution2_ms != MC_NO_AUTOKILL)
+                        ? (long)(result->caution2_ms - scenario.fault_start_ms) : -1L);
+        }
+    }
+
+    if (csv != NULL)
+    {
+        fclose(csv);
+    }
+
+    printf("Escenarios: %lu de %lu ms virtuales, hilos: %ld, tiempo real: %.3f s\n", (unsigned long)scenario_count,
+           (unsigned long)duration_ms, threads, wall);
+    printf("Rendimiento: %.1f escenarios/s, %.1f escenarios/s por núcleo, %.0f pasadas/s\n",
+           (double)scenario_count / wall, (double)scenario_count / wall / (double)threads,
+           (double)scenario_count * (double)(duration_ms / MC_PASS_PERIOD_MS) / wall);
+    printf("Fallas persistentes: %lu, detectadas: %lu", (unsigned long)faults, (unsigned long)detected);
+
+    if (detected != 0)
+    {
+        printf(" (latencia [ms]: min %lu, media %lu, max %lu)", (unsigned long)latency_min,
+               (unsigned long)(latency_sum / detected), (unsigned long)latency_max);
+    }
+
+    printf("\nDisparos falsos: %lu (%.2f %%)\n", (unsigned long)false_trips,
+           100.0 * (double)false_trips / (double)scenario_count);
+    printf("Objetivo alternante: %lu, llegaron a CAUTION2: %lu (latencia max %lu ms)\n", (unsigned long)alternates,
+           (unsigned long)escalated, (unsigned long)escalate_max);
+
+    free(results);
+
+    if (escalated != alternates)
+    {
+        fprintf(stderr, "%lu escenario(s) con objetivo alternante no salieron de OK\n",
+                (unsigned long)(alternates - escalated));
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Hilo de trabajo: toma escenarios hasta agotarlos.
+ *
+ * @param arg       No se usa
+ * @return void*    NULL
+ */
+static void* MC_Worker(void* arg)
+{
+    unsigned int i;
+
+    while ((i = atomic_fetch_add(&next_scenario, 1U)) < scenario_count)
+    {
+        mc_scenario_t scenario;
+
+        MC_Draw_Scenario(i, &scenario);
+        MC_Run_Scenario(&scenario, &results[i]);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Sortea el escenario de un índice a partir de la semilla.
+ *
+ * @param index     Índice del escenario
+ * @param scenario  Escenario
+ * @retval None
+ */
+static void MC_Draw_Scenario(uint32_t index, mc_scenario_t* scenario)
+{
+    static const uint8_t buttons[] = {CAN_VALUE_BTN_NONE, CAN_VALUE_BTN_ECO, CAN_VALUE_BTN_NORMAL, CAN_VALUE_BTN_SPORT};
+    uint64_t state = seed ^ ((uint64_t)index * 0x9E3779B97F4A7C15ULL);
+    failures_config_t* failures = &scenario->config.failures;
+
+    memset(scenario, 0, sizeof(*scenario));
+
+    scenario->config = app_config_default;
+
+    /* Ventanas de persistencia (el camino crítico queda fijo) */
+    failures->escalate.min_count = (uint16_t)MC_Rand_Range(&state, 1, 5);
+    failures->escalate.min_time_ms = (uint16_t)MC_Rand_Range(&state, 0, 100);
+    failures->recover.min_count = (uint16_t)MC_Rand_Range(&state, 1, 10);
+    failures->recover.min_time_ms = (uint16_t)MC_Rand_Range(&state, 100, 1000);
+    failures->autokill.min_count = (uint16_t)MC_Rand_Range(&state, 1, 10);
+    failures->autokill.min_time_ms = (uint16_t)MC_Rand_Range(&state, 50, 500);
+
+    /* Rampas de pedal con ganancia en [0.8:1.2] */
+    scenario->pedal_gain = 0.8f + 0.4f * (float)MC_Rand_Range(&state, 0, 1000) / 1000.0f;
+
+    MC_Scale_Map(&scenario->config.pedal_eco, scenario->pedal_gain);
+    MC_Scale_Map(&scenario->config.pedal_normal, scenario->pedal_gain);
+    MC_Scale_Map(&scenario->config.pedal_sport, scenario->pedal_gain);
+
+    /* Estímulo */
+    scenario->button = buttons[MC_Rand_Range(&state, 0, 3)];
+    scenario->glitch_start_ms = MC_Rand_Range(&state, duration_ms / 4, duration_ms / 4 + duration_ms / 8);
+    scenario->glitch_ms = MC_Rand_Range(&state, 0, MC_GLITCH_MAX_MS - 1);
+    scenario->fault = (MC_Rand(&state) & 1U) != 0;
+    scenario->fault_start_ms = MC_Rand_Range(&state, duration_ms / 2, duration_ms / 2 + duration_ms / 4);
+    scenario->alternate = !scenario->fault && (MC_Rand(&state) & 3U) == 0;
+}
+
+/**
+ * @brief Ejecuta un escenario en una instancia nueva de la aplicación.
+ *
+ * @param scenario  Escenario
+ * @param result    Resultado
+ * @retval None
+ */
+static void MC_Run_Scenario(const mc_scenario_t* scenario, mc_result_t* result)
+{
+    app_context_t ctx;
+    uint8_t pedal = 0;
+
+    result->autokill_ms = MC_NO_AUTOKILL;
+    result->caution2_ms = MC_NO_AUTOKILL;
+    result->nivel_max = 0;
+    result->tx_frames = 0;
+
+    INSTANCE_HAL_Reset();
+    INSTANCE_HAL_Set_Tx_Hook(MC_Tx_Hook, result);
+
+    APP_CONTEXT_Init(&ctx, &scenario->config);
+
+    if (CAN_API_Init(&ctx.can_obj, STANDARD_FRAME, NORMAL_MSG, CAN_Wrapper_Init, CAN_Wrapper_TransmitData,
+                     CAN_Wrapper_ReceiveData, CAN_Wrapper_DataCount) != CAN_STATUS_OK)
+    {
+        Error_Handler();
+    }
+
+    for (uint32_t t = 0; t < duration_ms; t += MC_PASS_PERIOD_MS)
+    {
+        INSTANCE_HAL_Set_Time_Ms(t);
+
+        if (t % MC_PEDAL_PERIOD_MS == 0)
+        {
+            MC_Deliver(&ctx, CAN_ID_PERIFERICOS_PEDAL, pedal);
+
+            pedal = (uint8_t)((pedal + 1) % 100);
+        }
+
+        if (t % MC_STATUS_PERIOD_MS == 0)
+        {
+            bool glitch = (t >= scenario->glitch_start_ms && t < scenario->glitch_start_ms + scenario->glitch_ms);
+            bool fault = (scenario->fault && t >= scenario->fault_start_ms);
+            bool alternate = (scenario->alternate && t >= scenario->fault_start_ms);
+            uint8_t faulty = (glitch || fault) ? CAN_VALUE_MODULE_ERROR : CAN_VALUE_MODULE_OK;
+            bool pressed = (t >= MC_BUTTON_START_MS && t < MC_BUTTON_START_MS + MC_BUTTON_LENGTH_MS);
+
+            MC_Deliver(&ctx, CAN_ID_PERIFERICOS_OK, CAN_VALUE_MODULE_OK);
+            MC_Deliver(&ctx, CAN_ID_BMS_OK, alternate ? CAN_VALUE_MODULE_ERROR : faulty);
+
+            /* Con objetivo alternante el estado de DCDC llega aparte (MC_FLICKER_PERIOD_MS) */
+            if (!alternate)
+            {
+                MC_Deliver(&ctx, CAN_ID_DCDC_OK, faulty);
+            }
+
+            MC_Deliver(&ctx, CAN_ID_INVERSOR_OK, CAN_VALUE_MODULE_OK);
+            MC_Deliver(&ctx, CAN_ID_PERIFERICOS_HOMBRE_MUERTO, CAN_VALUE_HOMBRE_MUERTO_OFF);
+            MC_Deliver(&ctx, CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO, pressed ? scenario->button : CAN_VALUE_BTN_NONE);
+        }
+
+        /* Objetivo alternante: DCDC intermitente */
+        if (scenario->alternate && t >= scenario->fault_start_ms && t % MC_FLICKER_PERIOD_MS == 0)
+        {
+            bool error = ((t / MC_FLICKER_PERIOD_MS) % 2U) == 0;
+
+            MC_Deliver(&ctx, CAN_ID_DCDC_OK, error ? CAN_VALUE_MODULE_ERROR : CAN_VALUE_MODULE_OK);
+        }
+
+        /* Update event de TIM7 a mitad de periodo de estado */
+        if (t % MC_TX_PERIOD_MS == MC_TX_PERIOD_MS / 2)
+        {
+            ctx.flag_tx_can = CAN_TX_READY;
+        }
+
+        MX_APP_Run_Pass(&ctx);
+
+        if (ctx.bus_data.failure == kFAILURE_AUTOKILL && result->autokill_ms == MC_NO_AUTOKILL)
+        {
+            result->autokill_ms = t;
+        }
+
+        if (scenario->alternate && t >= scenario->fault_start_ms && result->caution2_ms == MC_NO_AUTOKILL
+            && (ctx.bus_data.failure == kFAILURE_CAUTION2 || ctx.bus_data.failure == kFAILURE_AUTOKILL))
+        {
+            result->caution2_ms = t;
+        }
+
+        if (ctx.bus_can_output.nivel_velocidad > result->nivel_max)
+        {
+            result->nivel_max = ctx.bus_can_output.nivel_velocidad;
+        }
+    }
+}
+
+/**
+ * @brief Entrega una trama de un byte a la instancia, como la ISR de recepción en la tarjeta.
+ *
+ * @param ctx       Contexto de la instancia
+ * @param id        Identificador
+ * @param value     Dato
+ * @retval None
+ */
+static void MC_Deliver(app_context_t* ctx, uint32_t id, uint8_t value)
+{
+    can_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+
+    frame.id = id;
+    frame.payload_length = 1;
+    frame.payload_buff[0] = value;
+
+    CAN_APP_Store_ReceivedMessage(ctx, &frame);
+
+    ctx->flag_rx_can = CAN_MSG_RECEIVED;
+}
+
+/**
+ * @brief Cuenta las tramas transmitidas por la instancia.
+ *
+ * @param user      Resultado del escenario
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @retval None
+ */
+static void MC_Tx_Hook(void* user, uint32_t id, const uint8_t* data, uint8_t dlc)
+{
+    ((mc_result_t*)user)->tx_frames++;
+}
+
+/**
+ * @brief Escala una rampa de pedal (pendientes y ordenadas, así se mantiene la continuidad entre tramos).
+ *
+ * @param map       Rampa
+ * @param gain      Ganancia
+ * @retval None
+ */
+static void MC_Scale_Map(rampa_pedal_map_t* map, float gain)
+{
+    for (int i = 0; i < RAMPA_PEDAL_NUM_OF_SEGMENTS; i++)
+    {
+        map->segment[i].slope *= gain;
+        map->segment[i].offset *= gain;
+    }
+}
+
+/**
+ * @brief Generador splitmix64.
+ *
+ * @param state     Estado
+ * @return uint64_t Número pseudoaleatorio
+ */
+static uint64_t MC_Rand(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Entero pseudoaleatorio en [min:max].
+ *
+ * @param state     Estado
+ * @param min       Mínimo
+ * @param max       Máximo
+ * @return uint32_t
+ */
+static uint32_t MC_Rand_Range(uint64_t* state, uint32_t min, uint32_t max)
+{
+    return min + (uint32_t)(MC_Rand(state) % ((uint64_t)max - min + 1U));
+}
+
+/**
+ * @brief Tiempo real monotónico en segundos.
+ *
+ * @return double
+ */
+static double Wall_Time_S(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
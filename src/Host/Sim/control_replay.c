@@ -0,0 +1,453 @@
+/**
+ * @file control_replay.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Reproducción de logs CAN (candump/ASC) sobre la aplicación de Control en tiempo virtual
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Inyecta cada trama del log por la ruta de recepción (HAL_CAN_RxFifo0MsgPendingCallback →
+ * CAN_APP_Store_ReceivedMessage) en su instante registrado sobre el reloj virtual de sim.h, tan rápido
+ * como permita la CPU: mientras no hay trabajo pendiente el reloj salta al próximo evento (a lo más
+ * -q us, para que los timeouts de la aplicación se evalúen con esa resolución). Solo se inyectan las
+ * tramas que aceptan los filtros de hardware de la tarjeta, sin las tramas propias de Control.
+ *
+ * Cada trama transmitida por la aplicación se guarda en formato candump -l. Con -g se compara la salida
+ * con un archivo golden y el programa termina con código 1 si difieren. La ejecución es determinista:
+ * el mismo log y opciones producen siempre la misma salida.
+ *
+ * Uso: ./build/control_replay <log> [-o <salida.log>] [-g <golden.log>] [-p <us_por_pasada>]
+ *                             [-q <us_max_sin_trabajo>] [-t <us_inicio_log>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "can_log.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "can_def.h"
+#include "can_hw.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Salida por defecto */
+#define REPLAY_DEFAULT_OUTPUT               "replay_tx.log"
+
+/** @brief Interfaz escrita en la salida */
+#define REPLAY_IFNAME                       "can0"
+
+/** @brief Tiempo simulado después de la última trama del log en us */
+#define REPLAY_TAIL_US                      1000000U
+
+/** @brief Diferencias mostradas al comparar con golden */
+#define REPLAY_MAX_DIFFS_SHOWN              10
+
+/** @brief Máscara de filtros de recepción de la tarjeta (ver CAN_FilterConfig en can_wrapper.c) */
+#define REPLAY_FILTER_MASK                  0x7F8U
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Log de entrada */
+static FILE* log_file = NULL;
+
+/** @brief Salida de tramas transmitidas */
+static FILE* out_file = NULL;
+
+/** @brief Próxima trama del log */
+static can_log_frame_t next_frame;
+
+/** @brief Hay próxima trama */
+static bool have_next = false;
+
+/** @brief Marca de tiempo de la primera trama del log */
+static uint64_t log_t0_us = 0;
+
+/** @brief Instante virtual en que se reproduce la primera trama del log */
+static uint64_t start_us = 0;
+
+/** @brief Instante virtual de término (válido al terminar el log) */
+static uint64_t end_us = 0;
+
+/** @brief Contadores */
+static uint64_t frames_read = 0;
+static uint64_t frames_injected = 0;
+static uint64_t frames_filtered = 0;
+static uint64_t lines_without_time = 0;
+static uint64_t frames_tx = 0;
+static uint64_t passes = 0;
+
+/** @brief Opciones */
+static const char* out_path = REPLAY_DEFAULT_OUTPUT;
+static const char* golden_path = NULL;
+
+/** @brief Inicio en tiempo real */
+static double wall_start;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Replay_Read_Next(void);
+static uint64_t Replay_Frame_Time(const can_log_frame_t* frame);
+static bool Replay_Accept(const can_log_frame_t* frame);
+static void Replay_Advance_Hook(uint64_t target_us);
+static bool Replay_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+static void Replay_Finish(void);
+static uint64_t Replay_Diff(const char* golden, const char* output);
+static double Wall_Time_S(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    uint64_t pass_cost_us = 20;
+    uint64_t idle_max_us = 1000;
+    const app_context_t* app;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "uso: %s <log> [-o salida.log] [-g golden.log] [-p us_por_pasada] "
+                        "[-q us_max_sin_trabajo] [-t us_inicio_log]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 2; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-o") == 0)
+        {
+            out_path = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-g") == 0)
+        {
+            golden_path = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            pass_cost_us = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            idle_max_us = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-t") == 0)
+        {
+            start_us = strtoull(argv[i + 1], NULL, 0);
+        }
+    }
+
+    if (pass_cost_us == 0)
+    {
+        pass_cost_us = 1;
+    }
+
+    if (idle_max_us < pass_cost_us)
+    {
+        idle_max_us = pass_cost_us;
+    }
+
+    log_file = fopen(argv[1], "r");
+    out_file = fopen(out_path, "w");
+
+    if (log_file == NULL || out_file == NULL)
+    {
+        fprintf(stderr, "no se pudo abrir %s\n", (log_file == NULL) ? argv[1] : out_path);
+        return EXIT_FAILURE;
+    }
+
+    Replay_Read_Next();
+
+    if (!have_next)
+    {
+        fprintf(stderr, "%s no contiene tramas con marca de tiempo\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    log_t0_us = next_frame.t_us;
+
+    SIM_Init();
+    SIM_Can_Set_Tx_Hook(Replay_Tx_Hook);
+    SIM_Set_Advance_Hook(Replay_Advance_Hook);
+
+    wall_start = Wall_Time_S();
+
+    MX_APP_Init();
+
+    app = MX_APP_Get_Context();
+
+    /* Termina desde Replay_Advance_Hook al cumplirse el tiempo tras la última trama */
+    while (1)
+    {
+        uint64_t now;
+        uint64_t next;
+        uint64_t step = pass_cost_us;
+
+        MX_APP_Process();
+        passes++;
+
+        /* Sin trabajo pendiente: salta al próximo evento (TIM7, trama programada o del log) */
+        if (app->flag_rx_can != CAN_MSG_RECEIVED && app->flag_tx_can != CAN_TX_READY)
+        {
+            now = SIM_Clock_Now_Us();
+            next = SIM_Clock_Next_Event_Us();
+
+            if (have_next && Replay_Frame_Time(&next_frame) < next)
+            {
+                next = Replay_Frame_Time(&next_frame);
+            }
+
+            if (next > now + pass_cost_us)
+            {
+                step = (next - now > idle_max_us) ? idle_max_us : next - now;
+            }
+        }
+
+        SIM_Clock_Advance_Us(step);
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Lee la próxima trama con marca de tiempo del log.
+ *
+ * @param None
+ * @retval None
+ */
+static void Replay_Read_Next(void)
+{
+    char line[CAN_LOG_LINE_MAX_LENGTH];
+
+    have_next = false;
+
+    while (fgets(line, sizeof(line), log_file) != NULL)
+    {
+        if (!CAN_LOG_Parse_Line(line, &next_frame))
+        {
+            continue;
+        }
+
+        if (!next_frame.has_time)
+        {
+            lines_without_time++;
+            continue;
+        }
+
+        frames_read++;
+        have_next = true;
+
+        return;
+    }
+}
+
+/**
+ * @brief Retorna el instante virtual de una trama del log.
+ *
+ * @param frame     Trama
+ * @return uint64_t
+ */
+static uint64_t Replay_Frame_Time(const can_log_frame_t* frame)
+{
+    /* Tramas fuera de orden antes del inicio se reproducen al inicio */
+    return start_us + ((frame->t_us > log_t0_us) ? frame->t_us - log_t0_us : 0);
+}
+
+/**
+ * @brief Indica si la tarjeta recibiría una trama (filtros de hardware, sin sus propias tramas).
+ *
+ * @param frame     Trama
+ * @retval true     Trama aceptada
+ * @retval false    Trama descartada
+ */
+static bool Replay_Accept(const can_log_frame_t* frame)
+{
+    uint32_t base = frame->id & REPLAY_FILTER_MASK;
+
+    if (frame->extended || frame->id == CAN_ID_CONTROL_AUTOKILL)
+    {
+        return false;
+    }
+
+    return base == 0x000 || base == 0x020 || base == 0x030 || base == 0x040;
+}
+
+/**
+ * @brief Programa las tramas del log que vencen hasta el instante del tramo y termina tras la última.
+ *
+ * @param target_us     Fin del tramo de avance
+ * @retval None
+ */
+static void Replay_Advance_Hook(uint64_t target_us)
+{
+    while (have_next && Replay_Frame_Time(&next_frame) <= target_us)
+    {
+        if (!Replay_Accept(&next_frame))
+        {
+            frames_filtered++;
+        }
+        else if (SIM_Can_Schedule_Rx(Replay_Frame_Time(&next_frame), next_frame.id, next_frame.data,
+                                     next_frame.dlc))
+        {
+            frames_injected++;
+        }
+        else
+        {
+            /* Cola llena: se reintenta en el próximo tramo */
+            break;
+        }
+
+        end_us = Replay_Frame_Time(&next_frame) + REPLAY_TAIL_US;
+
+        Replay_Read_Next();
+    }
+
+    if (!have_next && target_us >= end_us)
+    {
+        Replay_Finish();
+    }
+}
+
+/**
+ * @brief Guarda cada trama transmitida por Control.
+ *
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante de transmisión
+ * @retval true     Trama en mailbox (los mailboxes siempre la aceptan)
+ */
+static bool Replay_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    frames_tx++;
+
+    CAN_LOG_Write_Frame(out_file, t_us, REPLAY_IFNAME, id, data, dlc);
+
+    return true;
+}
+
+/**
+ * @brief Imprime el resumen, compara con golden y termina el proceso.
+ *
+ * @param None
+ * @retval None
+ */
+static void Replay_Finish(void)
+{
+    double wall = Wall_Time_S() - wall_start;
+    double virtual_s = (double)SIM_Clock_Now_Us() / 1e6;
+    uint64_t diffs = 0;
+
+    fclose(out_file);
+    fclose(log_file);
+
+    printf("Log: %llu tramas (%llu inyectadas, %llu descartadas por filtros), %llu líneas sin marca de tiempo\n",
+           (unsigned long long)frames_read, (unsigned long long)frames_injected,
+           (unsigned long long)frames_filtered, (unsigned long long)lines_without_time);
+
+    printf("Tiempo virtual: %.3f s, tiempo real: %.3f s (x%.0f), pasadas: %llu\n",
+           virtual_s, wall, virtual_s / wall, (unsigned long long)passes);
+
+    printf("Velocidad de reproducción: %.0f tramas/s\n", (double)frames_injected / wall);
+
+    printf("Tramas transmitidas: %llu -> %s\n", (unsigned long long)frames_tx, out_path);
+
+    if (golden_path != NULL)
+    {
+        diffs = Replay_Diff(golden_path, out_path);
+
+        printf("Golden %s: %s (%llu líneas distintas)\n", golden_path, (diffs == 0) ? "igual" : "DISTINTO",
+               (unsigned long long)diffs);
+    }
+
+    exit((diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Compara línea a línea la salida con el golden y muestra las primeras diferencias.
+ *
+ * @param golden    Archivo golden
+ * @param output    Archivo de salida
+ * @return uint64_t Líneas distintas (incluye líneas sobrantes o faltantes)
+ */
+static uint64_t Replay_Diff(const char* golden, const char* output)
+{
+    FILE* a = fopen(golden, "r");
+    FILE* b = fopen(output, "r");
+    char line_a[CAN_LOG_LINE_MAX_LENGTH];
+    char line_b[CAN_LOG_LINE_MAX_LENGTH];
+    uint64_t line = 0;
+    uint64_t diffs = 0;
+
+    if (a == NULL || b == NULL)
+    {
+        fprintf(stderr, "no se pudo abrir %s\n", (a == NULL) ? golden : output);
+
+        return 1;
+    }
+
+    while (1)
+    {
+        bool has_a = fgets(line_a, sizeof(line_a), a) != NULL;
+        bool has_b = fgets(line_b, sizeof(line_b), b) != NULL;
+
+        if (!has_a && !has_b)
+        {
+            break;
+        }
+
+        line++;
+
+        if (has_a && has_b && strcmp(line_a, line_b) == 0)
+        {
+            continue;
+        }
+
+        if (diffs < REPLAY_MAX_DIFFS_SHOWN)
+        {
+            printf("  línea %llu\n", (unsigned long long)line);
+            printf("    - %s", has_a ? line_a : "(fin)\n");
+            printf("    + %s", has_b ? line_b : "(fin)\n");
+        }
+
+        diffs++;
+    }
+
+    fclose(a);
+    fclose(b);
+
+    return diffs;
+}
+
+/**
+ * @brief Retorna el tiempo real en segundos.
+ *
+ * @return double
+ */
+static double Wall_Time_S(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,386 @@
+/**
+ * @file control_rtos.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Ejecución de la aplicación de Control con tareas de FreeRTOS sobre el port POSIX
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Compila el mismo grafo de tareas que la tarjeta con USE_FREERTOS_FEATURE (app_rtos.h) y lo ejecuta en tiempo
+ * real contra la HAL de rtos_hal.h. Una tarea de escenario, con prioridad mayor que las de la aplicación, hace
+ * de ISRs: responde el echo de Control, envía pedal cada 10 ms, estado de los módulos cada 100 ms, un pulso de
+ * hombre muerto cada 2 s y el trigger de TIM7.
+ *
+ * Al terminar imprime el tiempo de respuesta pedal -> nivel de velocidad y hombre muerto -> velocidad 0 (desde
+ * la "ISR" hasta que la trama queda en mailbox), y por tarea la prioridad, el stack libre mínimo y el uso de CPU.
+ * Termina con error si una respuesta supera el límite, si se descartaron tramas o si a una tarea le quedan
+ * menos de SCENARIO_STACK_MIN_FREE palabras de stack libres.
+ *
+ * Uso: ./build/control_rtos [-s <segundos>] [-l <us_maximo_respuesta>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rtos_hal.h"
+#include "sim.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "app_rtos.h"
+#include "can_def.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Prioridad de la tarea de escenario (hace de ISRs: sobre todas las de la aplicación) */
+#define SCENARIO_PRIORITY                   (configMAX_PRIORITIES - 1U)
+
+/** @brief Stack de la tarea de escenario en palabras */
+#define SCENARIO_STACK                      (configMINIMAL_STACK_SIZE + 1024U)
+
+/** @brief Periodo de pedal de Periféricos en ms */
+#define SCENARIO_PEDAL_PERIOD_MS            10U
+
+/** @brief Periodo de estado de los módulos en ms */
+#define SCENARIO_STATUS_PERIOD_MS           100U
+
+/** @brief Periodo de los pulsos de hombre muerto en ms */
+#define SCENARIO_DEADMAN_PERIOD_MS          2000U
+
+/** @brief Duración de cada pulso de hombre muerto en ms */
+#define SCENARIO_DEADMAN_PULSE_MS           200U
+
+/** @brief Stack libre mínimo aceptado por tarea en palabras */
+#define SCENARIO_STACK_MIN_FREE             64U
+
+/** @brief Máximo de tareas en el reporte */
+#define SCENARIO_MAX_TASKS                  16U
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tiempos de respuesta de un estímulo
+ *
+ */
+typedef struct
+{
+    volatile bool       pending;        /**< Estímulo sin respuesta */
+    volatile uint64_t   t_in_us;        /**< Instante del estímulo */
+    uint32_t            stimuli;        /**< Estímulos enviados */
+    uint32_t            count;          /**< Respuestas */
+    uint64_t            sum;            /**< Suma de tiempos de respuesta en us */
+    uint64_t            min;            /**< Mínimo en us */
+    uint64_t            max;            /**< Máximo en us */
+} scenario_response_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Duración de la ejecución desde la respuesta al echo en s */
+static uint32_t run_seconds = 10;
+
+/** @brief Tiempo de respuesta máximo aceptado en us */
+static uint64_t max_response_us = 5000;
+
+/** @brief Los módulos respondieron el echo */
+static volatile bool echo_received = false;
+
+/** @brief Respuesta pedal -> nivel de velocidad */
+static scenario_response_t pedal_response;
+
+/** @brief Respuesta hombre muerto -> velocidad 0 */
+static scenario_response_t deadman_response;
+
+/** @brief Tramas inyectadas */
+static uint32_t rx_frames = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Scenario_Task(void* argument);
+static bool Scenario_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+static void Scenario_Rx(uint32_t id, uint8_t value);
+static void Scenario_Stimulus(scenario_response_t* response);
+static void Scenario_Response(scenario_response_t* response, uint64_t t_us);
+static bool Scenario_Report_Response(const char* name, const scenario_response_t* response);
+static bool Scenario_Report_Tasks(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            run_seconds = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-l") == 0)
+        {
+            max_response_us = strtoull(argv[i + 1], NULL, 0);
+        }
+    }
+
+    RTOS_HAL_Init();
+    SIM_Can_Set_Tx_Hook(Scenario_Tx_Hook);
+
+    /* Crea colas y tareas de la aplicación (APP_RTOS_Init) e inicia CAN */
+    MX_APP_Init();
+
+    if (xTaskCreate(Scenario_Task, "SCENARIO", SCENARIO_STACK, NULL, SCENARIO_PRIORITY, NULL) != pdPASS)
+    {
+        Error_Handler();
+    }
+
+    APP_RTOS_Start();
+
+    return EXIT_FAILURE;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Tarea de escenario: tráfico de los módulos y trigger de TIM7, con periodo de un tick.
+ *
+ * @param argument No se usa
+ * @retval None
+ */
+static void Scenario_Task(void* argument)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    TickType_t tim7_ticks = pdMS_TO_TICKS(htim7.period_us / 1000U);
+    TickType_t start = 0;
+    TickType_t now;
+    uint8_t pedal_value = 0;
+    bool ok;
+
+    for (;;)
+    {
+        vTaskDelayUntil(&last_wake, 1);
+        now = xTaskGetTickCount();
+
+        if (tim7_ticks != 0 && now % tim7_ticks == 0)
+        {
+            HAL_TIM_PeriodElapsedCallback(&htim7);
+        }
+
+        if (!echo_received)
+        {
+            continue;
+        }
+
+        if (start == 0)
+        {
+            start = now;
+        }
+
+        if ((now - start) % pdMS_TO_TICKS(SCENARIO_STATUS_PERIOD_MS) == 0)
+        {
+            bool deadman = (now - start) % pdMS_TO_TICKS(SCENARIO_DEADMAN_PERIOD_MS) >=
+                           pdMS_TO_TICKS(SCENARIO_DEADMAN_PERIOD_MS - SCENARIO_DEADMAN_PULSE_MS);
+
+            Scenario_Rx(CAN_ID_PERIFERICOS_OK, CAN_VALUE_MODULE_OK);
+            Scenario_Rx(CAN_ID_BMS_OK, CAN_VALUE_MODULE_OK);
+            Scenario_Rx(CAN_ID_DCDC_OK, CAN_VALUE_MODULE_OK);
+            Scenario_Rx(CAN_ID_INVERSOR_OK, CAN_VALUE_MODULE_OK);
+
+            /* Flanco de subida de hombre muerto: la velocidad debe ir a 0 */
+            if (deadman && (now - start) % pdMS_TO_TICKS(SCENARIO_DEADMAN_PERIOD_MS) ==
+                           pdMS_TO_TICKS(SCENARIO_DEADMAN_PERIOD_MS - SCENARIO_DEADMAN_PULSE_MS))
+            {
+                Scenario_Stimulus(&deadman_response);
+            }
+
+            Scenario_Rx(CAN_ID_PERIFERICOS_HOMBRE_MUERTO,
+                        deadman ? CAN_VALUE_HOMBRE_MUERTO_ON : CAN_VALUE_HOMBRE_MUERTO_OFF);
+        }
+
+        if ((now - start) % pdMS_TO_TICKS(SCENARIO_PEDAL_PERIOD_MS) == 0)
+        {
+            Scenario_Stimulus(&pedal_response);
+            Scenario_Rx(CAN_ID_PERIFERICOS_PEDAL, pedal_value);
+
+            pedal_value = (uint8_t)((pedal_value + 1) % 100);
+        }
+
+        if (now - start >= pdMS_TO_TICKS(run_seconds * 1000U))
+        {
+            break;
+        }
+    }
+
+    printf("Tramas inyectadas: %lu, descartadas con la cola de recepción llena: %lu\n",
+           (unsigned long)rx_frames, (unsigned long)APP_RTOS_Get_Rx_Overruns());
+
+    ok = APP_RTOS_Get_Rx_Overruns() == 0;
+    ok = Scenario_Report_Response("pedal -> nivel de velocidad", &pedal_response) && ok;
+    ok = Scenario_Report_Response("hombre muerto -> velocidad 0", &deadman_response) && ok;
+    ok = Scenario_Report_Tasks() && ok;
+
+    fflush(stdout);
+
+    exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Registra respuestas de Control e inicia el tráfico de los módulos al recibir el echo.
+ *
+ * Se llama desde la tarea que transmite (CAN_RX o CONTROL).
+ *
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante de transmisión
+ * @retval true     Trama en mailbox (los mailboxes siempre la aceptan)
+ */
+static bool Scenario_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    if (id == CAN_ID_CONTROL_OK)
+    {
+        echo_received = true;
+    }
+    else if (id == CAN_ID_CONTROL_NIVEL_VELOCIDAD)
+    {
+        Scenario_Response(&pedal_response, t_us);
+
+        if (data[0] == 0)
+        {
+            Scenario_Response(&deadman_response, t_us);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief "ISR" de recepción de una trama de un byte.
+ *
+ * @param id        Identificador
+ * @param value     Dato
+ * @retval None
+ */
+static void Scenario_Rx(uint32_t id, uint8_t value)
+{
+    SIM_Can_Set_Rx_Frame(id, &value, 1);
+    HAL_CAN_RxFifo0MsgPendingCallback(&hcan1);
+
+    rx_frames++;
+}
+
+/**
+ * @brief Marca el inicio de un estímulo (el anterior sin respuesta se descarta).
+ *
+ * @param response  Tiempos de respuesta del estímulo
+ * @retval None
+ */
+static void Scenario_Stimulus(scenario_response_t* response)
+{
+    response->t_in_us = RTOS_HAL_Now_Us();
+    response->pending = true;
+    response->stimuli++;
+}
+
+/**
+ * @brief Registra la respuesta a un estímulo pendiente.
+ *
+ * @param response  Tiempos de respuesta del estímulo
+ * @param t_us      Instante de la respuesta
+ * @retval None
+ */
+static void Scenario_Response(scenario_response_t* response, uint64_t t_us)
+{
+    uint64_t elapsed;
+
+    if (!response->pending)
+    {
+        return;
+    }
+
+    response->pending = false;
+    elapsed = t_us - response->t_in_us;
+
+    if (response->count == 0 || elapsed < response->min)
+    {
+        response->min = elapsed;
+    }
+
+    if (elapsed > response->max)
+    {
+        response->max = elapsed;
+    }
+
+    response->sum += elapsed;
+    response->count++;
+}
+
+/**
+ * @brief Imprime los tiempos de respuesta de un estímulo.
+ *
+ * @param name      Nombre
+ * @param response  Tiempos de respuesta
+ * @retval true     Hubo respuestas y ninguna superó el límite
+ * @retval false    En otro caso
+ */
+static bool Scenario_Report_Response(const char* name, const scenario_response_t* response)
+{
+    bool ok = response->count != 0 && response->max <= max_response_us;
+
+    printf("Respuesta %s [us]: estímulos %lu, respuestas %lu, min %llu, media %llu, max %llu (límite %llu) %s\n",
+           name, (unsigned long)response->stimuli, (unsigned long)response->count,
+           (unsigned long long)response->min,
+           (unsigned long long)(response->count ? response->sum / response->count : 0),
+           (unsigned long long)response->max, (unsigned long long)max_response_us, ok ? "OK" : "FALLA");
+
+    return ok;
+}
+
+/**
+ * @brief Imprime por tarea prioridad, stack libre mínimo y uso de CPU.
+ *
+ * @param None
+ * @retval true     A todas las tareas les queda al menos SCENARIO_STACK_MIN_FREE palabras de stack
+ * @retval false    En otro caso
+ */
+static bool Scenario_Report_Tasks(void)
+{
+    TaskStatus_t tasks[SCENARIO_MAX_TASKS];
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t n = uxTaskGetSystemState(tasks, SCENARIO_MAX_TASKS, &total);
+    bool ok = true;
+
+    printf("\n%-12s %9s %20s %8s\n", "Tarea", "Prioridad", "Stack libre [palabras]", "CPU [%]");
+
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        bool stack_ok = tasks[i].usStackHighWaterMark >= SCENARIO_STACK_MIN_FREE;
+
+        printf("%-12s %9lu %20lu %8.2f%s\n", tasks[i].pcTaskName, (unsigned long)tasks[i].uxCurrentPriority,
+               (unsigned long)tasks[i].usStackHighWaterMark,
+               total ? 100.0 * (double)tasks[i].ulRunTimeCounter / (double)total : 0.0, stack_ok ? "" : " FALLA");
+
+        ok = ok && stack_ok;
+    }
+
+    return ok;
+}
@@ -0,0 +1,382 @@
+/**
+ * @file control_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Ejecución de la aplicación de Control en host sobre HAL de simulación y tiempo virtual
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Ejecuta MX_APP_Init y la superloop de MX_APP_Process con un escenario de red nominal: al recibir el
+ * echo de Control los módulos envían su estado OK cada 100 ms y Periféricos envía pedal cada 10 ms.
+ * Cada pasada de la superloop consume un tiempo virtual fijo. Al terminar imprime el rendimiento
+ * (pasadas por segundo real y factor sobre tiempo real), las tramas transmitidas por ID y la latencia
+ * pedal-inversor. Con idle en WFI, __WFI avanza el reloj hasta la próxima "ISR" y se imprime además el ciclo de
+ * trabajo y la latencia de despertar, y con recepción CAN adaptativa, tramas por interrupción y cambios de modo.
+ * Con estadísticas de llegada por ID imprime la tabla por ID; SCENARIO_DUMP_BEFORE_END_US antes del final envía la
+ * petición de volcado, cuyas tramas (CAN 0x01D) aparecen en las tramas transmitidas. Con medidor de carga del bus
+ * imprime el último reporte transmitido (CAN 0x016).
+ *
+ * Las tramas de pedal llevan contador de secuencia y se descarta una de cada SCENARIO_PEDAL_DROP_EVERY, por lo que
+ * la tabla por ID debe mostrar esa tasa de pérdida en 0x002. Con contador de secuencia en transmisión se cuentan
+ * los saltos del contador de cada ID de Control (envíos que no entraron en mailbox).
+ *
+ * Uso: ./build/control_sim [-s <segundos_virtuales>] [-p <us_por_pasada>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "can_def.h"
+#include "bus_load.h"
+#include "can_hw.h"
+#include "idle.h"
+#include "latency.h"
+#include "rx_timing.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Periodo de pedal de Periféricos en us */
+#define SCENARIO_PEDAL_PERIOD_US            10000U
+
+/** @brief Una de cada tantas tramas de pedal se descarta (pérdida esperada: 1 / SCENARIO_PEDAL_DROP_EVERY) */
+#define SCENARIO_PEDAL_DROP_EVERY           50U
+
+/** @brief Periodo de estado de los módulos en us */
+#define SCENARIO_STATUS_PERIOD_US           100000U
+
+/** @brief Retardo de respuesta al echo en us */
+#define SCENARIO_ECHO_DELAY_US              1000U
+
+/** @brief Horizonte de programación de tramas del escenario en us */
+#define SCENARIO_HORIZON_US                 50000U
+
+/** @brief Tráfico programado al responder el echo (cubre la espera de arranque de Control) en us */
+#define SCENARIO_STARTUP_US                 1000000U
+
+/** @brief Petición de volcado de estadísticas de llegada por ID antes del final en us (cubre el volcado) */
+#define SCENARIO_DUMP_BEFORE_END_US         12000000U
+
+/** @brief Máximo identificador estándar contado */
+#define TX_COUNT_IDS                        0x800
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Tramas transmitidas por ID */
+static uint32_t tx_count[TX_COUNT_IDS];
+
+/** @brief Tramas de pedal programadas (el contador de secuencia son sus 8 bits bajos) */
+static uint32_t pedal_frames = 0;
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+/** @brief Próximo contador de secuencia esperado por ID de Control */
+static uint8_t tx_sequence_expected[CAN_SEQUENCE_MAX_TX_ID + 1];
+
+/** @brief Indica que ya se vio una trama con contador del ID */
+static bool tx_sequence_seen[CAN_SEQUENCE_MAX_TX_ID + 1];
+
+/** @brief Tramas de Control no transmitidas según los saltos del contador */
+static uint32_t tx_sequence_gaps = 0;
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
+/** @brief Último reporte de carga del bus transmitido (vacío si no hubo) */
+static uint8_t bus_load_frame[BUS_LOAD_FRAME_LENGTH];
+
+/** @brief Indica que se transmitió al menos un reporte de carga del bus */
+static bool bus_load_seen = false;
+
+/** @brief Próxima trama de pedal programada */
+static uint64_t next_pedal_us = 0;
+
+/** @brief Próximo estado de módulos programado */
+static uint64_t next_status_us = 0;
+
+/** @brief Indica que los módulos ya iniciaron su tráfico periódico */
+static bool scenario_started = false;
+
+/** @brief Valor de pedal (diente de sierra) */
+static uint8_t pedal_value = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static bool Scenario_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+static void Scenario_Schedule_Modules_Ok(uint64_t t_us);
+static void Scenario_Schedule_Until(uint64_t t_us);
+static double Wall_Time_S(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    uint64_t sim_seconds = 15;
+    uint64_t pass_cost_us = 20;
+    uint64_t passes = 0;
+    uint64_t end_us;
+    double wall_start;
+    double wall;
+    const profiler_stats_t* latency;
+#if USE_WFI_IDLE_FEATURE == 1
+    idle_stats_t idle;
+#endif /* USE_WFI_IDLE_FEATURE */
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+    can_hw_rx_stats_t rx;
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+#if USE_RX_TIMING_FEATURE == 1
+    rx_timing_stats_t rx_timing;
+    const uint8_t dump = RX_TIMING_CMD_DUMP;
+#endif /* USE_RX_TIMING_FEATURE */
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            sim_seconds = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            pass_cost_us = strtoull(argv[i + 1], NULL, 0);
+        }
+    }
+
+    SIM_Init();
+    SIM_Can_Set_Tx_Hook(Scenario_Tx_Hook);
+
+    wall_start = Wall_Time_S();
+
+    MX_APP_Init();
+
+    /* Primera pasada bloquea hasta que los módulos responden el echo */
+    MX_APP_Process();
+
+    end_us = SIM_Clock_Now_Us() + sim_seconds * 1000000U;
+
+#if USE_RX_TIMING_FEATURE == 1
+    if (sim_seconds * 1000000U > SCENARIO_DUMP_BEFORE_END_US)
+    {
+        SIM_Can_Schedule_Rx(end_us - SCENARIO_DUMP_BEFORE_END_US, CAN_ID_CONTROL_DIAG_PETICION, &dump, 1);
+    }
+#endif /* USE_RX_TIMING_FEATURE */
+
+    while (SIM_Clock_Now_Us() < end_us)
+    {
+        Scenario_Schedule_Until(SIM_Clock_Now_Us() + SCENARIO_HORIZON_US);
+
+        MX_APP_Process();
+        passes++;
+
+        SIM_Clock_Advance_Us(pass_cost_us);
+    }
+
+    wall = Wall_Time_S() - wall_start;
+
+    printf("Tiempo virtual: %llu s, tiempo real: %.3f s (x%.0f), pasadas: %llu (%.0f pasadas/s reales)\n",
+           (unsigned long long)sim_seconds, wall, (double)sim_seconds / wall, (unsigned long long)passes,
+           (double)passes / wall);
+
+    printf("\nTramas transmitidas\n");
+
+    for (uint32_t id = 0; id < TX_COUNT_IDS; id++)
+    {
+        if (tx_count[id] != 0)
+        {
+            printf("  0x%03X %8lu\n", (unsigned)id, (unsigned long)tx_count[id]);
+        }
+    }
+
+    latency = LATENCY_Get_Stats();
+
+    printf("\nLatencia pedal-inversor [us]: n %lu, min %lu, media %lu, max %lu\n",
+           (unsigned long)latency->count, (unsigned long)latency->min,
+           latency->count ? (unsigned long)(latency->sum / latency->count) : 0UL, (unsigned long)latency->max);
+
+#if USE_WFI_IDLE_FEATURE == 1
+    IDLE_Get_Stats(&idle);
+
+    printf("\nIdle WFI: ciclo de trabajo %.2f %%, WFI %lu (%lu sin trabajo), despertares %lu, "
+           "latencia de despertar max %lu us (%lu sobre %u us)\n",
+           idle.elapsed_us ? 100.0 * (double)(idle.elapsed_us - idle.sleep_us) / (double)idle.elapsed_us : 0.0,
+           (unsigned long)idle.sleeps, (unsigned long)idle.spurious_wakeups, (unsigned long)idle.wakeups,
+           (unsigned long)idle.wake_latency_max_us, (unsigned long)idle.wake_latency_over, IDLE_WAKE_LATENCY_MAX_US);
+#endif /* USE_WFI_IDLE_FEATURE */
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+    CAN_HW_Get_Rx_Stats(&rx);
+
+    printf("\nRecepción CAN: %lu interrupciones (%.2f tramas c/u, max %lu), %lu pasadas con lectura (%.2f tramas c/u, "
+           "max %lu), %lu de FIFO llena, cambios a pasada %lu y a interrupción %lu, última tasa %lu tramas/s\n",
+           (unsigned long)rx.irqs, rx.irqs ? (double)rx.irq_frames / (double)rx.irqs : 0.0,
+           (unsigned long)rx.irq_frames_max, (unsigned long)rx.polls,
+           rx.polls ? (double)rx.poll_frames / (double)rx.polls : 0.0, (unsigned long)rx.poll_frames_max,
+           (unsigned long)rx.full_irqs, (unsigned long)rx.to_polled, (unsigned long)rx.to_irq,
+           (unsigned long)rx.rate_fps);
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
+#if USE_RX_TIMING_FEATURE == 1
+    printf("\nLlegada por ID [us]\n  %-5s %8s %8s %8s %8s %8s %8s %8s %8s\n", "id", "n", "periodo", "min", "max",
+           "jitter", "perdidas", "desorden", "perd[%]");
+
+    for (uint8_t i = 0; RX_TIMING_Get_Stats(i, (uint32_t)SIM_Clock_Now_Us(), &rx_timing); i++)
+    {
+        if (rx_timing.count != 0)
+        {
+            printf("  0x%03lX %8lu %8lu %8lu %8lu %8lu %8lu %8lu %8.2f\n", (unsigned long)rx_timing.id,
+                   (unsigned long)rx_timing.count, (unsigned long)rx_timing.period_mean_us,
+                   (unsigned long)rx_timing.period_min_us, (unsigned long)rx_timing.period_max_us,
+                   (unsigned long)rx_timing.jitter_us, (unsigned long)rx_timing.seq_lost,
+                   (unsigned long)rx_timing.seq_reordered, rx_timing.loss_rate / 100.0);
+        }
+    }
+#endif /* USE_RX_TIMING_FEATURE */
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+    printf("\nContador de secuencia de Control: %lu tramas no transmitidas\n", (unsigned long)tx_sequence_gaps);
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
+    if (bus_load_seen)
+    {
+        printf("\nCarga del bus CAN (peor caso de stuffing): 100 ms %.2f %%, 1 s %.2f %%, 10 s %.2f %%, "
+               "max 100 ms %.2f %%\n",
+               (bus_load_frame[0] | (bus_load_frame[1] << 8)) / 100.0,
+               (bus_load_frame[2] | (bus_load_frame[3] << 8)) / 100.0,
+               (bus_load_frame[4] | (bus_load_frame[5] << 8)) / 100.0,
+               (bus_load_frame[6] | (bus_load_frame[7] << 8)) / 100.0);
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Registra tramas transmitidas por Control e inicia el tráfico de los módulos al recibir el echo.
+ *
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante de transmisión
+ * @retval true     Trama en mailbox (los mailboxes siempre la aceptan)
+ */
+static bool Scenario_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    if (id < TX_COUNT_IDS)
+    {
+        tx_count[id]++;
+    }
+
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+    /* Un salto del contador es un envío que no entró en mailbox */
+    if (id <= CAN_SEQUENCE_MAX_TX_ID && dlc == CAN_SEQUENCE_LENGTH)
+    {
+        if (tx_sequence_seen[id])
+        {
+            tx_sequence_gaps += (uint8_t)(data[CAN_SEQUENCE_BYTE] - tx_sequence_expected[id]);
+        }
+
+        tx_sequence_seen[id] = true;
+        tx_sequence_expected[id] = (uint8_t)(data[CAN_SEQUENCE_BYTE] + 1U);
+    }
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
+    if (id == CAN_ID_CONTROL_CARGA_BUS && dlc == BUS_LOAD_FRAME_LENGTH)
+    {
+        memcpy(bus_load_frame, data, sizeof(bus_load_frame));
+        bus_load_seen = true;
+    }
+
+    /* Los módulos responden el echo e inician su tráfico periódico */
+    if (id == CAN_ID_CONTROL_OK && !scenario_started)
+    {
+        scenario_started = true;
+        next_pedal_us = next_status_us = t_us + SCENARIO_ECHO_DELAY_US;
+
+        Scenario_Schedule_Until(t_us + SCENARIO_STARTUP_US);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Programa estado OK de todos los módulos.
+ *
+ * @param t_us      Instante de llegada
+ * @retval None
+ */
+static void Scenario_Schedule_Modules_Ok(uint64_t t_us)
+{
+    static const uint32_t ok_ids[] = {CAN_ID_PERIFERICOS_OK, CAN_ID_BMS_OK, CAN_ID_DCDC_OK, CAN_ID_INVERSOR_OK};
+    const uint8_t ok = CAN_VALUE_MODULE_OK;
+
+    for (size_t i = 0; i < sizeof(ok_ids) / sizeof(ok_ids[0]); i++)
+    {
+        SIM_Can_Schedule_Rx(t_us, ok_ids[i], &ok, 1);
+    }
+}
+
+/**
+ * @brief Programa las tramas periódicas del escenario hasta un instante.
+ *
+ * @param t_us      Instante límite
+ * @retval None
+ */
+static void Scenario_Schedule_Until(uint64_t t_us)
+{
+    while (next_pedal_us <= t_us)
+    {
+        const uint8_t pedal[CAN_SEQUENCE_LENGTH] = {pedal_value, (uint8_t)pedal_frames};
+
+        /* Trama perdida en el bus: el contador avanza igual */
+        if ((pedal_frames % SCENARIO_PEDAL_DROP_EVERY) != SCENARIO_PEDAL_DROP_EVERY - 1U)
+        {
+            SIM_Can_Schedule_Rx(next_pedal_us, CAN_ID_PERIFERICOS_PEDAL, pedal, CAN_SEQUENCE_LENGTH);
+        }
+
+        pedal_frames++;
+        pedal_value = (uint8_t)((pedal_value + 1) % 100);
+        next_pedal_us += SCENARIO_PEDAL_PERIOD_US;
+    }
+
+    while (next_status_us <= t_us)
+    {
+        const uint8_t hm = CAN_VALUE_HOMBRE_MUERTO_OFF;
+
+        Scenario_Schedule_Modules_Ok(next_status_us);
+        SIM_Can_Schedule_Rx(next_status_us, CAN_ID_PERIFERICOS_HOMBRE_MUERTO, &hm, 1);
+
+        next_status_us += SCENARIO_STATUS_PERIOD_US;
+    }
+}
+
+/**
+ * @brief Tiempo real monotónico en segundos.
+ *
+ * @return double
+ */
+static double Wall_Time_S(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file control_vcan.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Ejecución de la aplicación de Control como proceso Linux sobre SocketCAN (vcan0 o CAN real)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Ejecuta MX_APP_Init y la superloop de MX_APP_Process en tiempo real, con el backend SocketCAN del
+ * driver CAN y la HAL de host_hal.h. El tráfico de los módulos se genera desde fuera (canplayer, cangen
+ * o un nodo real). Al terminar (duración cumplida o Ctrl+C) imprime tramas recibidas y transmitidas,
+ * tasas, descartes del kernel y errores de transmisión, y la latencia pedal-inversor.
+ *
+ * Preparación de vcan0:
+ *   sudo modprobe vcan && sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+ *
+ * Uso: ./build/control_vcan [-i <interfaz>] [-s <segundos>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host_hal.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "latency.h"
+
+/* CAN driver include */
+#include "can_socketcan.h"
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Pasadas de la superloop */
+static uint64_t passes = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Vcan_Stop_Signal(int signum);
+static void Vcan_Report(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    const char* ifname = CAN_SOCKETCAN_DEFAULT_IFNAME;
+    unsigned int seconds = 0;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-i") == 0)
+        {
+            ifname = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            seconds = (unsigned int)strtoul(argv[i + 1], NULL, 0);
+        }
+    }
+
+    HOST_HAL_Init();
+    CAN_SocketCAN_Set_Interface(ifname);
+
+    signal(SIGINT, Vcan_Stop_Signal);
+    signal(SIGTERM, Vcan_Stop_Signal);
+    signal(SIGALRM, Vcan_Stop_Signal);
+
+    if (seconds != 0)
+    {
+        alarm(seconds);
+    }
+
+    /* Si la interfaz no se puede abrir, CAN_HW_Init termina en Error_Handler */
+    MX_APP_Init();
+
+    /* El reporte se imprime también si la aplicación termina desde la espera del echo */
+    atexit(Vcan_Report);
+
+    while (1)
+    {
+        HOST_HAL_Service();
+
+        MX_APP_Process();
+        passes++;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Pide terminar la ejecución (SIGINT, SIGTERM o fin de duración).
+ *
+ * @param signum    Señal
+ * @retval None
+ */
+static void Vcan_Stop_Signal(int signum)
+{
+    HOST_HAL_Request_Stop();
+}
+
+/**
+ * @brief Imprime el resumen de la ejecución.
+ *
+ * @param None
+ * @retval None
+ */
+static void Vcan_Report(void)
+{
+    can_socketcan_stats_t stats;
+    const profiler_stats_t* latency = LATENCY_Get_Stats();
+    double seconds = (double)HOST_HAL_Now_Us() / 1e6;
+
+    CAN_SocketCAN_Get_Stats(&stats);
+
+    printf("Tiempo: %.3f s, pasadas: %llu (%.0f pasadas/s), eventos TIM7: %lu\n",
+           seconds, (unsigned long long)passes, (double)passes / seconds,
+           (unsigned long)HOST_HAL_Get_Tim7_Events());
+
+    printf("RX: %lu tramas (%.1f tramas/s), descartadas por el kernel: %lu\n",
+           (unsigned long)stats.rx_frames, (double)stats.rx_frames / seconds, (unsigned long)stats.rx_dropped);
+
+    printf("TX: %lu tramas (%.1f tramas/s), errores: %lu\n",
+           (unsigned long)stats.tx_frames, (double)stats.tx_frames / seconds, (unsigned long)stats.tx_errors);
+
+    printf("Latencia pedal-inversor [us]: n %lu, min %lu, media %lu, max %lu\n",
+           (unsigned long)latency->count, (unsigned long)latency->min,
+           latency->count ? (unsigned long)(latency->sum / latency->count) : 0UL, (unsigned long)latency->max);
+}
@@ -0,0 +1,1389 @@
+/**
+ * @file network_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Simulador de la red del vehículo (Periféricos, BMS, DCDC, Inversor) para pruebas de carga de Control
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Los cuatro módulos transmiten todos sus IDs de can_def.h con periodo y jitter configurables, y responden el
+ * echo de Control (CONTROL_OK) con su *_OK, lo que saca a Control de kWAITING_ECHO_RESPONSE. Las tramas de
+ * todos los nodos, incluido Control, pasan por el modelo de bus a nivel de bit de can_bus_model.h: arbitraje
+ * por identificador y largo exacto con bit stuffing. Control tiene sus 3 mailboxes, sin cola de software: con los
+ * tres ocupados CAN_Wrapper_TransmitData retorna error y la aplicación decide si reintenta. Cada módulo tiene una
+ * cola de -q tramas. Control recibe cada trama al fin de su EOF, si la aceptan sus filtros de hardware.
+ *
+ * Escenarios (-S <nombre> o -f <archivo>), una orden por línea, tiempos en ms desde que los módulos
+ * responden el echo:
+ *   rate <id> <periodo_ms>                 Cambia el periodo de un ID (0: no se transmite)
+ *   latency <us>                           Latencia pedal-nivel de velocidad máxima permitida en el bus
+ *   at <t> set <id> <valor>                Fija el valor (byte 0) de un ID
+ *   at <t> send <id> <valor>               Fija el valor y el módulo lo transmite además en ese instante (por evento)
+ *   at <t> ramp <id> <desde> <hasta> <ms>  Rampa lineal del valor de un ID
+ *   at <t> stop|start <nodo>               Nodo deja de transmitir / vuelve (perifericos, bms, dcdc, inversor)
+ *   at <t> flood <id> <ms>                 Un nodo externo transmite <id> (8 bytes) sin pausa durante <ms>: con un
+ *                                          <id> menor que los de Control, sus mailboxes se llenan
+ *   at <t> expect <id> [!]<valor> [<ms>]   Mide la latencia hasta que Control transmite <id> con (o distinto de)
+ *                                          <valor>; con <ms>, la latencia máxima permitida
+ * Escenarios incluidos: nominal, pedal, overheat, bms_dropout, deadman, deadman_busy.
+ *
+ * Termina con código de error si alguna respuesta esperada con latencia máxima llega tarde o no llega, o si la
+ * latencia pedal-nivel de velocidad supera la de la orden latency. Con USE_CAN_TX_POLICY_FEATURE, un nivel de
+ * velocidad igual al anterior es un reenvío por intervalo máximo y no cuenta como respuesta a un pedal.
+ *
+ * Salidas: resumen por ID (tramas, descartes por cola llena, retardo de cola min/media/max), latencias de
+ * respuesta de Control, y opcionalmente línea de tiempo CSV (-c) y VCD (-v) con carga de bus, ID en el bus
+ * y latencia pedal-nivel de velocidad medida en el bus.
+ *
+ * Uso: ./build/network_sim [-S <escenario>] [-f <archivo>] [-s <segundos>] [-b <bitrate>] [-r <factor_tasa>]
+ *                          [-j <jitter_us>] [-q <cola_modulos>] [-w <ventana_ms>] [-c <salida.csv>]
+ *                          [-v <salida.vcd>] [-x <semilla>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "can_bus_model.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "can_def.h"
+#include "can_hw.h"
+#include "latency.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Cola de transmisión de los módulos por defecto (mailboxes más cola de software) */
+#define NET_MODULE_TX_QUEUE                 16
+
+/** @brief Retardo de respuesta de los módulos al echo en us */
+#define NET_ECHO_REPLY_US                   1000U
+
+/** @brief Máximo de eventos de escenario */
+#define NET_MAX_EVENTS                      64
+
+/** @brief Máximo de expectativas de respuesta */
+#define NET_MAX_EXPECTS                     16
+
+/** @brief Máscara de filtros de recepción de Control (ver CAN_FilterConfig en can_wrapper.c) */
+#define NET_FILTER_MASK                     0x7F8U
+
+/** @brief Máximo identificador estándar */
+#define NET_MAX_ID                          0x800
+
+/** @brief Largo máximo de línea de escenario */
+#define NET_LINE_MAX_LENGTH                 128
+
+/** @brief Entrada de la tabla de señales: ID, nodo, periodo en ms y valor nominal */
+#define NET_SIGNAL(id, node, period_ms, value)  {(id), (node), (period_ms), (value), 0, 0, false, 0, 0, 0, 0}
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Nodos del bus */
+typedef enum
+{
+    kNODE_CONTROL = 0,
+    kNODE_PERIFERICOS,
+    kNODE_BMS,
+    kNODE_DCDC,
+    kNODE_INVERSOR,
+    kNODE_EXTERNO,
+    kNUM_OF_NODES
+
+} net_node_t;
+
+/** @brief Señal periódica de un módulo (un ID, valor en byte 0) */
+typedef struct
+{
+    uint32_t    id;                             /**< Identificador */
+    net_node_t  node;                           /**< Nodo transmisor */
+    uint32_t    period_ms;                      /**< Periodo nominal (0: no se transmite) */
+    uint8_t     value;                          /**< Valor actual */
+    uint64_t    nominal_us;                     /**< Próximo instante nominal */
+    uint64_t    next_us;                        /**< Próximo instante con jitter */
+    bool        ramp;                           /**< Rampa activa */
+    uint8_t     ramp_from;                      /**< Valor inicial de la rampa */
+    uint8_t     ramp_to;                        /**< Valor final de la rampa */
+    uint64_t    ramp_t0_us;                     /**< Inicio de la rampa */
+    uint64_t    ramp_t1_us;                     /**< Fin de la rampa */
+
+} net_signal_t;
+
+/** @brief Tipo de evento de escenario */
+typedef enum
+{
+    kEVENT_SET = 0,
+    kEVENT_SEND,
+    kEVENT_RAMP,
+    kEVENT_STOP,
+    kEVENT_START,
+    kEVENT_FLOOD,
+    kEVENT_EXPECT
+
+} net_event_type_t;
+
+/** @brief Evento de escenario */
+typedef struct
+{
+    uint64_t            t_us;                   /**< Instante relativo al inicio de los módulos */
+    net_event_type_t    type;                   /**< Tipo */
+    uint32_t            id;                     /**< Identificador (o nodo en stop/start) */
+    uint8_t             a;                      /**< Valor / desde */
+    uint8_t             b;                      /**< Hasta */
+    uint32_t            duration_ms;            /**< Duración de rampa o de inundación */
+    bool                not_equal;              /**< Expectativa por valor distinto */
+    uint64_t            max_us;                 /**< Latencia máxima de la expectativa (0: sin límite) */
+
+} net_event_t;
+
+/** @brief Expectativa de respuesta de Control */
+typedef struct
+{
+    uint64_t    t_us;                           /**< Instante del evento (absoluto) */
+    uint32_t    id;                             /**< Identificador esperado */
+    uint8_t     value;                          /**< Valor esperado */
+    bool        not_equal;                      /**< Por valor distinto */
+    uint64_t    max_us;                         /**< Latencia máxima (0: sin límite) */
+    bool        done;                           /**< Respuesta observada */
+    uint64_t    response_us;                    /**< Instante de la respuesta (fin de trama en el bus) */
+
+} net_expect_t;
+
+/** @brief Estadísticas por ID */
+typedef struct
+{
+    uint32_t    sent;                           /**< Tramas transmitidas en el bus */
+    uint32_t    dropped;                        /**< Tramas descartadas por cola de transmisión llena */
+    uint64_t    bits;                           /**< Bits acumulados */
+    uint64_t    delay_sum_us;                   /**< Retardo de cola acumulado */
+    uint32_t    delay_min_us;                   /**< Retardo de cola mínimo */
+    uint32_t    delay_max_us;                   /**< Retardo de cola máximo */
+
+} net_id_stats_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Nombres de nodos */
+static const char* const node_names[kNUM_OF_NODES] = {"control", "perifericos", "bms", "dcdc", "inversor", "externo"};
+
+/** @brief Señales de los módulos, con periodo y valor nominal */
+static net_signal_t signals[] =
+{
+    NET_SIGNAL(CAN_ID_PERIFERICOS_PEDAL,                  kNODE_PERIFERICOS,  10,  0x00),
+    NET_SIGNAL(CAN_ID_PERIFERICOS_HOMBRE_MUERTO,          kNODE_PERIFERICOS,  20,  CAN_VALUE_HOMBRE_MUERTO_OFF),
+    NET_SIGNAL(CAN_ID_PERIFERICOS_BOTONES_CAMBIO_ESTADO,  kNODE_PERIFERICOS,  100, CAN_VALUE_BTN_NONE),
+    NET_SIGNAL(CAN_ID_PERIFERICOS_OK,                     kNODE_PERIFERICOS,  100, CAN_VALUE_MODULE_OK),
+    NET_SIGNAL(CAN_ID_BMS_VOLTAJE,                        kNODE_BMS,          100, 120),
+    NET_SIGNAL(CAN_ID_BMS_CORRIENTE,                      kNODE_BMS,          100, 20),
+    NET_SIGNAL(CAN_ID_BMS_VOLTAJE_MIN_CELDA,              kNODE_BMS,          100, 35),
+    NET_SIGNAL(CAN_ID_BMS_POTENCIA,                       kNODE_BMS,          100, 30),
+    NET_SIGNAL(CAN_ID_BMS_T_MAX,                          kNODE_BMS,          100, 35),
+    NET_SIGNAL(CAN_ID_BMS_NIVEL_BATERIA,                  kNODE_BMS,          1000, 80),
+    NET_SIGNAL(CAN_ID_BMS_OK,                             kNODE_BMS,          100, CAN_VALUE_MODULE_OK),
+    NET_SIGNAL(CAN_ID_DCDC_VOLTAJE_BATERIA,               kNODE_DCDC,         100, 120),
+    NET_SIGNAL(CAN_ID_DCDC_VOLTAJE_SALIDA,                kNODE_DCDC,         100, 12),
+    NET_SIGNAL(CAN_ID_DCDC_T_MAX,                         kNODE_DCDC,         100, 40),
+    NET_SIGNAL(CAN_ID_DCDC_OK,                            kNODE_DCDC,         100, CAN_VALUE_MODULE_OK),
+    NET_SIGNAL(CAN_ID_DCDC_POTENCIA,                      kNODE_DCDC,         100, 10),
+    NET_SIGNAL(CAN_ID_INVERSOR_VELOCIDAD,                 kNODE_INVERSOR,     20,  50),
+    NET_SIGNAL(CAN_ID_INVERSOR_V,                         kNODE_INVERSOR,     100, 120),
+    NET_SIGNAL(CAN_ID_INVERSOR_I,                         kNODE_INVERSOR,     100, 20),
+    NET_SIGNAL(CAN_ID_INVERSOR_TEMP_MAX,                  kNODE_INVERSOR,     100, 45),
+    NET_SIGNAL(CAN_ID_INVERSOR_TEMP_MOTOR,                kNODE_INVERSOR,     100, 50),
+    NET_SIGNAL(CAN_ID_INVERSOR_POTENCIA,                  kNODE_INVERSOR,     100, 30),
+    NET_SIGNAL(CAN_ID_INVERSOR_OK,                        kNODE_INVERSOR,     100, CAN_VALUE_MODULE_OK),
+};
+
+/** @brief Número de señales */
+#define NET_NUM_OF_SIGNALS                  (sizeof(signals) / sizeof(signals[0]))
+
+/** @brief Escenarios incluidos */
+static const struct
+{
+    const char* name;
+    const char* script;
+
+} builtin_scenarios[] =
+{
+    {"nominal",     ""},
+    {"pedal",       "latency 1000\n"},
+    {"overheat",    "at 2000 ramp 0x043 45 100 5000\n"
+                    "at 6000 set 0x046 0x02\n"
+                    "at 6000 expect 0x011 !0x00\n"},
+    {"bms_dropout", "at 2000 stop bms\n"
+                    "at 2000 expect 0x011 !0x00\n"
+                    "at 5000 start bms\n"},
+    {"deadman",     "at 2000 send 0x003 0x01\n"
+                    "at 2000 expect 0x012 0x00 3\n"
+                    "at 2000 expect 0x013 0x01 3\n"
+                    "at 4000 set 0x003 0x00\n"
+                    "at 4000 expect 0x013 0x00\n"},
+    {"deadman_busy", "at 4950 flood 0x008 80\n"
+                    "at 5000 send 0x003 0x01\n"
+                    "at 5030 expect 0x012 0x00 5\n"
+                    "at 5030 expect 0x013 0x01 5\n"
+                    "at 7000 set 0x003 0x00\n"
+                    "at 7000 expect 0x013 0x00\n"},
+};
+
+/** @brief Bus */
+static can_bus_t bus;
+
+/** @brief Nodos transmitiendo */
+static bool node_enabled[kNUM_OF_NODES];
+
+/** @brief Eventos de escenario (ordenados por tiempo) */
+static net_event_t events[NET_MAX_EVENTS];
+static uint32_t num_events = 0;
+static uint32_t next_event = 0;
+
+/** @brief Expectativas activas */
+static net_expect_t expects[NET_MAX_EXPECTS];
+static uint32_t num_expects = 0;
+
+/** @brief Estadísticas por ID */
+static net_id_stats_t id_stats[NET_MAX_ID];
+
+/** @brief Instante en que los módulos inician su tráfico (UINT64_MAX: esperando echo) */
+static uint64_t modules_start_us = UINT64_MAX;
+
+/** @brief Instante de término */
+static uint64_t end_us = 0;
+
+/** @brief Identificador de la inundación del nodo externo (NET_MAX_ID: ninguna) y su fin */
+static uint32_t flood_id = NET_MAX_ID;
+static uint64_t flood_end_us = 0;
+
+/** @brief Dos últimos pedales entregados a Control (fin de trama); el último puede estar aún en el bus */
+static uint64_t pedal_rx_us[2] = {0, 0};
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+/** @brief Último nivel de velocidad transmitido por Control (-1: ninguno) */
+static int nivel_velocidad_last = -1;
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+/** @brief Opciones */
+static double rate_factor = 1.0;
+static uint32_t jitter_us = 500;
+static uint64_t window_us = 10000;
+
+/** @brief Estado del generador pseudoaleatorio (xorshift32) */
+static uint32_t rng_state = 1;
+
+/** @brief Salidas */
+static FILE* csv_file = NULL;
+static FILE* vcd_file = NULL;
+
+/** @brief Ventana actual de la línea de tiempo */
+static struct
+{
+    uint64_t    start_us;                       /**< Inicio */
+    uint64_t    busy_us;                        /**< Tiempo de bus ocupado */
+    uint32_t    frames;                         /**< Tramas iniciadas */
+    uint32_t    dropped;                        /**< Tramas descartadas */
+    uint16_t    queue_max;                      /**< Máximo de tramas pendientes */
+    uint32_t    latency_n;                      /**< Latencias pedal-nivel de velocidad */
+    uint64_t    latency_sum_us;                 /**< Suma de latencias */
+    uint64_t    latency_max_us;                 /**< Latencia máxima */
+
+} window;
+
+/** @brief Totales */
+static uint64_t total_busy_us = 0;
+static double peak_load = 0.0;
+
+/** @brief Latencia pedal-nivel de velocidad en el bus: totales y máximo permitido (0: sin límite) */
+static uint32_t latency_n = 0;
+static uint64_t latency_sum_us = 0;
+static uint64_t latency_max_us = 0;
+static uint64_t latency_limit_us = 0;
+
+/** @brief Fin de trama pendiente de escribir en VCD */
+static uint64_t vcd_pending_end_us = UINT64_MAX;
+
+/** @brief Último instante escrito en VCD */
+static uint64_t vcd_last_us = UINT64_MAX;
+
+/** @brief Inicio en tiempo real */
+static double wall_start;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static bool Net_Load_Scenario(const char* script, const char* source);
+static net_signal_t* Net_Find_Signal(uint32_t id);
+static uint32_t Net_Random(uint32_t max);
+static void Net_Start_Modules(uint64_t t_us);
+static void Net_Apply_Event(const net_event_t* event, uint64_t t_us);
+static uint8_t Net_Signal_Value(net_signal_t* signal, uint64_t t_us);
+static uint64_t Net_Next_Generation_Us(net_signal_t** signal);
+static uint64_t Net_Next_Event_Us(void);
+static void Net_Run_Until(uint64_t target_us);
+static bool Net_Enqueue(net_node_t node, uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us, uint64_t tag);
+static void Net_Frame_Done(const can_bus_frame_t* frame, uint64_t start_us, uint64_t frame_end_us, uint32_t bits);
+static void Net_Timeline_Busy(uint64_t start_us, uint64_t frame_end_us);
+static void Net_Timeline_Flush(void);
+static void Net_Vcd_Time(uint64_t t_us);
+static void Net_Advance_Hook(uint64_t target_us);
+static bool Net_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+static void Net_Finish(void);
+static double Wall_Time_S(void);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    const char* scenario = "nominal";
+    const char* scenario_file = NULL;
+    uint64_t seconds = 20;
+    uint32_t bitrate = 250000;
+    uint32_t module_queue = NET_MODULE_TX_QUEUE;
+    const uint64_t pass_cost_us = 20;
+    const uint64_t idle_max_us = 1000;
+    const app_context_t* app;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-S") == 0)
+        {
+            scenario = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-f") == 0)
+        {
+            scenario_file = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            seconds = strtoull(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            bitrate = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            rate_factor = strtod(argv[i + 1], NULL);
+        }
+        else if (strcmp(argv[i], "-j") == 0)
+        {
+            jitter_us = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-q") == 0)
+        {
+            module_queue = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-w") == 0)
+        {
+            window_us = strtoull(argv[i + 1], NULL, 0) * 1000U;
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            csv_file = fopen(argv[i + 1], "w");
+        }
+        else if (strcmp(argv[i], "-v") == 0)
+        {
+            vcd_file = fopen(argv[i + 1], "w");
+        }
+        else if (strcmp(argv[i], "-x") == 0)
+        {
+            rng_state = (uint32_t)strtoul(argv[i + 1], NULL, 0) | 1U;
+        }
+    }
+
+    if (bitrate == 0 || 1000000U % bitrate != 0 || rate_factor <= 0.0 || window_us == 0)
+    {
+        fprintf(stderr, "opciones no válidas (bitrate divisor de 1 MHz, factor de tasa > 0, ventana > 0)\n");
+        return EXIT_FAILURE;
+    }
+
+    if (scenario_file != NULL)
+    {
+        static char script[16384];
+        FILE* file = fopen(scenario_file, "r");
+        size_t length;
+
+        if (file == NULL)
+        {
+            fprintf(stderr, "no se pudo abrir %s\n", scenario_file);
+            return EXIT_FAILURE;
+        }
+
+        length = fread(script, 1, sizeof(script) - 1, file);
+        script[length] = '\0';
+        fclose(file);
+
+        if (!Net_Load_Scenario(script, scenario_file))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        size_t i;
+
+        for (i = 0; i < sizeof(builtin_scenarios) / sizeof(builtin_scenarios[0]); i++)
+        {
+            if (strcmp(builtin_scenarios[i].name, scenario) == 0)
+            {
+                break;
+            }
+        }
+
+        if (i == sizeof(builtin_scenarios) / sizeof(builtin_scenarios[0]) ||
+            !Net_Load_Scenario(builtin_scenarios[i].script, scenario))
+        {
+            fprintf(stderr, "escenario desconocido: %s\n", scenario);
+            return EXIT_FAILURE;
+        }
+    }
+
+    CAN_BUS_Init(&bus, bitrate);
+
+    for (int n = kNODE_PERIFERICOS; n < kNUM_OF_NODES; n++)
+    {
+        CAN_BUS_Set_Node_Capacity(&bus, (uint8_t)n, (uint8_t)((module_queue > UINT8_MAX) ? UINT8_MAX : module_queue));
+    }
+
+    for (int n = 0; n < kNUM_OF_NODES; n++)
+    {
+        node_enabled[n] = true;
+    }
+
+    for (uint32_t id = 0; id < NET_MAX_ID; id++)
+    {
+        id_stats[id].delay_min_us = UINT32_MAX;
+    }
+
+    end_us = seconds * 1000000U;
+
+    if (csv_file != NULL)
+    {
+        fprintf(csv_file, "t_ms,load_pct,frames,dropped,queue_max,latency_n,latency_mean_us,latency_max_us\n");
+    }
+
+    if (vcd_file != NULL)
+    {
+        fprintf(vcd_file, "$timescale 1us $end\n$scope module can $end\n"
+                          "$var wire 1 ! busy $end\n$var wire 11 \" id $end\n"
+                          "$var real 1 # load $end\n$var real 1 $ latency_us $end\n"
+                          "$upscope $end\n$enddefinitions $end\n#0\n0!\nbx \"\nr0 #\nr0 $\n");
+        vcd_last_us = 0;
+    }
+
+    SIM_Init();
+    SIM_Can_Set_Tx_Hook(Net_Tx_Hook);
+    SIM_Set_Advance_Hook(Net_Advance_Hook);
+
+    wall_start = Wall_Time_S();
+
+    MX_APP_Init();
+
+    app = MX_APP_Get_Context();
+
+    /* Termina desde Net_Advance_Hook al cumplirse la duración */
+    while (1)
+    {
+        uint64_t step = pass_cost_us;
+
+        MX_APP_Process();
+
+        /* Sin trabajo pendiente: salta al próximo evento del bus, de los módulos o de la simulación */
+        if (app->flag_rx_can != CAN_MSG_RECEIVED && app->flag_tx_can != CAN_TX_READY)
+        {
+            uint64_t now = SIM_Clock_Now_Us();
+            uint64_t next = SIM_Clock_Next_Event_Us();
+            uint64_t net = Net_Next_Event_Us();
+
+            next = (net < next) ? net : next;
+
+            if (next > now + pass_cost_us)
+            {
+                step = (next - now > idle_max_us) ? idle_max_us : next - now;
+            }
+        }
+
+        SIM_Clock_Advance_Us(step);
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Interpreta un escenario.
+ *
+ * @param script    Texto del escenario
+ * @param source    Nombre del escenario (para mensajes de error)
+ * @retval true     Escenario válido
+ * @retval false    Error de sintaxis
+ */
+static bool Net_Load_Scenario(const char* script, const char* source)
+{
+    const char* p = script;
+    int line_number = 0;
+
+    while (*p != '\0')
+    {
+        char line[NET_LINE_MAX_LENGTH];
+        char command[16];
+        char arg[16];
+        unsigned long t;
+        unsigned long duration;
+        long id;
+        long a;
+        long b;
+        int fields;
+        size_t length = strcspn(p, "\n");
+        net_event_t* event = &events[num_events];
+
+        line_number++;
+
+        if (length >= sizeof(line))
+        {
+            length = sizeof(line) - 1;
+        }
+
+        memcpy(line, p, length);
+        line[length] = '\0';
+        p += strcspn(p, "\n");
+        p += (*p == '\n') ? 1 : 0;
+
+        if (line[strspn(line, " \t\r")] == '\0' || line[strspn(line, " \t")] == '#')
+        {
+            continue;
+        }
+
+        if (sscanf(line, " rate %li %li", &id, &a) == 2)
+        {
+            net_signal_t* signal = Net_Find_Signal((uint32_t)id);
+
+            if (signal == NULL)
+            {
+                fprintf(stderr, "%s:%d: ID 0x%03lX no pertenece a un módulo\n", source, line_number, (unsigned long)id);
+                return false;
+            }
+
+            signal->period_ms = (uint32_t)a;
+            continue;
+        }
+
+        if (sscanf(line, " latency %lu", &duration) == 1)
+        {
+            latency_limit_us = duration;
+            continue;
+        }
+
+        if (num_events == NET_MAX_EVENTS || sscanf(line, " at %lu %15s", &t, command) != 2)
+        {
+            fprintf(stderr, "%s:%d: orden no válida: %s\n", source, line_number, line);
+            return false;
+        }
+
+        memset(event, 0, sizeof(*event));
+        event->t_us = (uint64_t)t * 1000U;
+
+        if ((strcmp(command, "set") == 0 || strcmp(command, "send") == 0) &&
+            sscanf(line, " at %*u %*s %li %li", &id, &a) == 2)
+        {
+            event->type = (strcmp(command, "set") == 0) ? kEVENT_SET : kEVENT_SEND;
+            event->id = (uint32_t)id;
+            event->a = (uint8_t)a;
+        }
+        else if (strcmp(command, "ramp") == 0 &&
+                 sscanf(line, " at %*u ramp %li %li %li %lu", &id, &a, &b, &duration) == 4)
+        {
+            event->type = kEVENT_RAMP;
+            event->id = (uint32_t)id;
+            event->a = (uint8_t)a;
+            event->b = (uint8_t)b;
+            event->duration_ms = (uint32_t)duration;
+        }
+        else if ((strcmp(command, "stop") == 0 || strcmp(command, "start") == 0) &&
+                 sscanf(line, " at %*u %*s %15s", arg) == 1)
+        {
+            event->type = (strcmp(command, "stop") == 0) ? kEVENT_STOP : kEVENT_START;
+            event->id = kNUM_OF_NODES;
+
+            for (uint32_t n = kNODE_PERIFERICOS; n < kNUM_OF_NODES; n++)
+            {
+                if (strcmp(arg, node_names[n]) == 0)
+                {
+                    event->id = n;
+                }
+            }
+
+            if (event->id == kNUM_OF_NODES)
+            {
+                fprintf(stderr, "%s:%d: nodo desconocido: %s\n", source, line_number, arg);
+                return false;
+            }
+        }
+        else if (strcmp(command, "flood") == 0 &&
+                 sscanf(line, " at %*u flood %li %lu", &id, &duration) == 2)
+        {
+            event->type = kEVENT_FLOOD;
+            event->id = (uint32_t)id;
+            event->duration_ms = (uint32_t)duration;
+        }
+        else if (strcmp(command, "expect") == 0 &&
+                 (fields = sscanf(line, " at %*u expect %li %15s %lu", &id, arg, &duration)) >= 2)
+        {
+            event->type = kEVENT_EXPECT;
+            event->id = (uint32_t)id;
+            event->not_equal = (arg[0] == '!');
+            event->a = (uint8_t)strtoul(arg + (event->not_equal ? 1 : 0), NULL, 0);
+            event->max_us = (fields == 3) ? (uint64_t)duration * 1000U : 0;
+        }
+        else
+        {
+            fprintf(stderr, "%s:%d: orden no válida: %s\n", source, line_number, line);
+            return false;
+        }
+
+        if ((event->type == kEVENT_SET || event->type == kEVENT_SEND || event->type == kEVENT_RAMP) &&
+            Net_Find_Signal(event->id) == NULL)
+        {
+            fprintf(stderr, "%s:%d: ID 0x%03X no pertenece a un módulo\n", source, line_number, (unsigned)event->id);
+            return false;
+        }
+
+        num_events++;
+    }
+
+    /* Orden por tiempo, estable: a igual instante se aplican en el orden del escenario */
+    for (uint32_t i = 1; i < num_events; i++)
+    {
+        net_event_t event = events[i];
+        uint32_t j = i;
+
+        while (j > 0 && events[j - 1].t_us > event.t_us)
+        {
+            events[j] = events[j - 1];
+            j--;
+        }
+
+        events[j] = event;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Busca la señal de un ID.
+ *
+ * @param id        Identificador
+ * @return net_signal_t*    Señal, NULL si el ID no es de un módulo
+ */
+static net_signal_t* Net_Find_Signal(uint32_t id)
+{
+    for (size_t i = 0; i < NET_NUM_OF_SIGNALS; i++)
+    {
+        if (signals[i].id == id)
+        {
+            return &signals[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Número pseudoaleatorio en [0:max] (xorshift32, determinista por semilla).
+ *
+ * @param max       Máximo
+ * @return uint32_t
+ */
+static uint32_t Net_Random(uint32_t max)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return (max == 0) ? 0 : rng_state % (max + 1U);
+}
+
+/**
+ * @brief Inicia el tráfico periódico de los módulos (respuesta al echo).
+ *
+ * @param t_us      Instante de inicio
+ * @retval None
+ */
+static void Net_Start_Modules(uint64_t t_us)
+{
+    modules_start_us = t_us;
+
+    for (size_t i = 0; i < NET_NUM_OF_SIGNALS; i++)
+    {
+        signals[i].nominal_us = t_us;
+        signals[i].next_us = t_us + Net_Random(jitter_us);
+    }
+
+    for (uint32_t i = 0; i < num_events; i++)
+    {
+        events[i].t_us += t_us;
+    }
+}
+
+/**
+ * @brief Aplica un evento de escenario.
+ *
+ * @param event     Evento
+ * @param t_us      Instante
+ * @retval None
+ */
+static void Net_Apply_Event(const net_event_t* event, uint64_t t_us)
+{
+    net_signal_t* signal = Net_Find_Signal(event->id);
+
+    switch (event->type)
+    {
+    case kEVENT_SET:
+        signal->ramp = false;
+        signal->value = event->a;
+        break;
+
+    case kEVENT_SEND:
+        signal->ramp = false;
+        signal->value = event->a;
+
+        if (node_enabled[signal->node])
+        {
+            Net_Enqueue(signal->node, signal->id, &signal->value, 1, t_us, 0);
+        }
+        break;
+
+    case kEVENT_RAMP:
+        signal->ramp = true;
+        signal->ramp_from = event->a;
+        signal->ramp_to = event->b;
+        signal->ramp_t0_us = t_us;
+        signal->ramp_t1_us = t_us + (uint64_t)event->duration_ms * 1000U;
+        break;
+
+    case kEVENT_STOP:
+    case kEVENT_START:
+        node_enabled[event->id] = (event->type == kEVENT_START);
+        break;
+
+    case kEVENT_FLOOD:
+    {
+        const uint8_t data[8] = {0};
+
+        flood_id = event->id & (NET_MAX_ID - 1);
+        flood_end_us = t_us + (uint64_t)event->duration_ms * 1000U;
+
+        /* Siempre una trama pendiente: la siguiente entra al terminar la anterior (Net_Frame_Done) */
+        Net_Enqueue(kNODE_EXTERNO, flood_id, data, sizeof(data), t_us, 0);
+        break;
+    }
+
+    case kEVENT_EXPECT:
+        if (num_expects < NET_MAX_EXPECTS)
+        {
+            net_expect_t* expect = &expects[num_expects++];
+
+            memset(expect, 0, sizeof(*expect));
+            expect->t_us = t_us;
+            expect->id = event->id;
+            expect->value = event->a;
+            expect->not_equal = event->not_equal;
+            expect->max_us = event->max_us;
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Retorna el valor de una señal en un instante (evalúa rampa).
+ *
+ * @param signal    Señal
+ * @param t_us      Instante
+ * @return uint8_t
+ */
+static uint8_t Net_Signal_Value(net_signal_t* signal, uint64_t t_us)
+{
+    if (signal->ramp)
+    {
+        if (t_us >= signal->ramp_t1_us)
+        {
+            signal->ramp = false;
+            signal->value = signal->ramp_to;
+        }
+        else
+        {
+            double k = (double)(t_us - signal->ramp_t0_us) / (double)(signal->ramp_t1_us - signal->ramp_t0_us);
+
+            signal->value = (uint8_t)(signal->ramp_from + k * ((double)signal->ramp_to - signal->ramp_from));
+        }
+    }
+
+    /* Pedal: diente de sierra 0..99 */
+    if (signal->id == CAN_ID_PERIFERICOS_PEDAL)
+    {
+        signal->value = (uint8_t)((signal->value + 1) % 100);
+    }
+
+    return signal->value;
+}
+
+/**
+ * @brief Retorna el instante de la próxima trama periódica de los módulos.
+ *
+ * @param signal    Señal de la próxima trama
+ * @return uint64_t Instante, UINT64_MAX si los módulos no han iniciado
+ */
+static uint64_t Net_Next_Generation_Us(net_signal_t** signal)
+{
+    uint64_t next = UINT64_MAX;
+
+    *signal = NULL;
+
+    if (modules_start_us == UINT64_MAX)
+    {
+        return UINT64_MAX;
+    }
+
+    for (size_t i = 0; i < NET_NUM_OF_SIGNALS; i++)
+    {
+        if (signals[i].period_ms != 0 && signals[i].next_us < next)
+        {
+            next = signals[i].next_us;
+            *signal = &signals[i];
+        }
+    }
+
+    return next;
+}
+
+/**
+ * @brief Retorna el instante del próximo evento de la red (trama generada, evento de escenario o arbitraje).
+ *
+ * @return uint64_t
+ */
+static uint64_t Net_Next_Event_Us(void)
+{
+    net_signal_t* signal;
+    uint64_t next = Net_Next_Generation_Us(&signal);
+    uint64_t arbitration = CAN_BUS_Next_Arbitration_Us(&bus);
+
+    if (modules_start_us != UINT64_MAX && next_event < num_events && events[next_event].t_us < next)
+    {
+        next = events[next_event].t_us;
+    }
+
+    return (arbitration < next) ? arbitration : next;
+}
+
+/**
+ * @brief Simula la red en orden de tiempo hasta un instante (arbitrajes estrictamente anteriores).
+ *
+ * @param target_us     Instante límite
+ * @retval None
+ */
+static void Net_Run_Until(uint64_t target_us)
+{
+    while (1)
+    {
+        net_signal_t* signal;
+        uint64_t t_gen = Net_Next_Generation_Us(&signal);
+        uint64_t t_event = (modules_start_us != UINT64_MAX && next_event < num_events) ?
+                           events[next_event].t_us : UINT64_MAX;
+        uint64_t t_arb = CAN_BUS_Next_Arbitration_Us(&bus);
+
+        if (t_event <= t_gen && t_event <= t_arb && t_event < target_us)
+        {
+            Net_Apply_Event(&events[next_event++], t_event);
+        }
+        else if (t_gen <= t_arb && t_gen < target_us)
+        {
+            uint64_t period_us = (uint64_t)((double)signal->period_ms * 1000.0 / rate_factor);
+            uint8_t value = Net_Signal_Value(signal, t_gen);
+
+            if (node_enabled[signal->node])
+            {
+                Net_Enqueue(signal->node, signal->id, &value, 1, t_gen, 0);
+            }
+
+            signal->nominal_us += (period_us > 0) ? period_us : 1;
+            signal->next_us = signal->nominal_us + Net_Random(jitter_us);
+        }
+        else if (t_arb < target_us)
+        {
+            can_bus_frame_t frame;
+            uint64_t start_us;
+            uint64_t frame_end_us;
+            uint32_t bits;
+
+            if (bus.count > window.queue_max)
+            {
+                window.queue_max = bus.count;
+            }
+
+            CAN_BUS_Arbitrate(&bus, &frame, &start_us, &frame_end_us, &bits);
+
+            Net_Frame_Done(&frame, start_us, frame_end_us, bits);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Deja una trama en la cola de transmisión del nodo (o la cuenta como descartada).
+ *
+ * @param node      Nodo
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante
+ * @param tag       Dato libre
+ * @retval true     Trama en la cola del nodo
+ * @retval false    Cola llena: trama descartada
+ */
+static bool Net_Enqueue(net_node_t node, uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us, uint64_t tag)
+{
+    can_bus_frame_t frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.id = id & (NET_MAX_ID - 1);
+    frame.node = (uint8_t)node;
+    frame.dlc = (dlc > 8) ? 8 : dlc;
+    frame.t_enqueue_us = t_us;
+    frame.tag = tag;
+    memcpy(frame.data, data, frame.dlc);
+
+    if (!CAN_BUS_Enqueue(&bus, &frame))
+    {
+        id_stats[frame.id].dropped++;
+        window.dropped++;
+
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Procesa una trama transmitida en el bus: estadísticas, entrega a Control y reacciones de los nodos.
+ *
+ * @param frame     Trama
+ * @param start_us      Inicio (SOF)
+ * @param frame_end_us  Fin incluida la intermission
+ * @param bits      Bits
+ * @retval None
+ */
+static void Net_Frame_Done(const can_bus_frame_t* frame, uint64_t start_us, uint64_t frame_end_us, uint32_t bits)
+{
+    net_id_stats_t* stats = &id_stats[frame->id];
+    uint32_t delay_us = (uint32_t)(start_us - frame->t_enqueue_us);
+
+    /* La trama es válida al terminar EOF (antes de la intermission) */
+    uint64_t valid_us = frame_end_us - 3U * bus.bit_time_us;
+
+    stats->sent++;
+    stats->bits += bits;
+    stats->delay_sum_us += delay_us;
+    stats->delay_min_us = (delay_us < stats->delay_min_us) ? delay_us : stats->delay_min_us;
+    stats->delay_max_us = (delay_us > stats->delay_max_us) ? delay_us : stats->delay_max_us;
+
+    Net_Timeline_Busy(start_us, frame_end_us);
+    window.frames++;
+
+    if (vcd_file != NULL)
+    {
+        Net_Vcd_Time(start_us);
+        fprintf(vcd_file, "1!\nb");
+
+        for (int i = 10; i >= 0; i--)
+        {
+            fputc(((frame->id >> i) & 1U) ? '1' : '0', vcd_file);
+        }
+
+        fprintf(vcd_file, " \"\n");
+        vcd_pending_end_us = frame_end_us;
+    }
+
+    if (frame->node == kNODE_EXTERNO && valid_us < flood_end_us)
+    {
+        Net_Enqueue(kNODE_EXTERNO, frame->id, frame->data, frame->dlc, valid_us, 0);
+    }
+
+    if (frame->node == kNODE_CONTROL)
+    {
+        /* Latencia pedal-nivel de velocidad vista en el bus */
+        if (frame->id == CAN_ID_CONTROL_NIVEL_VELOCIDAD && frame->tag != 0)
+        {
+            uint64_t latency_us = valid_us - frame->tag;
+
+            window.latency_n++;
+            window.latency_sum_us += latency_us;
+            window.latency_max_us = (latency_us > window.latency_max_us) ? latency_us : window.latency_max_us;
+
+            latency_n++;
+            latency_sum_us += latency_us;
+            latency_max_us = (latency_us > latency_max_us) ? latency_us : latency_max_us;
+
+            if (vcd_file != NULL)
+            {
+                Net_Vcd_Time(valid_us);
+                fprintf(vcd_file, "r%llu $\n", (unsigned long long)latency_us);
+            }
+        }
+
+        /* Respuestas esperadas */
+        for (uint32_t i = 0; i < num_expects; i++)
+        {
+            net_expect_t* expect = &expects[i];
+
+            if (!expect->done && frame->id == expect->id && frame->dlc > 0 &&
+                ((frame->data[0] == expect->value) != expect->not_equal))
+            {
+                expect->done = true;
+                expect->response_us = valid_us;
+            }
+        }
+
+        /* Los módulos responden el echo */
+        if (frame->id == CAN_ID_CONTROL_OK && modules_start_us == UINT64_MAX)
+        {
+            Net_Start_Modules(valid_us + NET_ECHO_REPLY_US);
+        }
+
+        return;
+    }
+
+    /* Filtros de hardware de Control */
+    if ((frame->id & NET_FILTER_MASK) == 0x000 || (frame->id & NET_FILTER_MASK) == 0x020 ||
+        (frame->id & NET_FILTER_MASK) == 0x030 || (frame->id & NET_FILTER_MASK) == 0x040)
+    {
+        SIM_Can_Schedule_Rx(valid_us, frame->id, frame->data, frame->dlc);
+
+        if (frame->id == CAN_ID_PERIFERICOS_PEDAL)
+        {
+            pedal_rx_us[0] = pedal_rx_us[1];
+            pedal_rx_us[1] = valid_us;
+        }
+    }
+}
+
+/**
+ * @brief Acumula tiempo de bus ocupado en las ventanas de la línea de tiempo.
+ *
+ * @param start_us      Inicio
+ * @param frame_end_us  Fin
+ * @retval None
+ */
+static void Net_Timeline_Busy(uint64_t start_us, uint64_t frame_end_us)
+{
+    while (start_us >= window.start_us + window_us)
+    {
+        Net_Timeline_Flush();
+    }
+
+    while (start_us < frame_end_us)
+    {
+        uint64_t window_end = window.start_us + window_us;
+        uint64_t segment_end = (frame_end_us < window_end) ? frame_end_us : window_end;
+
+        window.busy_us += segment_end - start_us;
+        total_busy_us += segment_end - start_us;
+        start_us = segment_end;
+
+        if (start_us == window_end && start_us < frame_end_us)
+        {
+            Net_Timeline_Flush();
+        }
+    }
+}
+
+/**
+ * @brief Cierra la ventana actual de la línea de tiempo y abre la siguiente.
+ *
+ * @param None
+ * @retval None
+ */
+static void Net_Timeline_Flush(void)
+{
+    uint64_t next_start_us;
+    double load = 100.0 * (double)window.busy_us / (double)window_us;
+
+    if (load > peak_load)
+    {
+        peak_load = load;
+    }
+
+    if (csv_file != NULL)
+    {
+        fprintf(csv_file, "%llu,%.1f,%lu,%lu,%u,%lu,%llu,%llu\n", (unsigned long long)(window.start_us / 1000U), load,
+                (unsigned long)window.frames, (unsigned long)window.dropped, (unsigned)window.queue_max,
+                (unsigned long)window.latency_n,
+                window.latency_n ? (unsigned long long)(window.latency_sum_us / window.latency_n) : 0ULL,
+                (unsigned long long)window.latency_max_us);
+    }
+
+    if (vcd_file != NULL)
+    {
+        Net_Vcd_Time(window.start_us + window_us);
+        fprintf(vcd_file, "r%.1f #\n", load);
+    }
+
+    next_start_us = window.start_us + window_us;
+
+    memset(&window, 0, sizeof(window));
+    window.start_us = next_start_us;
+}
+
+/**
+ * @brief Avanza el tiempo del VCD, escribiendo antes el fin de trama pendiente si corresponde.
+ *
+ * @param t_us      Instante
+ * @retval None
+ */
+static void Net_Vcd_Time(uint64_t t_us)
+{
+    if (vcd_pending_end_us <= t_us)
+    {
+        if (vcd_pending_end_us != vcd_last_us)
+        {
+            fprintf(vcd_file, "#%llu\n", (unsigned long long)vcd_pending_end_us);
+            vcd_last_us = vcd_pending_end_us;
+        }
+
+        fprintf(vcd_file, "0!\nbx \"\n");
+        vcd_pending_end_us = UINT64_MAX;
+    }
+
+    if (t_us != vcd_last_us)
+    {
+        fprintf(vcd_file, "#%llu\n", (unsigned long long)t_us);
+        vcd_last_us = t_us;
+    }
+}
+
+/**
+ * @brief Simula la red hasta el instante del tramo y termina al cumplirse la duración.
+ *
+ * @param target_us     Fin del tramo de avance
+ * @retval None
+ */
+static void Net_Advance_Hook(uint64_t target_us)
+{
+    Net_Run_Until(target_us);
+
+    if (target_us >= end_us)
+    {
+        Net_Finish();
+    }
+}
+
+/**
+ * @brief Deja cada trama transmitida por Control en sus mailboxes.
+ *
+ * @param id        Identificador
+ * @param data      Datos
+ * @param dlc       Largo
+ * @param t_us      Instante de transmisión
+ * @retval true     Trama en mailbox
+ * @retval false    Mailboxes ocupados (CAN_Wrapper_TransmitData retorna error)
+ */
+static bool Net_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    uint64_t pedal_us;
+
+    /* Arbitrajes anteriores al instante de la trama, para respetar el orden de tiempo */
+    Net_Run_Until(t_us);
+
+    pedal_us = (pedal_rx_us[1] <= t_us) ? pedal_rx_us[1] : pedal_rx_us[0];
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+    /* Sin cambio de valor es un reenvío de la política de transmisión, no una respuesta al pedal */
+    if (id == CAN_ID_CONTROL_NIVEL_VELOCIDAD)
+    {
+        pedal_us = (data[0] == nivel_velocidad_last) ? 0 : pedal_us;
+    }
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+    if (!Net_Enqueue(kNODE_CONTROL, id, data, dlc, t_us, (id == CAN_ID_CONTROL_NIVEL_VELOCIDAD) ? pedal_us : 0))
+    {
+        return false;
+    }
+
+#if USE_CAN_TX_POLICY_FEATURE == 1
+    if (id == CAN_ID_CONTROL_NIVEL_VELOCIDAD)
+    {
+        nivel_velocidad_last = data[0];
+    }
+#endif /* USE_CAN_TX_POLICY_FEATURE */
+
+    return true;
+}
+
+/**
+ * @brief Imprime el resumen, cierra las salidas y termina el proceso.
+ *
+ * @param None
+ * @retval None
+ */
+static void Net_Finish(void)
+{
+    double wall = Wall_Time_S() - wall_start;
+    double sim_s = (double)SIM_Clock_Now_Us() / 1e6;
+    const profiler_stats_t* latency = LATENCY_Get_Stats();
+    uint64_t total_sent = 0;
+    uint64_t total_dropped = 0;
+    uint32_t late = 0;
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+    can_hw_rx_stats_t rx;
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
+    printf("Tiempo virtual: %.3f s, tiempo real: %.3f s (x%.0f), bitrate: %lu bit/s, factor de tasa: %.2f\n",
+           sim_s, wall, sim_s / wall, (unsigned long)(1000000U / bus.bit_time_us), rate_factor);
+
+    if (modules_start_us == UINT64_MAX)
+    {
+        printf("Control no envió echo: los módulos no iniciaron su tráfico\n");
+    }
+
+    printf("\n  ID    nodo         tramas  descartes  bits/trama   cola min/media/max [us]\n");
+
+    for (uint32_t id = 0; id < NET_MAX_ID; id++)
+    {
+        const net_id_stats_t* s = &id_stats[id];
+        const net_signal_t* signal = Net_Find_Signal(id);
+
+        if (s->sent == 0 && s->dropped == 0)
+        {
+            continue;
+        }
+
+        printf("  0x%03X %-11s %7lu %10lu %11.1f   %6lu %6llu %6lu\n", (unsigned)id,
+               node_names[(signal != NULL) ? signal->node : (id == flood_id) ? kNODE_EXTERNO : kNODE_CONTROL],
+               (unsigned long)s->sent,
+               (unsigned long)s->dropped, s->sent ? (double)s->bits / s->sent : 0.0,
+               s->sent ? (unsigned long)s->delay_min_us : 0UL,
+               s->sent ? (unsigned long long)(s->delay_sum_us / s->sent) : 0ULL, (unsigned long)s->delay_max_us);
+
+        total_sent += s->sent;
+        total_dropped += s->dropped;
+    }
+
+    printf("\nBus: %llu tramas, %llu descartadas, carga media %.1f %%, carga máxima por ventana de %llu ms %.1f %%\n",
+           (unsigned long long)total_sent, (unsigned long long)total_dropped,
+           100.0 * (double)total_busy_us / (double)SIM_Clock_Now_Us(), (unsigned long long)(window_us / 1000U),
+           peak_load);
+
+    printf("Latencia pedal-inversor en Control [us]: n %lu, min %lu, media %lu, max %lu\n",
+           (unsigned long)latency->count, (unsigned long)latency->min,
+           latency->count ? (unsigned long)(latency->sum / latency->count) : 0UL, (unsigned long)latency->max);
+
+    printf("Latencia pedal-nivel de velocidad en el bus [us]: n %lu, media %llu, max %llu",
+           (unsigned long)latency_n, latency_n ? (unsigned long long)(latency_sum_us / latency_n) : 0ULL,
+           (unsigned long long)latency_max_us);
+
+    if (latency_limit_us != 0)
+    {
+        bool ok = latency_n != 0 && latency_max_us <= latency_limit_us;
+
+        printf(" (máx %llu us) %s", (unsigned long long)latency_limit_us, ok ? "OK" : "FALLA");
+        late += ok ? 0U : 1U;
+    }
+
+    printf("\n");
+
+#if USE_CAN_RX_COALESCING_FEATURE == 1
+    CAN_HW_Get_Rx_Stats(&rx);
+
+    printf("Recepción CAN en Control: %lu interrupciones (%.2f tramas c/u), %lu pasadas con lectura (%.2f tramas c/u), "
+           "%lu de FIFO llena, cambios a pasada %lu y a interrupción %lu, %lu tramas perdidas en FIFO\n",
+           (unsigned long)rx.irqs, rx.irqs ? (double)rx.irq_frames / (double)rx.irqs : 0.0, (unsigned long)rx.polls,
+           rx.polls ? (double)rx.poll_frames / (double)rx.polls : 0.0, (unsigned long)rx.full_irqs,
+           (unsigned long)rx.to_polled, (unsigned long)rx.to_irq, (unsigned long)SIM_Can_Get_Rx_Overruns());
+#endif /* USE_CAN_RX_COALESCING_FEATURE */
+
+    if (num_expects != 0)
+    {
+        printf("\nRespuestas de Control\n");
+    }
+
+    for (uint32_t i = 0; i < num_expects; i++)
+    {
+        const net_expect_t* e = &expects[i];
+
+        printf("  t %8.3f s  0x%03X %s0x%02X  ", (double)(e->t_us - modules_start_us) / 1e6, (unsigned)e->id,
+               e->not_equal ? "!" : "", e->value);
+
+        if (e->done)
+        {
+            printf("latencia %llu us", (unsigned long long)(e->response_us - e->t_us));
+        }
+        else
+        {
+            printf("sin respuesta");
+        }
+
+        if (e->max_us != 0)
+        {
+            bool ok = e->done && (e->response_us - e->t_us) <= e->max_us;
+
+            printf(" (máx %llu us) %s", (unsigned long long)e->max_us, ok ? "OK" : "FALLA");
+            late += ok ? 0U : 1U;
+        }
+
+        printf("\n");
+    }
+
+    if (csv_file != NULL)
+    {
+        fclose(csv_file);
+    }
+
+    if (vcd_file != NULL)
+    {
+        Net_Vcd_Time(SIM_Clock_Now_Us());
+        fclose(vcd_file);
+    }
+
+    if (late != 0)
+    {
+        printf("\n%lu latencias sobre su máximo\n", (unsigned long)late);
+    }
+
+    exit((late == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Retorna el tiempo real en segundos.
+ *
+ * @return double
+ */
+static double Wall_Time_S(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Configuración de FreeRTOS para el build de host sobre el port POSIX
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Reemplaza a Core/Inc/FreeRTOSConfig.h en el build de host (Host/Makefile encuentra Stubs/ antes). Tick,
+ * prioridades y opciones de diagnóstico son las de la tarjeta; cambia lo propio del port: cada tarea es un hilo
+ * de pthread cuyo stack (configMINIMAL_STACK_SIZE más lo de app_rtos.h, en palabras de 64 bits) debe ser al
+ * menos PTHREAD_STACK_MIN, y el heap es el de la biblioteca de C (heap_3.c).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/* ---------------------------------------------------- Kernel ---------------------------------------------------- */
+
+#define configUSE_PREEMPTION                        1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     0
+#define configTICK_RATE_HZ                          ((TickType_t)1000)
+#define configMAX_PRIORITIES                        7
+#define configMINIMAL_STACK_SIZE                    ((unsigned short)PTHREAD_STACK_MIN)
+#define configMAX_TASK_NAME_LEN                     16
+#define configUSE_16_BIT_TICKS                      0
+#define configIDLE_SHOULD_YIELD                     1
+#define configUSE_MUTEXES                           0
+#define configUSE_COUNTING_SEMAPHORES               0
+#define configQUEUE_REGISTRY_SIZE                   0
+#define configUSE_TIMERS                            0
+#define configUSE_CO_ROUTINES                       0
+
+/* ---------------------------------------------------- Memoria --------------------------------------------------- */
+
+#define configSUPPORT_STATIC_ALLOCATION             0
+#define configSUPPORT_DYNAMIC_ALLOCATION            1
+#define configTOTAL_HEAP_SIZE                       ((size_t)(1024 * 1024))
+
+/* ------------------------------------------------- Diagnóstico -------------------------------------------------- */
+
+#define configUSE_IDLE_HOOK                         0
+#define configUSE_TICK_HOOK                         0
+#define configCHECK_FOR_STACK_OVERFLOW              2
+#define configUSE_MALLOC_FAILED_HOOK                1
+#define configUSE_TRACE_FACILITY                    1
+
+/** @brief Tiempo de ejecución por tarea con la base de tiempo en us (rtos_hal.c) */
+#define configGENERATE_RUN_TIME_STATS               1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()            TIMEBASE_Get_Us()
+uint32_t TIMEBASE_Get_Us(void);
+
+#define configASSERT(x)                             assert(x)
+
+/* -------------------------------------------------- API incluida ------------------------------------------------ */
+
+#define INCLUDE_vTaskDelay                          1
+#define INCLUDE_vTaskDelayUntil                     1
+#define INCLUDE_vTaskSuspend                        1
+#define INCLUDE_xTaskGetSchedulerState              1
+#define INCLUDE_uxTaskGetStackHighWaterMark         1
+
+/* ------------------------------------------------- Interrupciones ----------------------------------------------- */
+
+/** @brief Mismo límite que en la tarjeta (lo verifica irq_priority.h, que en host no se compila) */
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 1
+
+#endif /* FREERTOS_CONFIG_H */
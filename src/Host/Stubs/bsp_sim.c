@@ -0,0 +1,128 @@
+/**
+ * @file bsp_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief BSP (LEDs y buzzer) de simulación para el build de host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "sim.h"
+
+/* BSP (board support package) include */
+#include "stm32f4xx_control.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Estado de LEDs */
+static bool led_state[LEDn];
+
+/** @brief Cambios de estado de LEDs */
+static uint32_t led_changes[LEDn];
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void SIM_BSP_Reset(void)
+{
+    memset(led_state, 0, sizeof(led_state));
+    memset(led_changes, 0, sizeof(led_changes));
+}
+
+uint32_t SIM_LED_Get_Changes(uint8_t led)
+{
+    return (led < LEDn) ? led_changes[led] : 0;
+}
+
+/***********************************************************************************************************************
+ * BSP functions implementation
+ **********************************************************************************************************************/
+
+int32_t BSP_LED_Init(Led_TypeDef Led)
+{
+    return (Led < LEDn) ? BSP_ERROR_NONE : BSP_ERROR_WRONG_PARAM;
+}
+
+int32_t BSP_LED_DeInit(Led_TypeDef Led)
+{
+    return BSP_LED_Off(Led);
+}
+
+int32_t BSP_LED_On(Led_TypeDef Led)
+{
+    if (Led >= LEDn)
+    {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+
+    if (!led_state[Led])
+    {
+        led_changes[Led]++;
+    }
+
+    led_state[Led] = true;
+
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Off(Led_TypeDef Led)
+{
+    if (Led >= LEDn)
+    {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+
+    led_state[Led] = false;
+
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Toggle(Led_TypeDef Led)
+{
+    if (Led >= LEDn)
+    {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+
+    led_state[Led] = !led_state[Led];
+    led_changes[Led]++;
+
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_GetState(Led_TypeDef Led)
+{
+    return (Led < LEDn) ? (int32_t)led_state[Led] : BSP_ERROR_WRONG_PARAM;
+}
+
+int32_t BSP_BUZZER_Init(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_DeInit(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_On(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_Off(void)
+{
+    return BSP_ERROR_NONE;
+}
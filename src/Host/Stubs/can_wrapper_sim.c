@@ -0,0 +1,201 @@
+/**
+ * @file can_wrapper_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Wrapper CAN de simulación para el build de host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Implementa la misma interfaz que Drivers/CAN_Driver/can_wrapper.c sobre el reloj virtual de sim.h:
+ * la transmisión entrega cada trama a la función registrada con SIM_Can_Set_Tx_Hook, que modela los mailboxes
+ * (si la función rechaza la trama, CAN_Wrapper_TransmitData retorna CAN_STATUS_ERROR) y la recepción
+ * saca tramas de una FIFO 0 de SIM_CAN_RX_FIFO_DEPTH tramas, que llena el reloj virtual. También implementa el
+ * nivel de la FIFO y las notificaciones de la HAL CAN.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "can_wrapper.h"
+
+#include "sim.h"
+
+/* C includes */
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Función llamada por cada trama transmitida */
+static sim_can_tx_hook_t tx_hook = NULL;
+
+/** @brief Identificadores de las tramas en la FIFO 0 */
+static uint32_t rx_fifo_id[SIM_CAN_RX_FIFO_DEPTH];
+
+/** @brief Largos de las tramas en la FIFO 0 */
+static uint8_t rx_fifo_dlc[SIM_CAN_RX_FIFO_DEPTH];
+
+/** @brief Datos de las tramas en la FIFO 0 */
+static uint8_t rx_fifo_data[SIM_CAN_RX_FIFO_DEPTH][PAYLOAD_MAX_LENGTH];
+
+/** @brief Instantes de llegada de las tramas en la FIFO 0 */
+static uint64_t rx_fifo_t_us[SIM_CAN_RX_FIFO_DEPTH];
+
+/** @brief Máxima espera de una trama en la FIFO 0 en us */
+static uint32_t rx_wait_max_us = 0;
+
+/** @brief Primera trama de la FIFO 0 */
+static uint32_t rx_fifo_head = 0;
+
+/** @brief Tramas en la FIFO 0 */
+static uint32_t rx_fifo_level = 0;
+
+/** @brief Tramas perdidas por FIFO 0 llena */
+static uint32_t rx_overruns = 0;
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+can_status_t CAN_Wrapper_Init(void)
+{
+    /* Inicia trigger de transmisión (TIM7) en el reloj virtual */
+    htim7.period_us = SIM_TIM7_PERIOD_US;
+
+    /* Temporización de bit de MX_CAN1_Init (250 kbit/s) */
+    hcan1.Init.Prescaler = 16;
+    hcan1.Init.TimeSeg1 = CAN_BS1_5TQ;
+    hcan1.Init.TimeSeg2 = CAN_BS2_4TQ;
+
+    /* Como CAN_Wrapper_Init: interrupción por mensaje pendiente en FIFO 0 */
+    hcan1.ActiveITs = CAN_IT_RX_FIFO0_MSG_PENDING;
+
+    return CAN_STATUS_OK;
+}
+
+can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data)
+{
+    /* Mailboxes ocupados: la trama no se transmite, como con HAL_CAN_AddTxMessage */
+    if (tx_hook != NULL && !tx_hook(id, data, dlc, SIM_Clock_Now_Us()))
+    {
+        return CAN_STATUS_ERROR;
+    }
+
+    return CAN_STATUS_OK;
+}
+
+can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data)
+{
+    if (rx_fifo_level == 0)
+    {
+        return CAN_STATUS_ERROR;
+    }
+
+    *id = rx_fifo_id[rx_fifo_head];
+    *dlc = rx_fifo_dlc[rx_fifo_head];
+
+    memcpy(data, rx_fifo_data[rx_fifo_head], PAYLOAD_MAX_LENGTH);
+
+    if (SIM_Clock_Now_Us() - rx_fifo_t_us[rx_fifo_head] > rx_wait_max_us)
+    {
+        rx_wait_max_us = (uint32_t)(SIM_Clock_Now_Us() - rx_fifo_t_us[rx_fifo_head]);
+    }
+
+    rx_fifo_head = (rx_fifo_head + 1) % SIM_CAN_RX_FIFO_DEPTH;
+    rx_fifo_level--;
+
+    return CAN_STATUS_OK;
+}
+
+can_status_t CAN_Wrapper_DataCount(void)
+{
+    return CAN_STATUS_OK;
+}
+
+/***********************************************************************************************************************
+ * Simulation functions implementation
+ **********************************************************************************************************************/
+
+void SIM_Can_Set_Tx_Hook(sim_can_tx_hook_t hook)
+{
+    tx_hook = hook;
+}
+
+bool SIM_Can_Set_Rx_Frame(uint32_t id, const uint8_t* data, uint8_t dlc)
+{
+    uint32_t tail = (rx_fifo_head + rx_fifo_level) % SIM_CAN_RX_FIFO_DEPTH;
+
+    if (rx_fifo_level == SIM_CAN_RX_FIFO_DEPTH)
+    {
+        rx_overruns++;
+
+        return false;
+    }
+
+    rx_fifo_id[tail] = id;
+    rx_fifo_dlc[tail] = (dlc > PAYLOAD_MAX_LENGTH) ? PAYLOAD_MAX_LENGTH : dlc;
+    rx_fifo_t_us[tail] = SIM_Clock_Now_Us();
+
+    memset(rx_fifo_data[tail], 0, PAYLOAD_MAX_LENGTH);
+    memcpy(rx_fifo_data[tail], data, (dlc > PAYLOAD_MAX_LENGTH) ? PAYLOAD_MAX_LENGTH : dlc);
+
+    rx_fifo_level++;
+
+    return true;
+}
+
+void SIM_Can_Reset(void)
+{
+    rx_fifo_head = 0;
+    rx_fifo_level = 0;
+    rx_overruns = 0;
+    rx_wait_max_us = 0;
+
+    hcan1.ActiveITs = 0;
+}
+
+uint32_t SIM_Can_Get_Rx_Overruns(void)
+{
+    return rx_overruns;
+}
+
+uint32_t SIM_Can_Take_Rx_Wait_Max_Us(void)
+{
+    uint32_t wait_max_us = rx_wait_max_us;
+
+    rx_wait_max_us = 0;
+
+    return wait_max_us;
+}
+
+/***********************************************************************************************************************
+ * HAL functions implementation
+ **********************************************************************************************************************/
+
+uint32_t HAL_CAN_GetRxFifoFillLevel(CAN_HandleTypeDef* hcan, uint32_t RxFifo)
+{
+    return (RxFifo == CAN_RX_FIFO0) ? rx_fifo_level : 0U;
+}
+
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef* hcan, uint32_t ActiveITs)
+{
+    hcan->ActiveITs |= ActiveITs;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CAN_DeactivateNotification(CAN_HandleTypeDef* hcan, uint32_t InactiveITs)
+{
+    hcan->ActiveITs &= ~InactiveITs;
+
+    return HAL_OK;
+}
+
+/* Como en la HAL, la aplicación lo reemplaza si usa la notificación de FIFO llena */
+__attribute__((weak)) void HAL_CAN_RxFifo0FullCallback(CAN_HandleTypeDef* hcan)
+{
+}
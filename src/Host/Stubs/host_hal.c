@@ -0,0 +1,312 @@
+/**
+ * @file host_hal.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL de tiempo real (Linux) para el build de host sobre SocketCAN
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "host_hal.h"
+
+/* Application includes */
+#include "idle.h"
+#include "timebase.h"
+
+/* CAN driver include */
+#include "can_socketcan.h"
+
+/* C includes */
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+DWT_Type sim_dwt;
+
+CoreDebug_Type sim_core_debug;
+
+DBGMCU_TypeDef sim_dbgmcu;
+
+uint32_t SystemCoreClock = HOST_HAL_CPU_HZ;
+
+CAN_HandleTypeDef hcan1;
+
+TIM_HandleTypeDef htim7;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief CLOCK_MONOTONIC en HOST_HAL_Init en ns */
+static uint64_t start_mono_ns = 0;
+
+/** @brief Diferencia CLOCK_REALTIME - CLOCK_MONOTONIC en ns (para marcas de tiempo del kernel) */
+static int64_t realtime_offset_ns = 0;
+
+/** @brief Próximo update event de TIM7 en us (0: timer detenido) */
+static uint64_t tim7_next_us = 0;
+
+/** @brief Update events de TIM7 generados */
+static uint32_t tim7_events = 0;
+
+#if USE_WFI_IDLE_FEATURE == 1
+/** @brief Próximo SysTick en us (solo despierta al idle de la superloop) */
+static uint64_t systick_next_us = 0;
+#endif /* USE_WFI_IDLE_FEATURE */
+
+/** @brief Instante de la "ISR" de recepción en curso en ns de CLOCK_MONOTONIC (0: fuera de la ISR) */
+static uint64_t rx_mono_ns = 0;
+
+/** @brief Indica que se está ejecutando una "ISR" (evita anidar desde HAL_GetTick) */
+static bool in_service = false;
+
+/** @brief Pedido de término */
+static volatile sig_atomic_t stop_requested = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static uint64_t HOST_HAL_Clock_Ns(clockid_t clock);
+static void HOST_HAL_Set_Cycles(uint64_t mono_ns);
+static void HOST_HAL_Rx_Pending(uint64_t timestamp_ns);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void HOST_HAL_Init(void)
+{
+    start_mono_ns = HOST_HAL_Clock_Ns(CLOCK_MONOTONIC);
+    realtime_offset_ns = (int64_t)(HOST_HAL_Clock_Ns(CLOCK_REALTIME) - start_mono_ns);
+
+    tim7_next_us = 0;
+    tim7_events = 0;
+#if USE_WFI_IDLE_FEATURE == 1
+    systick_next_us = HOST_HAL_SYSTICK_PERIOD_US;
+#endif /* USE_WFI_IDLE_FEATURE */
+    rx_mono_ns = 0;
+    in_service = false;
+
+    HOST_HAL_Set_Cycles(start_mono_ns);
+}
+
+uint64_t HOST_HAL_Now_Us(void)
+{
+    return (HOST_HAL_Clock_Ns(CLOCK_MONOTONIC) - start_mono_ns) / 1000U;
+}
+
+void HOST_HAL_Service(void)
+{
+    uint64_t now_us;
+
+    if (stop_requested)
+    {
+        exit(EXIT_SUCCESS);
+    }
+
+    if (in_service)
+    {
+        return;
+    }
+
+    in_service = true;
+
+    /* Recepción: una "ISR" por trama, con la marca de tiempo del kernel */
+    CAN_SocketCAN_Poll(HOST_HAL_Rx_Pending);
+
+    HOST_HAL_Set_Cycles(HOST_HAL_Clock_Ns(CLOCK_MONOTONIC));
+
+    /* TIM7 corre desde que el socket está abierto; si se atrasó, genera un solo evento (como el flag) */
+    now_us = HOST_HAL_Now_Us();
+
+    if (tim7_next_us == 0 && CAN_SocketCAN_Get_Fd() >= 0)
+    {
+        tim7_next_us = now_us + HOST_HAL_TIM7_PERIOD_US;
+    }
+    else if (tim7_next_us != 0 && now_us >= tim7_next_us)
+    {
+        while (tim7_next_us <= now_us)
+        {
+            tim7_next_us += HOST_HAL_TIM7_PERIOD_US;
+        }
+
+        tim7_events++;
+
+        HAL_TIM_PeriodElapsedCallback(&htim7);
+    }
+
+#if USE_WFI_IDLE_FEATURE == 1
+    /* SysTick: si se atrasó, genera un solo tick (como el pendiente del NVIC) */
+    if (now_us >= systick_next_us)
+    {
+        while (systick_next_us <= now_us)
+        {
+            systick_next_us += HOST_HAL_SYSTICK_PERIOD_US;
+        }
+
+        IDLE_Tick_FromISR();
+    }
+#endif /* USE_WFI_IDLE_FEATURE */
+
+    in_service = false;
+}
+
+void HOST_HAL_Request_Stop(void)
+{
+    stop_requested = 1;
+}
+
+uint32_t HOST_HAL_Get_Tim7_Events(void)
+{
+    return tim7_events;
+}
+
+/***********************************************************************************************************************
+ * HAL functions implementation
+ **********************************************************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    /* Las esperas activas de la aplicación siguen atendiendo la red */
+    HOST_HAL_Service();
+
+    return (uint32_t)(HOST_HAL_Now_Us() / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    const struct timespec poll_period = {0, HOST_HAL_DELAY_POLL_US * 1000L};
+    uint64_t end_us = HOST_HAL_Now_Us() + (uint64_t)Delay * 1000U;
+
+    while (HOST_HAL_Now_Us() < end_us)
+    {
+        HOST_HAL_Service();
+
+        nanosleep(&poll_period, NULL);
+    }
+}
+
+void SIM_Wait_For_Interrupt(void)
+{
+    struct pollfd pfd = {.fd = CAN_SocketCAN_Get_Fd(), .events = POLLIN, .revents = 0};
+    uint64_t now_us = HOST_HAL_Now_Us();
+    uint64_t next_us = (tim7_next_us != 0) ? tim7_next_us : now_us + HOST_HAL_TIM7_PERIOD_US;
+    int timeout_ms;
+
+    if (in_service)
+    {
+        return;
+    }
+
+#if USE_WFI_IDLE_FEATURE == 1
+    next_us = (systick_next_us < next_us) ? systick_next_us : next_us;
+#endif /* USE_WFI_IDLE_FEATURE */
+
+    /* Duerme hasta la próxima trama o el próximo evento de timer */
+    timeout_ms = (next_us > now_us) ? (int)((next_us - now_us + 999U) / 1000U) : 0;
+
+    poll(&pfd, (pfd.fd >= 0) ? 1 : 0, timeout_ms);
+
+    HOST_HAL_Service();
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler llamado en t = %llu us\n", (unsigned long long)HOST_HAL_Now_Us());
+
+    exit(EXIT_FAILURE);
+}
+
+/***********************************************************************************************************************
+ * Timebase functions implementation
+ **********************************************************************************************************************/
+
+void TIMEBASE_Init(void)
+{
+    /* La base de tiempo parte en HOST_HAL_Init */
+}
+
+uint32_t TIMEBASE_Get_Us(void)
+{
+    uint64_t mono_ns;
+
+    /* Igual que HAL_GetTick, las esperas activas sobre la base de tiempo siguen atendiendo la red */
+    HOST_HAL_Service();
+
+    mono_ns = (rx_mono_ns != 0) ? rx_mono_ns : HOST_HAL_Clock_Ns(CLOCK_MONOTONIC);
+
+    /* Mismo desborde cada 2^32 us que TIM2 en la tarjeta */
+    return (mono_ns > start_mono_ns) ? (uint32_t)((mono_ns - start_mono_ns) / 1000U) : 0U;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Retorna la hora de un reloj en ns.
+ *
+ * @param clock     Reloj
+ * @return uint64_t
+ */
+static uint64_t HOST_HAL_Clock_Ns(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Fija DWT->CYCCNT a los ciclos de SystemCoreClock transcurridos hasta un instante.
+ *
+ * @param mono_ns   Instante en ns de CLOCK_MONOTONIC
+ * @retval None
+ */
+static void HOST_HAL_Set_Cycles(uint64_t mono_ns)
+{
+    uint64_t elapsed_ns = (mono_ns > start_mono_ns) ? (mono_ns - start_mono_ns) : 0;
+
+    /* Mismo desborde cada 2^32 ciclos que el contador de la tarjeta */
+    sim_dwt.CYCCNT = (uint32_t)(elapsed_ns * (HOST_HAL_CPU_HZ / 1000000UL) / 1000U);
+}
+
+/**
+ * @brief "ISR" de recepción: CYCCNT y la base de tiempo toman la marca de tiempo del kernel y se llama al callback
+ * de la HAL.
+ *
+ * @param timestamp_ns  Marca de tiempo de recepción (CLOCK_REALTIME), 0 si no hay
+ * @retval None
+ */
+static void HOST_HAL_Rx_Pending(uint64_t timestamp_ns)
+{
+    if (timestamp_ns != 0)
+    {
+        rx_mono_ns = (uint64_t)((int64_t)timestamp_ns - realtime_offset_ns);
+    }
+    else
+    {
+        rx_mono_ns = HOST_HAL_Clock_Ns(CLOCK_MONOTONIC);
+    }
+
+    HOST_HAL_Set_Cycles(rx_mono_ns);
+
+    HAL_CAN_RxFifo0MsgPendingCallback(&hcan1);
+
+    rx_mono_ns = 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file host_hal.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL de tiempo real (Linux) para el build de host sobre SocketCAN
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * A diferencia de sim.h, el tiempo es real (CLOCK_MONOTONIC). HOST_HAL_Service hace el trabajo de las
+ * ISRs: lee sin bloquear el socket CAN (HAL_CAN_RxFifo0MsgPendingCallback por trama) y genera el update
+ * event de TIM7 cada 100 ms (HAL_TIM_PeriodElapsedCallback). HAL_GetTick y HAL_Delay también lo llaman,
+ * para que las esperas de la aplicación sigan atendiendo la red como en la tarjeta. __WFI duerme en poll sobre
+ * el socket hasta la próxima trama o el próximo SysTick/TIM7.
+ *
+ * DWT->CYCCNT cuenta ciclos de SystemCoreClock y TIMEBASE_Get_Us microsegundos (clock_gettime) desde
+ * HOST_HAL_Init. Durante la "ISR" de recepción ambos valen la marca de tiempo de recepción del kernel, así la
+ * latencia medida incluye la espera en el socket.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _HOST_HAL_H_
+#define _HOST_HAL_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+
+/* STM32 HAL include (simulación) */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU emulada (SYSCLK de Control) */
+#define HOST_HAL_CPU_HZ                     80000000UL
+
+/** @brief Periodo de TIM7 (trigger de transmisión CAN) en us */
+#define HOST_HAL_TIM7_PERIOD_US             100000U
+
+/** @brief Periodo de SysTick en us (con USE_WFI_IDLE_FEATURE despierta al idle de la superloop) */
+#define HOST_HAL_SYSTICK_PERIOD_US          1000U
+
+/** @brief Espera entre lecturas del socket dentro de HAL_Delay en us */
+#define HOST_HAL_DELAY_POLL_US              100U
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicia el reloj de la HAL (HAL_GetTick, DWT->CYCCNT y TIMEBASE_Get_Us parten en 0).
+ *
+ * @param None
+ * @retval None
+ */
+void HOST_HAL_Init(void);
+
+/**
+ * @brief Retorna el tiempo desde HOST_HAL_Init en us.
+ *
+ * @return uint64_t
+ */
+uint64_t HOST_HAL_Now_Us(void);
+
+/**
+ * @brief Atiende las "ISRs": recepción CAN pendiente y update event de TIM7.
+ *
+ * TIM7 corre desde que el socket CAN está abierto (como tras CAN_Wrapper_Init en la tarjeta).
+ * Si se pidió detener la ejecución (HOST_HAL_Request_Stop), termina el proceso con exit.
+ *
+ * @param None
+ * @retval None
+ */
+void HOST_HAL_Service(void);
+
+/**
+ * @brief Pide terminar el proceso en la próxima llamada a HOST_HAL_Service (seguro desde señales).
+ *
+ * @param None
+ * @retval None
+ */
+void HOST_HAL_Request_Stop(void);
+
+/**
+ * @brief Retorna el número de update events de TIM7 generados.
+ *
+ * @return uint32_t
+ */
+uint32_t HOST_HAL_Get_Tim7_Events(void);
+
+#endif /* _HOST_HAL_H_ */
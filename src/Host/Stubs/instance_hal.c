@@ -0,0 +1,201 @@
+/**
+ * @file instance_hal.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL, BSP y wrapper CAN por hilo para ejecutar muchas instancias de la aplicación de Control en paralelo
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "instance_hal.h"
+
+/* Application includes */
+#include "timebase.h"
+
+/* BSP (board support package) include */
+#include "stm32f4xx_control.h"
+
+/* CAN driver include */
+#include "can_wrapper.h"
+
+/* C includes */
+#include <stdio.h>
+#include <stdlib.h>
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+/* Solo para enlazar: las instancias del runner no usan DWT, CAN ni TIM7 */
+
+DWT_Type sim_dwt;
+
+CoreDebug_Type sim_core_debug;
+
+DBGMCU_TypeDef sim_dbgmcu;
+
+uint32_t SystemCoreClock = 80000000UL;
+
+CAN_HandleTypeDef hcan1;
+
+TIM_HandleTypeDef htim7;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Tiempo virtual del hilo en ms */
+static _Thread_local uint32_t now_ms = 0;
+
+/** @brief Función llamada por cada trama transmitida desde el hilo */
+static _Thread_local instance_hal_tx_hook_t tx_hook = NULL;
+
+/** @brief Dato entregado a la función de transmisión */
+static _Thread_local void* tx_user = NULL;
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void INSTANCE_HAL_Reset(void)
+{
+    now_ms = 0;
+    tx_hook = NULL;
+    tx_user = NULL;
+}
+
+void INSTANCE_HAL_Set_Time_Ms(uint32_t ms)
+{
+    now_ms = ms;
+}
+
+void INSTANCE_HAL_Set_Tx_Hook(instance_hal_tx_hook_t hook, void* user)
+{
+    tx_hook = hook;
+    tx_user = user;
+}
+
+/***********************************************************************************************************************
+ * HAL functions implementation
+ **********************************************************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    return now_ms;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    now_ms += Delay;
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler llamado en t = %lu ms\n", (unsigned long)now_ms);
+
+    exit(EXIT_FAILURE);
+}
+
+/***********************************************************************************************************************
+ * Timebase functions implementation
+ **********************************************************************************************************************/
+
+void TIMEBASE_Init(void)
+{
+    /* La base de tiempo es el tiempo virtual del hilo */
+}
+
+uint32_t TIMEBASE_Get_Us(void)
+{
+    return now_ms * 1000U;
+}
+
+/***********************************************************************************************************************
+ * CAN wrapper functions implementation
+ **********************************************************************************************************************/
+
+can_status_t CAN_Wrapper_Init(void)
+{
+    return CAN_STATUS_OK;
+}
+
+can_status_t CAN_Wrapper_TransmitData(uint32_t id, uint8_t ide, uint8_t rtr, uint8_t dlc, uint8_t *data)
+{
+    if (tx_hook != NULL)
+    {
+        tx_hook(tx_user, id, data, dlc);
+    }
+
+    return CAN_STATUS_OK;
+}
+
+can_status_t CAN_Wrapper_ReceiveData(uint32_t *id, uint8_t *dlc, uint8_t *data)
+{
+    /* La recepción la hace el runner directamente sobre el contexto */
+    return CAN_STATUS_ERROR;
+}
+
+can_status_t CAN_Wrapper_DataCount(void)
+{
+    return CAN_STATUS_OK;
+}
+
+/***********************************************************************************************************************
+ * BSP functions implementation
+ **********************************************************************************************************************/
+
+int32_t BSP_LED_Init(Led_TypeDef Led)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_DeInit(Led_TypeDef Led)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_On(Led_TypeDef Led)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Off(Led_TypeDef Led)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_Toggle(Led_TypeDef Led)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LED_GetState(Led_TypeDef Led)
+{
+    return 0;
+}
+
+int32_t BSP_BUZZER_Init(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_DeInit(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_On(void)
+{
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_BUZZER_Off(void)
+{
+    return BSP_ERROR_NONE;
+}
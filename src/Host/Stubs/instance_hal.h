@@ -0,0 +1,71 @@
+/**
+ * @file instance_hal.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL por hilo para ejecutar muchas instancias de la aplicación de Control en paralelo
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * A diferencia de sim.h, no hay eventos programados ni ISRs: el runner escribe las tramas en el contexto de la
+ * instancia (CAN_APP_Store_ReceivedMessage y banderas) y llama a MX_APP_Run_Pass. Todo el estado de la HAL
+ * (tiempo virtual y función de transmisión) es local al hilo, de modo que cada hilo ejecuta su instancia sin
+ * compartir nada con los demás.
+ *
+ * LEDs y buzzer no hacen nada. HAL_GetTick y TIMEBASE_Get_Us no consumen tiempo: el tiempo solo avanza con
+ * INSTANCE_HAL_Set_Time_Ms y HAL_Delay.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _INSTANCE_HAL_H_
+#define _INSTANCE_HAL_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+
+/* STM32 HAL include (simulación) */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Función llamada por cada trama que la instancia del hilo deja en mailbox
+ *
+ */
+typedef void (*instance_hal_tx_hook_t)(void* user, uint32_t id, const uint8_t* data, uint8_t dlc);
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Reinicia la HAL del hilo: tiempo virtual en 0 y sin función de transmisión.
+ *
+ * @param None
+ * @retval None
+ */
+void INSTANCE_HAL_Reset(void);
+
+/**
+ * @brief Fija el tiempo virtual del hilo.
+ *
+ * @param ms        Tiempo en ms (valor de HAL_GetTick)
+ * @retval None
+ */
+void INSTANCE_HAL_Set_Time_Ms(uint32_t ms);
+
+/**
+ * @brief Define la función llamada por cada trama transmitida desde el hilo.
+ *
+ * @param hook      Función (NULL para ninguna)
+ * @param user      Dato entregado a la función
+ * @retval None
+ */
+void INSTANCE_HAL_Set_Tx_Hook(instance_hal_tx_hook_t hook, void* user);
+
+#endif /* _INSTANCE_HAL_H_ */
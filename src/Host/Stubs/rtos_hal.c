@@ -0,0 +1,164 @@
+/**
+ * @file rtos_hal.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL de tiempo real para el build de host con FreeRTOS (port POSIX)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "rtos_hal.h"
+#include "sim.h"
+
+/* FreeRTOS includes */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Application includes */
+#include "timebase.h"
+
+/* C includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+DBGMCU_TypeDef sim_dbgmcu;
+uint32_t SystemCoreClock = RTOS_HAL_CPU_HZ;
+
+CAN_HandleTypeDef hcan1;
+TIM_HandleTypeDef htim7;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief CLOCK_MONOTONIC en RTOS_HAL_Init en ns */
+static uint64_t start_mono_ns = 0;
+
+/** @brief PRIMASK emulado (uno por hilo, como uno por tarea en la tarjeta tras el cambio de contexto) */
+static __thread uint32_t primask = 0;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static uint64_t RTOS_HAL_Clock_Ns(void);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void RTOS_HAL_Init(void)
+{
+    start_mono_ns = RTOS_HAL_Clock_Ns();
+}
+
+uint64_t RTOS_HAL_Now_Us(void)
+{
+    return (RTOS_HAL_Clock_Ns() - start_mono_ns) / 1000U;
+}
+
+uint32_t RTOS_HAL_Get_PRIMASK(void)
+{
+    return primask;
+}
+
+void RTOS_HAL_Set_PRIMASK(uint32_t value)
+{
+    if (value != 0U && primask == 0U)
+    {
+        portDISABLE_INTERRUPTS();
+    }
+    else if (value == 0U && primask != 0U)
+    {
+        portENABLE_INTERRUPTS();
+    }
+
+    primask = value;
+}
+
+/***********************************************************************************************************************
+ * HAL functions implementation
+ **********************************************************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(RTOS_HAL_Now_Us() / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    struct timespec ts;
+
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+    {
+        vTaskDelay(pdMS_TO_TICKS(Delay));
+        return;
+    }
+
+    /* Antes del scheduler (MX_APP_Init) */
+    ts.tv_sec = Delay / 1000U;
+    ts.tv_nsec = (long)(Delay % 1000U) * 1000000L;
+
+    nanosleep(&ts, NULL);
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler llamado en t = %llu us\n", (unsigned long long)RTOS_HAL_Now_Us());
+    exit(EXIT_FAILURE);
+}
+
+/***********************************************************************************************************************
+ * Timebase functions implementation
+ **********************************************************************************************************************/
+
+void TIMEBASE_Init(void)
+{
+    /* La base de tiempo parte en RTOS_HAL_Init */
+}
+
+uint32_t TIMEBASE_Get_Us(void)
+{
+    /* Mismo desborde cada 2^32 us que TIM2 en la tarjeta */
+    return (uint32_t)RTOS_HAL_Now_Us();
+}
+
+/***********************************************************************************************************************
+ * Simulation functions implementation
+ **********************************************************************************************************************/
+
+uint64_t SIM_Clock_Now_Us(void)
+{
+    return RTOS_HAL_Now_Us();
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Retorna la hora de CLOCK_MONOTONIC en ns.
+ *
+ * @return uint64_t
+ */
+static uint64_t RTOS_HAL_Clock_Ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
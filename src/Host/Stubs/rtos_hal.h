@@ -0,0 +1,59 @@
+/**
+ * @file rtos_hal.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL de tiempo real para el build de host con FreeRTOS (port POSIX)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * El tiempo es real (CLOCK_MONOTONIC) y lo comparten HAL_GetTick, TIMEBASE_Get_Us, el contador de tiempo de
+ * ejecución de FreeRTOS y SIM_Clock_Now_Us (marca de tiempo de las tramas transmitidas por can_wrapper_sim.c).
+ * Con el scheduler iniciado, HAL_Delay bloquea la tarea (vTaskDelay) en vez del hilo.
+ *
+ * No hay ISRs: quien simula la red llama a HAL_CAN_RxFifo0MsgPendingCallback (después de SIM_Can_Set_Rx_Frame)
+ * y a HAL_TIM_PeriodElapsedCallback desde una tarea de prioridad mayor que las de la aplicación. PRIMASK se
+ * emula bloqueando el tick del scheduler en el hilo actual, así las secciones críticas de la aplicación no son
+ * interrumpidas por un cambio de tarea.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _RTOS_HAL_H_
+#define _RTOS_HAL_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+
+/* STM32 HAL include (simulación) */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU emulada (SYSCLK de Control) */
+#define RTOS_HAL_CPU_HZ                     80000000UL
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Inicia el reloj de la HAL (HAL_GetTick y TIMEBASE_Get_Us parten en 0).
+ *
+ * @param None
+ * @retval None
+ */
+void RTOS_HAL_Init(void);
+
+/**
+ * @brief Retorna el tiempo desde RTOS_HAL_Init en us.
+ *
+ * @return uint64_t
+ */
+uint64_t RTOS_HAL_Now_Us(void);
+
+#endif /* _RTOS_HAL_H_ */
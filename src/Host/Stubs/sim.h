@@ -0,0 +1,203 @@
+/**
+ * @file sim.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief API de simulación para el build de host de la aplicación de Control
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * El tiempo es virtual: solo avanza con SIM_Clock_Advance_Us, HAL_Delay, HAL_GetTick y TIMEBASE_Get_Us (costo
+ * fijo por llamada, para que las esperas activas terminen). Al avanzar, el reloj dispara en orden los eventos
+ * que vencen: SysTick (IDLE_Tick_FromISR, con USE_WFI_IDLE_FEATURE), update event de TIM7
+ * (HAL_TIM_PeriodElapsedCallback) y tramas CAN programadas, igual que las ISRs en la tarjeta. Cada trama entra a
+ * la FIFO 0 simulada (SIM_CAN_RX_FIFO_DEPTH tramas) y llama a HAL_CAN_RxFifo0MsgPendingCallback o, con esa
+ * notificación desactivada, a HAL_CAN_RxFifo0FullCallback cuando la FIFO se llena; si no, queda en la FIFO sin
+ * interrumpir. __WFI avanza el reloj hasta la primera interrupción.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* STM32 HAL include (simulación) */
+#include "main.h"
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU simulada (SYSCLK de Control) */
+#define SIM_CPU_HZ                          80000000UL
+
+/** @brief Tiempo virtual que consume cada llamada a HAL_GetTick o TIMEBASE_Get_Us fuera de una "ISR" en us */
+#define SIM_GET_TICK_COST_US                1U
+
+/** @brief Periodo de TIM7 (trigger de transmisión CAN) en us */
+#define SIM_TIM7_PERIOD_US                  100000U
+
+/** @brief Periodo de SysTick en us (con USE_WFI_IDLE_FEATURE despierta al idle de la superloop) */
+#define SIM_SYSTICK_PERIOD_US               1000U
+
+/** @brief Máximo de tramas CAN programadas pendientes */
+#define SIM_CAN_MAX_SCHEDULED               256
+
+/** @brief Profundidad de la FIFO 0 de recepción CAN (bxCAN) */
+#define SIM_CAN_RX_FIFO_DEPTH               3U
+
+/** @brief Tramo máximo de avance del reloj entre llamadas a la función de avance en us */
+#define SIM_ADVANCE_SLICE_US                1000U
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Función llamada por cada trama que la aplicación quiere dejar en mailbox
+ *
+ * Modela los mailboxes de transmisión: retorna false si están ocupados, y CAN_Wrapper_TransmitData retorna
+ * CAN_STATUS_ERROR como con HAL_CAN_AddTxMessage sin mailbox libre.
+ *
+ */
+typedef bool (*sim_can_tx_hook_t)(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us);
+
+/**
+ * @brief Función llamada antes de cada tramo de avance del reloj (para programar tramas a tiempo)
+ *
+ */
+typedef void (*sim_advance_hook_t)(uint64_t target_us);
+
+/***********************************************************************************************************************
+ * Global variables declarations
+ **********************************************************************************************************************/
+
+extern CAN_HandleTypeDef hcan1;
+
+extern TIM_HandleTypeDef htim7;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Reinicia el reloj virtual, las tramas programadas y el estado de LEDs y buzzer.
+ *
+ * @param None
+ * @retval None
+ */
+void SIM_Init(void);
+
+/**
+ * @brief Retorna el tiempo virtual actual en us.
+ *
+ * @return uint64_t
+ */
+uint64_t SIM_Clock_Now_Us(void);
+
+/**
+ * @brief Avanza el tiempo virtual y dispara en orden los eventos que vencen.
+ *
+ * Avanza en tramos de a lo más SIM_ADVANCE_SLICE_US; antes de cada tramo llama a la función de avance.
+ *
+ * @param us        Tiempo a avanzar en us
+ * @retval None
+ */
+void SIM_Clock_Advance_Us(uint64_t us);
+
+/**
+ * @brief Retorna el instante del próximo evento (trama programada, update event de TIM7 o SysTick).
+ *
+ * @return uint64_t     Instante en us, UINT64_MAX si no hay eventos
+ */
+uint64_t SIM_Clock_Next_Event_Us(void);
+
+/**
+ * @brief Define la función llamada antes de cada tramo de avance del reloj.
+ *
+ * Permite programar tramas desde una fuente larga (log) sin llenar la cola de tramas programadas,
+ * también mientras la aplicación está en una espera activa.
+ *
+ * @param hook      Función (NULL para ninguna)
+ * @retval None
+ */
+void SIM_Set_Advance_Hook(sim_advance_hook_t hook);
+
+/**
+ * @brief Programa la recepción de una trama CAN en un instante de tiempo virtual.
+ *
+ * @param t_us      Instante de llegada en us (si ya pasó, llega en el próximo avance del reloj)
+ * @param id        Identificador estándar
+ * @param data      Datos
+ * @param dlc       Largo [0:8]
+ * @retval true     Trama programada
+ * @retval false    Cola de tramas programadas llena
+ */
+bool SIM_Can_Schedule_Rx(uint64_t t_us, uint32_t id, const uint8_t* data, uint8_t dlc);
+
+/**
+ * @brief Define la función llamada por cada trama transmitida.
+ *
+ * @param hook      Función (NULL para ninguna: los mailboxes siempre aceptan la trama)
+ * @retval None
+ */
+void SIM_Can_Set_Tx_Hook(sim_can_tx_hook_t hook);
+
+/**
+ * @brief Deja una trama recibida en la FIFO 0 del wrapper CAN simulado.
+ *
+ * Uso interno entre la HAL de host y can_wrapper_sim.c; CAN_Wrapper_ReceiveData la saca de la FIFO.
+ *
+ * @param id        Identificador estándar
+ * @param data      Datos
+ * @param dlc       Largo
+ * @retval true     Trama en la FIFO
+ * @retval false    FIFO llena: la trama se pierde (overrun)
+ */
+bool SIM_Can_Set_Rx_Frame(uint32_t id, const uint8_t* data, uint8_t dlc);
+
+/**
+ * @brief Vacía la FIFO 0 del wrapper CAN simulado, borra overruns y espera máxima y desactiva las notificaciones.
+ *
+ * @param None
+ * @retval None
+ */
+void SIM_Can_Reset(void);
+
+/**
+ * @brief Retorna las tramas perdidas por FIFO 0 llena desde SIM_Can_Reset.
+ *
+ * @return uint32_t
+ */
+uint32_t SIM_Can_Get_Rx_Overruns(void);
+
+/**
+ * @brief Retorna la máxima espera de una trama en la FIFO 0 (llegada a lectura) y la borra.
+ *
+ * @return uint32_t     Espera en us
+ */
+uint32_t SIM_Can_Take_Rx_Wait_Max_Us(void);
+
+/**
+ * @brief Reinicia el estado de LEDs y buzzer simulados.
+ *
+ * @param None
+ * @retval None
+ */
+void SIM_BSP_Reset(void);
+
+/**
+ * @brief Retorna el número de veces que se ha conmutado o encendido un LED.
+ *
+ * @param led       Índice de LED [0:2]
+ * @return uint32_t
+ */
+uint32_t SIM_LED_Get_Changes(uint8_t led);
+
+#endif /* _SIM_H_ */
@@ -0,0 +1,406 @@
+/**
+ * @file sim_hal.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Reloj virtual y HAL de simulación para el build de host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "sim.h"
+
+/* Application includes */
+#include "idle.h"
+#include "timebase.h"
+
+/* C includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Trama CAN programada */
+typedef struct
+{
+    uint64_t    t_us;                           /**< Instante de llegada */
+    uint32_t    seq;                            /**< Orden de programación (desempate) */
+    uint32_t    id;                             /**< Identificador */
+    uint8_t     data[8];                        /**< Datos */
+    uint8_t     dlc;                            /**< Largo */
+    bool        used;                           /**< Entrada ocupada */
+
+} sim_scheduled_frame_t;
+
+/***********************************************************************************************************************
+ * Global variables definitions
+ **********************************************************************************************************************/
+
+DWT_Type sim_dwt;
+
+CoreDebug_Type sim_core_debug;
+
+DBGMCU_TypeDef sim_dbgmcu;
+
+uint32_t SystemCoreClock = SIM_CPU_HZ;
+
+CAN_HandleTypeDef hcan1;
+
+TIM_HandleTypeDef htim7;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Tiempo virtual en us */
+static uint64_t now_us = 0;
+
+/** @brief Próximo update event de TIM7 (0: timer detenido) */
+static uint64_t tim7_next_us = 0;
+
+#if USE_WFI_IDLE_FEATURE == 1
+/** @brief Próximo SysTick (solo despierta al idle de la superloop) */
+static uint64_t systick_next_us = 0;
+#endif /* USE_WFI_IDLE_FEATURE */
+
+/** @brief Eventos disparados (para que WFI retorne con el primero) */
+static uint32_t events_fired = 0;
+
+/** @brief Indica que se está ejecutando una "ISR" (evita anidar eventos desde HAL_GetTick) */
+static bool in_event = false;
+
+/** @brief Tramas programadas */
+static sim_scheduled_frame_t scheduled[SIM_CAN_MAX_SCHEDULED];
+
+/** @brief Contador de orden de programación */
+static uint32_t scheduled_seq = 0;
+
+/** @brief Función llamada antes de cada tramo de avance */
+static sim_advance_hook_t advance_hook = NULL;
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void SIM_Clock_Set(uint64_t t_us);
+static void SIM_Clock_Advance_To(uint64_t target, bool stop_at_event);
+static int SIM_Next_Scheduled(uint64_t limit_us);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+void SIM_Init(void)
+{
+    now_us = 0;
+    tim7_next_us = 0;
+#if USE_WFI_IDLE_FEATURE == 1
+    systick_next_us = SIM_SYSTICK_PERIOD_US;
+#endif /* USE_WFI_IDLE_FEATURE */
+    events_fired = 0;
+    in_event = false;
+    scheduled_seq = 0;
+    advance_hook = NULL;
+
+    memset(scheduled, 0, sizeof(scheduled));
+    memset(&htim7, 0, sizeof(htim7));
+
+    SIM_BSP_Reset();
+    SIM_Can_Reset();
+
+    SIM_Clock_Set(0);
+}
+
+uint64_t SIM_Clock_Now_Us(void)
+{
+    return now_us;
+}
+
+void SIM_Clock_Advance_Us(uint64_t us)
+{
+    uint64_t target = now_us + us;
+
+    do
+    {
+        uint64_t slice = (target - now_us > SIM_ADVANCE_SLICE_US) ? now_us + SIM_ADVANCE_SLICE_US : target;
+
+        if (advance_hook != NULL && !in_event)
+        {
+            advance_hook(slice);
+        }
+
+        SIM_Clock_Advance_To(slice, false);
+    }
+    while (now_us < target);
+}
+
+uint64_t SIM_Clock_Next_Event_Us(void)
+{
+    int idx = SIM_Next_Scheduled(UINT64_MAX);
+    uint64_t next = (idx < 0) ? UINT64_MAX : scheduled[idx].t_us;
+
+    if (htim7.period_us != 0)
+    {
+        uint64_t tim7 = (tim7_next_us != 0) ? tim7_next_us : now_us + htim7.period_us;
+
+        next = (tim7 < next) ? tim7 : next;
+    }
+
+#if USE_WFI_IDLE_FEATURE == 1
+    next = (systick_next_us < next) ? systick_next_us : next;
+#endif /* USE_WFI_IDLE_FEATURE */
+
+    return next;
+}
+
+void SIM_Set_Advance_Hook(sim_advance_hook_t hook)
+{
+    advance_hook = hook;
+}
+
+bool SIM_Can_Schedule_Rx(uint64_t t_us, uint32_t id, const uint8_t* data, uint8_t dlc)
+{
+    for (int i = 0; i < SIM_CAN_MAX_SCHEDULED; i++)
+    {
+        if (!scheduled[i].used)
+        {
+            scheduled[i].used = true;
+            scheduled[i].t_us = t_us;
+            scheduled[i].seq = scheduled_seq++;
+            scheduled[i].id = id;
+            scheduled[i].dlc = (dlc > 8) ? 8 : dlc;
+
+            memset(scheduled[i].data, 0, sizeof(scheduled[i].data));
+            memcpy(scheduled[i].data, data, scheduled[i].dlc);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/***********************************************************************************************************************
+ * HAL functions implementation
+ **********************************************************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    /* Cada consulta consume tiempo virtual, para que las esperas activas avancen */
+    if (!in_event)
+    {
+        SIM_Clock_Advance_Us(SIM_GET_TICK_COST_US);
+    }
+
+    return (uint32_t)(now_us / 1000U);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    SIM_Clock_Advance_Us((uint64_t)Delay * 1000U);
+}
+
+void SIM_Wait_For_Interrupt(void)
+{
+    uint32_t fired = events_fired;
+
+    /* Dentro de una "ISR" no hay otra que esperar */
+    if (in_event)
+    {
+        return;
+    }
+
+    /* Avanza por tramos hasta el primer evento, programando tramas a tiempo como SIM_Clock_Advance_Us */
+    while (events_fired == fired)
+    {
+        uint64_t next = SIM_Clock_Next_Event_Us();
+        uint64_t slice = now_us + SIM_ADVANCE_SLICE_US;
+
+        slice = (next < slice) ? next : slice;
+
+        if (advance_hook != NULL)
+        {
+            advance_hook(slice);
+        }
+
+        SIM_Clock_Advance_To(slice, true);
+    }
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler llamado en t = %llu us\n", (unsigned long long)now_us);
+
+    exit(EXIT_FAILURE);
+}
+
+/***********************************************************************************************************************
+ * Timebase functions implementation
+ **********************************************************************************************************************/
+
+void TIMEBASE_Init(void)
+{
+    /* La base de tiempo es el reloj virtual, que parte en 0 con SIM_Init */
+}
+
+uint32_t TIMEBASE_Get_Us(void)
+{
+    /* Igual que HAL_GetTick, para que las esperas activas sobre la base de tiempo avancen */
+    if (!in_event)
+    {
+        SIM_Clock_Advance_Us(SIM_GET_TICK_COST_US);
+    }
+
+    return (uint32_t)now_us;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Fija el tiempo virtual y el contador de ciclos DWT->CYCCNT.
+ *
+ * @param t_us      Tiempo virtual en us
+ * @retval None
+ */
+static void SIM_Clock_Set(uint64_t t_us)
+{
+    now_us = t_us;
+
+    sim_dwt.CYCCNT = (uint32_t)(t_us * (SIM_CPU_HZ / 1000000UL));
+}
+
+/**
+ * @brief Avanza el tiempo virtual hasta un instante y dispara en orden los eventos que vencen.
+ *
+ * @param target        Instante en us
+ * @param stop_at_event Detiene el reloj en el primer evento (WFI)
+ * @retval None
+ */
+static void SIM_Clock_Advance_To(uint64_t target, bool stop_at_event)
+{
+    /* Timer recién iniciado por el wrapper */
+    if (htim7.period_us != 0 && tim7_next_us == 0)
+    {
+        tim7_next_us = now_us + htim7.period_us;
+    }
+
+    while (1)
+    {
+        int idx = SIM_Next_Scheduled(target);
+        uint64_t frame_us = (idx < 0) ? UINT64_MAX : scheduled[idx].t_us;
+        uint64_t tim7_us = (htim7.period_us != 0 && tim7_next_us <= target) ? tim7_next_us : UINT64_MAX;
+        bool isr = true;
+#if USE_WFI_IDLE_FEATURE == 1
+        uint64_t systick_us = (systick_next_us <= target) ? systick_next_us : UINT64_MAX;
+#else
+        uint64_t systick_us = UINT64_MAX;
+#endif /* USE_WFI_IDLE_FEATURE */
+
+        if (idx < 0 && tim7_us == UINT64_MAX && systick_us == UINT64_MAX)
+        {
+            break;
+        }
+
+        in_event = true;
+
+#if USE_WFI_IDLE_FEATURE == 1
+        if (systick_us <= tim7_us && systick_us <= frame_us)
+        {
+            SIM_Clock_Set(systick_us);
+            systick_next_us += SIM_SYSTICK_PERIOD_US;
+
+            IDLE_Tick_FromISR();
+        }
+        else
+#endif /* USE_WFI_IDLE_FEATURE */
+        if (tim7_us <= frame_us)
+        {
+            SIM_Clock_Set(tim7_next_us);
+            tim7_next_us += htim7.period_us;
+
+            HAL_TIM_PeriodElapsedCallback(&htim7);
+        }
+        else
+        {
+            if (frame_us > now_us)
+            {
+                SIM_Clock_Set(frame_us);
+            }
+
+            scheduled[idx].used = false;
+
+            /* La trama entra a la FIFO 0 e interrumpe según las notificaciones activas, como en el bxCAN */
+            if (!SIM_Can_Set_Rx_Frame(scheduled[idx].id, scheduled[idx].data, scheduled[idx].dlc))
+            {
+                isr = false;
+            }
+            else if (hcan1.ActiveITs & CAN_IT_RX_FIFO0_MSG_PENDING)
+            {
+                HAL_CAN_RxFifo0MsgPendingCallback(&hcan1);
+            }
+            else if ((hcan1.ActiveITs & CAN_IT_RX_FIFO0_FULL) &&
+                     HAL_CAN_GetRxFifoFillLevel(&hcan1, CAN_RX_FIFO0) == SIM_CAN_RX_FIFO_DEPTH)
+            {
+                HAL_CAN_RxFifo0FullCallback(&hcan1);
+            }
+            else
+            {
+                isr = false;
+            }
+        }
+
+        in_event = false;
+
+        /* Una trama que queda en la FIFO sin interrumpir no despierta a WFI */
+        if (!isr)
+        {
+            continue;
+        }
+
+        events_fired++;
+
+        if (stop_at_event)
+        {
+            return;
+        }
+    }
+
+    SIM_Clock_Set(target);
+}
+
+/**
+ * @brief Busca la trama programada más antigua que vence hasta un instante.
+ *
+ * @param limit_us  Instante límite
+ * @return int      Índice de la trama, -1 si no hay
+ */
+static int SIM_Next_Scheduled(uint64_t limit_us)
+{
+    int best = -1;
+
+    for (int i = 0; i < SIM_CAN_MAX_SCHEDULED; i++)
+    {
+        if (!scheduled[i].used || scheduled[i].t_us > limit_us)
+        {
+            continue;
+        }
+
+        if (best < 0 || scheduled[i].t_us < scheduled[best].t_us ||
+            (scheduled[i].t_us == scheduled[best].t_us && scheduled[i].seq < scheduled[best].seq))
+        {
+            best = i;
+        }
+    }
+
+    return best;
+}
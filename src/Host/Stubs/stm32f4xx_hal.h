@@ -0,0 +1,198 @@
+/**
+ * @file stm32f4xx_hal.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief HAL de simulación para compilar la aplicación de Control en host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Reemplaza a la HAL de STM32 en el build de host (Host/Makefile la encuentra antes que la real).
+ * Declara solo lo que usa la aplicación: tipos de handles, HAL_GetTick/HAL_Delay sobre el reloj
+ * virtual de sim.h, intrínsecos de CMSIS, los registros DWT/CoreDebug/DBGMCU del contador de ciclos, las
+ * notificaciones de la FIFO 0 de recepción CAN y la temporización de bit de MX_CAN1_Init.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _STM32F4XX_HAL_SIM_H_
+#define _STM32F4XX_HAL_SIM_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+#define ENABLE                              1U
+#define DISABLE                             0U
+
+/* Intrínsecos de CMSIS */
+#if defined(USE_FREERTOS_FEATURE) && (USE_FREERTOS_FEATURE == 1)
+/* Con FreeRTOS (port POSIX), PRIMASK bloquea el tick del scheduler en el hilo actual (rtos_hal.c) */
+#define __disable_irq()                     RTOS_HAL_Set_PRIMASK(1U)
+#define __enable_irq()                      RTOS_HAL_Set_PRIMASK(0U)
+#define __get_PRIMASK()                     RTOS_HAL_Get_PRIMASK()
+#define __set_PRIMASK(priMask)              RTOS_HAL_Set_PRIMASK(priMask)
+#else
+/* Sin RTOS no hay ISR concurrente: una herramienta puede definir SIM_Irq_Before_Mask_Hook para ejecutar una "ISR"
+   justo antes de que se enmascaren las interrupciones (deadman_race.c) */
+#define __disable_irq()                     SIM_Disable_Irq()
+#define __enable_irq()                      ((void)0)
+#define __get_PRIMASK()                     0U
+#define __set_PRIMASK(priMask)              ((void)(priMask))
+#endif /* USE_FREERTOS_FEATURE */
+#define __DMB()                             __sync_synchronize()
+#define __DSB()                             __sync_synchronize()
+#define __ISB()                             __sync_synchronize()
+#define __WFI()                             SIM_Wait_For_Interrupt()
+#define __NOP()                             ((void)0)
+
+/* Contador de ciclos (actualizado por el reloj virtual) */
+#define DWT                                 (&sim_dwt)
+#define CoreDebug                           (&sim_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk              (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk          (1UL << 24)
+
+/* Recepción CAN: FIFO 0 y sus notificaciones (mismos valores que CAN_IER) */
+#define CAN_RX_FIFO0                        0x00000000U
+#define CAN_IT_RX_FIFO0_MSG_PENDING         (1UL << 1)
+#define CAN_IT_RX_FIFO0_FULL                (1UL << 2)
+
+/* Temporización de bit CAN: mismos valores que CAN_BTR */
+#define CAN_BTR_TS1_Pos                     16U
+#define CAN_BTR_TS1                         (0xFUL << CAN_BTR_TS1_Pos)
+#define CAN_BTR_TS2_Pos                     20U
+#define CAN_BTR_TS2                         (0x7UL << CAN_BTR_TS2_Pos)
+#define CAN_BS1_5TQ                         (4UL << CAN_BTR_TS1_Pos)
+#define CAN_BS2_4TQ                         (3UL << CAN_BTR_TS2_Pos)
+
+/* Reloj de APB1 (CAN1): HCLK/2 como en SystemClock_Config */
+#define HAL_RCC_GetPCLK1Freq()              (SystemCoreClock / 2U)
+
+/* Configuración de debug del MCU */
+#define DBGMCU                              (&sim_dbgmcu)
+#define DBGMCU_CR_DBG_SLEEP_Msk             (1UL << 0)
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/** @brief Estado de retorno de funciones HAL */
+typedef enum
+{
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/** @brief Configuración de CAN usada por la aplicación (temporización de bit) */
+typedef struct
+{
+    uint32_t    Prescaler;
+    uint32_t    TimeSeg1;
+    uint32_t    TimeSeg2;
+} CAN_InitTypeDef;
+
+/** @brief Handle de CAN (sin registros en simulación) */
+typedef struct
+{
+    CAN_InitTypeDef Init;
+    uint32_t    ErrorCode;
+    uint32_t    ActiveITs;      /**< Notificaciones activas (CAN_IT_*), en la tarjeta CAN->IER */
+} CAN_HandleTypeDef;
+
+/** @brief Handle de timer (sin registros en simulación) */
+typedef struct
+{
+    uint32_t    period_us;      /**< Periodo del update event en us de tiempo virtual */
+} TIM_HandleTypeDef;
+
+/** @brief Puerto GPIO (sin registros en simulación) */
+typedef struct
+{
+    uint32_t    ODR;
+} GPIO_TypeDef;
+
+/** @brief Registros DWT usados por la aplicación */
+typedef struct
+{
+    volatile uint32_t   CTRL;
+    volatile uint32_t   CYCCNT;
+} DWT_Type;
+
+/** @brief Registros CoreDebug usados por la aplicación */
+typedef struct
+{
+    volatile uint32_t   DEMCR;
+} CoreDebug_Type;
+
+/** @brief Registros DBGMCU usados por la aplicación */
+typedef struct
+{
+    volatile uint32_t   CR;
+} DBGMCU_TypeDef;
+
+/***********************************************************************************************************************
+ * Global variables declarations
+ **********************************************************************************************************************/
+
+extern DWT_Type sim_dwt;
+
+extern CoreDebug_Type sim_core_debug;
+
+extern DBGMCU_TypeDef sim_dbgmcu;
+
+extern uint32_t SystemCoreClock;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+uint32_t HAL_GetTick(void);
+
+void HAL_Delay(uint32_t Delay);
+
+#if !defined(USE_FREERTOS_FEATURE) || (USE_FREERTOS_FEATURE == 0)
+/* Definido solo por herramientas que inyectan una interrupción en __disable_irq (débil: NULL si no existe) */
+void SIM_Irq_Before_Mask_Hook(void) __attribute__((weak));
+
+static inline void SIM_Disable_Irq(void)
+{
+    if (SIM_Irq_Before_Mask_Hook != NULL)
+    {
+        SIM_Irq_Before_Mask_Hook();
+    }
+}
+#endif /* USE_FREERTOS_FEATURE */
+
+/* WFI: la HAL de host espera (o avanza el reloj) hasta la próxima "ISR" y la ejecuta */
+void SIM_Wait_For_Interrupt(void);
+
+/* CAN: el wrapper CAN simulado modela la FIFO 0 y las notificaciones */
+uint32_t HAL_CAN_GetRxFifoFillLevel(CAN_HandleTypeDef* hcan, uint32_t RxFifo);
+
+HAL_StatusTypeDef HAL_CAN_ActivateNotification(CAN_HandleTypeDef* hcan, uint32_t ActiveITs);
+
+HAL_StatusTypeDef HAL_CAN_DeactivateNotification(CAN_HandleTypeDef* hcan, uint32_t InactiveITs);
+
+/* Callbacks implementados por la aplicación (can_hw.c) */
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef* hcan);
+
+void HAL_CAN_RxFifo0FullCallback(CAN_HandleTypeDef* hcan);
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim);
+
+#if defined(USE_FREERTOS_FEATURE) && (USE_FREERTOS_FEATURE == 1)
+/* PRIMASK emulado (rtos_hal.c) */
+uint32_t RTOS_HAL_Get_PRIMASK(void);
+
+void RTOS_HAL_Set_PRIMASK(uint32_t primask);
+#endif /* USE_FREERTOS_FEATURE */
+
+#endif /* _STM32F4XX_HAL_SIM_H_ */
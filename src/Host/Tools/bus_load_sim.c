@@ -0,0 +1,307 @@
+/**
+ * @file bus_load_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para validar el medidor de carga del bus CAN con tráfico sintético
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Genera tramas estándar con ID, DLC y datos aleatorios a una carga conocida, con un escalón de carga a mitad de
+ * la prueba, y compara cada reporte de bus_load.c con la carga de referencia de sus ventanas de 100 ms, 1 s y
+ * 10 s. Además arma los bits reales de cada trama (SOF a CRC, con el CRC-15 de CAN) y cuenta su bit stuffing para
+ * verificar que el largo de peor caso de BUS_LOAD_Frame_Bits nunca queda bajo el real. La base de tiempo empieza
+ * cerca del desborde de 32 bits para cubrir el cruce.
+ *
+ * Uso: ./build/bus_load_sim [carga_inicial_% [carga_final_% [bitrate [semilla]]]]
+ *
+ * Retorna 1 si algún reporte difiere de la referencia en más de una centésima de % o si alguna trama real es
+ * más larga que su peor caso.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bus_load.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Segundos simulados (el escalón de carga ocurre a la mitad) */
+#define SIM_SECONDS             24U
+
+/** @brief Inicio de la base de tiempo, 5 s antes del desborde */
+#define SIM_START_US            (UINT32_MAX - 5000000U)
+
+/** @brief Período de la pasada principal simulada en us */
+#define SIM_PASS_US             500U
+
+/** @brief Polinomio del CRC-15 de CAN */
+#define CAN_CRC15_POLY          0x4599U
+
+/** @brief Bits de una trama fuera del campo con stuffing (delimitadores, ACK, EOF y espacio entre tramas) */
+#define CAN_UNSTUFFED_BITS      13U
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+/**
+ * @brief Largo real en bits de una trama estándar de datos, con el stuffing de sus datos.
+ *
+ * @param id        Identificador estándar
+ * @param dlc       Largo de la trama
+ * @param data      Datos
+ * @return unsigned Bits en el bus, incluido el espacio entre tramas
+ */
+static unsigned Frame_Actual_Bits(unsigned id, unsigned dlc, const uint8_t* data)
+{
+    uint8_t bits[34 + 64];
+    unsigned count = 0;
+    unsigned crc = 0;
+    unsigned stuff = 0;
+    unsigned run = 1;
+    unsigned last;
+    unsigned i;
+
+    /* SOF, ID, RTR, IDE y r0 dominantes, DLC, datos */
+    bits[count++] = 0;
+
+    for (i = 0; i < 11U; i++)
+    {
+        bits[count++] = (uint8_t)((id >> (10U - i)) & 1U);
+    }
+
+    bits[count++] = 0;
+    bits[count++] = 0;
+    bits[count++] = 0;
+
+    for (i = 0; i < 4U; i++)
+    {
+        bits[count++] = (uint8_t)((dlc >> (3U - i)) & 1U);
+    }
+
+    for (i = 0; i < 8U * dlc; i++)
+    {
+        bits[count++] = (uint8_t)((data[i / 8U] >> (7U - (i % 8U))) & 1U);
+    }
+
+    /* CRC-15 sobre SOF a datos */
+    for (i = 0; i < count; i++)
+    {
+        unsigned next = bits[i] ^ ((crc >> 14) & 1U);
+
+        crc = (crc << 1) & 0x7FFFU;
+
+        if (next)
+        {
+            crc ^= CAN_CRC15_POLY;
+        }
+    }
+
+    for (i = 0; i < 15U; i++)
+    {
+        bits[count++] = (uint8_t)((crc >> (14U - i)) & 1U);
+    }
+
+    /* Tras cinco bits iguales va uno de stuffing opuesto, que empieza la cuenta siguiente */
+    last = bits[0];
+
+    for (i = 1; i < count; i++)
+    {
+        if (bits[i] == last)
+        {
+            run++;
+        }
+        else
+        {
+            last = bits[i];
+            run = 1;
+        }
+
+        if (run == 5U)
+        {
+            stuff++;
+            last ^= 1U;
+            run = 1;
+        }
+    }
+
+    return count + stuff + CAN_UNSTUFFED_BITS;
+}
+
+/**
+ * @brief Carga de referencia en centésimas de %.
+ *
+ * @param bits      Bits en las ventanas
+ * @param windows   Ventanas de BUS_LOAD_WINDOW_US
+ * @param bitrate   Bitrate en bit/s
+ * @return double
+ */
+static double Reference_Load(double bits, unsigned windows, unsigned long bitrate)
+{
+    return (windows == 0) ? 0.0 : bits * BUS_LOAD_SCALE * 1e6 / ((double)bitrate * BUS_LOAD_WINDOW_US * windows);
+}
+
+/**
+ * @brief Compara un valor reportado con su referencia (tolerancia: el redondeo a una centésima de %).
+ *
+ * @return int 1 si difiere
+ */
+static int Check(const char* name, unsigned second, unsigned reported, double reference)
+{
+    if (fabs((double)reported - reference) > 1.0)
+    {
+        fprintf(stderr, "seg %u: %s reportada %u, referencia %.1f\n", second, name, reported, reference);
+        return 1;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    unsigned long load_start = (argc > 1) ? strtoul(argv[1], NULL, 0) : 20;
+    unsigned long load_end = (argc > 2) ? strtoul(argv[2], NULL, 0) : 60;
+    unsigned long bitrate = (argc > 3) ? strtoul(argv[3], NULL, 0) : 250000;
+    unsigned seed = (argc > 4) ? (unsigned)strtoul(argv[4], NULL, 0) : 1;
+
+    /* Una ventana de más: la trama del instante del último reporte cae en la ventana siguiente */
+    static double window_bits[SIM_SECONDS * BUS_LOAD_WINDOWS_1S + 1U];
+    uint64_t elapsed = 0;
+    uint64_t next_pass = 0;
+    double next_frame = 0.0;
+    double worst_total = 0.0;
+    double actual_total = 0.0;
+    unsigned long frames = 0;
+    unsigned windows_closed = 0;
+    unsigned seconds = 0;
+    int errors = 0;
+    int underestimated = 0;
+    bus_load_report_t report;
+
+    if (load_start > 100 || load_end > 100 || bitrate == 0)
+    {
+        fprintf(stderr, "cargas deben estar en [0:100] y bitrate ser mayor que 0\n");
+        return 1;
+    }
+
+    srand(seed);
+
+    BUS_LOAD_Init((uint32_t)bitrate, SIM_START_US);
+
+    printf("%-4s %9s %9s %9s %9s %9s %9s %9s %8s\n",
+           "seg", "100ms[%]", "ref[%]", "1s[%]", "ref[%]", "10s[%]", "ref[%]", "max[%]", "tramas");
+
+    while (seconds < SIM_SECONDS)
+    {
+        unsigned long load = (elapsed < (uint64_t)SIM_SECONDS * 500000U) ? load_start : load_end;
+        uint64_t now = (next_frame < (double)next_pass && load != 0) ? (uint64_t)next_frame : next_pass;
+        uint32_t now_us = (uint32_t)(SIM_START_US + now);
+
+        elapsed = now;
+
+        /* La pasada principal cierra ventanas antes de que la trama de este instante se sume */
+        BUS_LOAD_Process(now_us);
+
+        if (now == next_pass)
+        {
+            next_pass += SIM_PASS_US;
+        }
+        else
+        {
+            unsigned id = (unsigned)rand() & 0x7FFU;
+            unsigned dlc = (unsigned)rand() % 9U;
+            uint8_t data[8];
+            unsigned worst = BUS_LOAD_Frame_Bits((uint8_t)dlc);
+            unsigned actual;
+            unsigned i;
+
+            for (i = 0; i < dlc; i++)
+            {
+                data[i] = (uint8_t)rand();
+            }
+
+            actual = Frame_Actual_Bits(id, dlc, data);
+
+            if (actual > worst)
+            {
+                fprintf(stderr, "ID 0x%03X DLC %u: %u bits reales, peor caso %u\n", id, dlc, actual, worst);
+                underestimated = 1;
+            }
+
+            BUS_LOAD_Record((uint8_t)dlc);
+
+            window_bits[now / BUS_LOAD_WINDOW_US] += worst;
+            worst_total += worst;
+            actual_total += actual;
+            frames++;
+
+            /* La trama siguiente llega cuando el bus, a la carga objetivo, terminó de transmitir esta */
+            next_frame += (double)worst * 1e6 * 100.0 / ((double)bitrate * (double)load);
+        }
+
+        if (load == 0 && next_frame < (double)now)
+        {
+            next_frame = (double)now;
+        }
+
+        if (BUS_LOAD_Get_Report(&report))
+        {
+            double sum_1s = 0.0;
+            double sum_10s = 0.0;
+            double max_100ms = 0.0;
+            unsigned history;
+            unsigned i;
+
+            seconds++;
+            windows_closed = seconds * BUS_LOAD_WINDOWS_1S;
+            history = (windows_closed < BUS_LOAD_WINDOWS_10S) ? windows_closed : BUS_LOAD_WINDOWS_10S;
+
+            for (i = windows_closed - history; i < windows_closed; i++)
+            {
+                sum_10s += window_bits[i];
+
+                if (i >= windows_closed - BUS_LOAD_WINDOWS_1S)
+                {
+                    sum_1s += window_bits[i];
+                    max_100ms = (window_bits[i] > max_100ms) ? window_bits[i] : max_100ms;
+                }
+            }
+
+            errors |= Check("carga 100 ms", seconds, report.load_100ms,
+                            Reference_Load(window_bits[windows_closed - 1U], 1, bitrate));
+            errors |= Check("carga 1 s", seconds, report.load_1s, Reference_Load(sum_1s, BUS_LOAD_WINDOWS_1S, bitrate));
+            errors |= Check("carga 10 s", seconds, report.load_10s, Reference_Load(sum_10s, history, bitrate));
+            errors |= Check("máximo 100 ms", seconds, report.load_100ms_max, Reference_Load(max_100ms, 1, bitrate));
+
+            printf("%-4u %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f %8lu\n", seconds,
+                   report.load_100ms / 100.0, Reference_Load(window_bits[windows_closed - 1U], 1, bitrate) / 100.0,
+                   report.load_1s / 100.0, Reference_Load(sum_1s, BUS_LOAD_WINDOWS_1S, bitrate) / 100.0,
+                   report.load_10s / 100.0, Reference_Load(sum_10s, history, bitrate) / 100.0,
+                   report.load_100ms_max / 100.0, (unsigned long)report.frames_1s);
+        }
+    }
+
+    printf("\n%lu tramas: peor caso %.0f bits, real %.0f bits (el peor caso sobreestima %.1f %%)\n", frames,
+           worst_total, actual_total, (actual_total > 0.0) ? 100.0 * (worst_total / actual_total - 1.0) : 0.0);
+
+    if (errors || underestimated)
+    {
+        fprintf(stderr, "%s\n", errors ? "reporte fuera de tolerancia" : "peor caso menor que el largo real");
+        return 1;
+    }
+
+    return 0;
+}
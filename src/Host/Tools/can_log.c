@@ -0,0 +1,300 @@
+/**
+ * @file can_log.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Lectura y escritura de logs CAN (candump y Vector ASC) para herramientas de host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include "can_log.h"
+
+/* C includes */
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static const char* CAN_LOG_Parse_Time(const char* p, uint64_t* t_us);
+static bool CAN_LOG_Parse_Candump_Log(const char* line, can_log_frame_t* frame);
+static bool CAN_LOG_Parse_Candump(const char* line, can_log_frame_t* frame);
+static bool CAN_LOG_Parse_Asc(const char* line, can_log_frame_t* frame);
+
+/***********************************************************************************************************************
+ * Public functions implementation
+ **********************************************************************************************************************/
+
+bool CAN_LOG_Parse_Line(const char* line, can_log_frame_t* frame)
+{
+    const char* p = line;
+
+    memset(frame, 0, sizeof(*frame));
+
+    while (isspace((unsigned char)*p))
+    {
+        p++;
+    }
+
+    /* candump con marca de tiempo "(t)" */
+    if (*p == '(')
+    {
+        p = CAN_LOG_Parse_Time(p + 1, &frame->t_us);
+
+        if (p == NULL || *p != ')')
+        {
+            return false;
+        }
+
+        frame->has_time = true;
+        p++;
+    }
+
+    if (strchr(p, '#') != NULL)
+    {
+        return CAN_LOG_Parse_Candump_Log(p, frame);
+    }
+
+    if (strchr(p, '[') != NULL)
+    {
+        return CAN_LOG_Parse_Candump(p, frame);
+    }
+
+    /* ASC: la línea empieza con la marca de tiempo en segundos */
+    if (!frame->has_time && isdigit((unsigned char)*p))
+    {
+        return CAN_LOG_Parse_Asc(p, frame);
+    }
+
+    return false;
+}
+
+void CAN_LOG_Write_Frame(FILE* file, uint64_t t_us, const char* ifname, uint32_t id, const uint8_t* data,
+                         uint8_t dlc)
+{
+    fprintf(file, "(%llu.%06llu) %s %03X#", (unsigned long long)(t_us / 1000000U),
+            (unsigned long long)(t_us % 1000000U), ifname, (unsigned)id);
+
+    for (uint8_t i = 0; i < dlc && i < CAN_LOG_MAX_DLC; i++)
+    {
+        fprintf(file, "%02X", data[i]);
+    }
+
+    fputc('\n', file);
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Interpreta una marca de tiempo "segundos.fracción" sin pasar por punto flotante.
+ *
+ * @param p         Texto
+ * @param t_us      Marca de tiempo en us
+ * @return const char*  Primer carácter después de la marca de tiempo, NULL si no hay marca de tiempo
+ */
+static const char* CAN_LOG_Parse_Time(const char* p, uint64_t* t_us)
+{
+    char* end;
+    uint64_t sec = strtoull(p, &end, 10);
+    uint64_t frac = 0;
+    int digits = 0;
+
+    if (end == p)
+    {
+        return NULL;
+    }
+
+    p = end;
+
+    if (*p == '.')
+    {
+        p++;
+
+        while (isdigit((unsigned char)*p))
+        {
+            if (digits < 6)
+            {
+                frac = frac * 10U + (uint64_t)(*p - '0');
+                digits++;
+            }
+
+            p++;
+        }
+    }
+
+    while (digits < 6)
+    {
+        frac *= 10U;
+        digits++;
+    }
+
+    *t_us = sec * 1000000U + frac;
+
+    return p;
+}
+
+/**
+ * @brief Interpreta el resto de una línea candump -l: "can0 01F#0001...".
+ *
+ * @param line      Texto después de la marca de tiempo
+ * @param frame     Trama leída
+ * @retval true     Trama válida
+ * @retval false    Trama no válida (RTR, CAN FD o datos mal formados)
+ */
+static bool CAN_LOG_Parse_Candump_Log(const char* line, can_log_frame_t* frame)
+{
+    const char* hash = strchr(line, '#');
+    const char* q = hash;
+    const char* p = hash + 1;
+
+    while (q > line && isxdigit((unsigned char)q[-1]))
+    {
+        q--;
+    }
+
+    if (q == hash || *p == 'R' || *p == '#')
+    {
+        return false;
+    }
+
+    frame->id = (uint32_t)strtoul(q, NULL, 16);
+    frame->extended = (hash - q) > 3;
+
+    while (isxdigit((unsigned char)p[0]) && isxdigit((unsigned char)p[1]) && frame->dlc < CAN_LOG_MAX_DLC)
+    {
+        char byte[3] = {p[0], p[1], '\0'};
+
+        frame->data[frame->dlc++] = (uint8_t)strtoul(byte, NULL, 16);
+        p += 2;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Interpreta el resto de una línea candump por defecto: "can0  01F   [8]  00 01 ...".
+ *
+ * @param line      Texto después de la marca de tiempo (si había)
+ * @param frame     Trama leída
+ * @retval true     Trama válida
+ * @retval false    Trama no válida
+ */
+static bool CAN_LOG_Parse_Candump(const char* line, can_log_frame_t* frame)
+{
+    const char* p = strchr(line, '[');
+    const char* q = p;
+    const char* id_end;
+    char* end;
+    unsigned long dlc;
+
+    /* Identificador es el último token antes de '[' */
+    while (q > line && isspace((unsigned char)q[-1]))
+    {
+        q--;
+    }
+
+    id_end = q;
+
+    while (q > line && isxdigit((unsigned char)q[-1]))
+    {
+        q--;
+    }
+
+    if (q == id_end)
+    {
+        return false;
+    }
+
+    frame->id = (uint32_t)strtoul(q, NULL, 16);
+    frame->extended = (id_end - q) > 3;
+
+    dlc = strtoul(p + 1, &end, 10);
+
+    if (dlc > CAN_LOG_MAX_DLC || (end = strchr(end, ']')) == NULL)
+    {
+        return false;
+    }
+
+    p = end + 1;
+
+    for (unsigned long i = 0; i < dlc; i++)
+    {
+        frame->data[i] = (uint8_t)strtoul(p, &end, 16);
+
+        if (end == p)
+        {
+            /* "remote request" u otro texto en vez de datos */
+            return false;
+        }
+
+        p = end;
+    }
+
+    frame->dlc = (uint8_t)dlc;
+
+    return true;
+}
+
+/**
+ * @brief Interpreta una línea de trama de datos ASC: "12.345678 1  01F  Rx   d 8 00 01 ...".
+ *
+ * @param line      Texto desde la marca de tiempo
+ * @param frame     Trama leída
+ * @retval true     Trama válida
+ * @retval false    Encabezado, evento o trama no de datos
+ */
+static bool CAN_LOG_Parse_Asc(const char* line, can_log_frame_t* frame)
+{
+    char id_text[16];
+    char dir[8];
+    char type[4];
+    unsigned channel;
+    unsigned dlc;
+    int consumed;
+    char* end;
+    const char* p = CAN_LOG_Parse_Time(line, &frame->t_us);
+
+    if (p == NULL ||
+        sscanf(p, "%u %15s %7s %3s %u%n", &channel, id_text, dir, type, &dlc, &consumed) != 5 ||
+        (strcmp(dir, "Rx") != 0 && strcmp(dir, "Tx") != 0) || strcmp(type, "d") != 0 || dlc > CAN_LOG_MAX_DLC)
+    {
+        return false;
+    }
+
+    frame->id = (uint32_t)strtoul(id_text, &end, 16);
+
+    if (end == id_text)
+    {
+        return false;
+    }
+
+    frame->extended = (*end == 'x');
+    frame->has_time = true;
+    p += consumed;
+
+    for (unsigned i = 0; i < dlc; i++)
+    {
+        frame->data[i] = (uint8_t)strtoul(p, &end, 16);
+
+        if (end == p)
+        {
+            return false;
+        }
+
+        p = end;
+    }
+
+    frame->dlc = (uint8_t)dlc;
+
+    return true;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file can_log.h
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Lectura y escritura de logs CAN (candump y Vector ASC) para herramientas de host
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Formatos de lectura:
+ *   candump -l / -L:       "(1700000000.123456) can0 01F#0001020304050607"
+ *   candump (por defecto): "  can0  01F   [8]  00 01 02 03 04 05 06 07", con "(t)" inicial si se usó -t
+ *   Vector ASC (base hex): "   12.345678 1  01F             Rx   d 8 00 01 02 03 04 05 06 07"
+ *
+ * Escritura en formato candump -l, con el tiempo en us.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef _CAN_LOG_H_
+#define _CAN_LOG_H_
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/***********************************************************************************************************************
+ * Macros
+ **********************************************************************************************************************/
+
+/** @brief Largo máximo de datos de una trama */
+#define CAN_LOG_MAX_DLC                     8
+
+/** @brief Largo máximo de línea de log */
+#define CAN_LOG_LINE_MAX_LENGTH             256
+
+/***********************************************************************************************************************
+ * Types declarations
+ **********************************************************************************************************************/
+
+/**
+ * @brief Trama leída de un log
+ *
+ */
+typedef struct
+{
+    uint64_t    t_us;                           /**< Marca de tiempo en us (válida si has_time) */
+    bool        has_time;                       /**< La línea tenía marca de tiempo */
+    bool        extended;                       /**< Identificador extendido */
+    uint32_t    id;                             /**< Identificador */
+    uint8_t     dlc;                            /**< Largo */
+    uint8_t     data[CAN_LOG_MAX_DLC];          /**< Datos */
+
+} can_log_frame_t;
+
+/***********************************************************************************************************************
+ * Public function prototypes
+ **********************************************************************************************************************/
+
+/**
+ * @brief Interpreta una línea de log candump o ASC.
+ *
+ * @param line      Línea de texto
+ * @param frame     Trama leída
+ * @retval true     Línea contiene una trama
+ * @retval false    Línea no contiene una trama (encabezado, comentario, evento de error, etc.)
+ */
+bool CAN_LOG_Parse_Line(const char* line, can_log_frame_t* frame);
+
+/**
+ * @brief Escribe una trama en formato candump -l.
+ *
+ * @param file      Archivo de salida
+ * @param t_us      Marca de tiempo en us
+ * @param ifname    Nombre de interfaz
+ * @param id        Identificador estándar
+ * @param data      Datos
+ * @param dlc       Largo
+ * @retval None
+ */
+void CAN_LOG_Write_Frame(FILE* file, uint64_t t_us, const char* ifname, uint32_t id, const uint8_t* data,
+                         uint8_t dlc);
+
+#endif /* _CAN_LOG_H_ */
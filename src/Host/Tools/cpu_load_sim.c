@@ -0,0 +1,110 @@
+/**
+ * @file cpu_load_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para validar el monitor de carga de CPU con patrones sintéticos
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Genera pasadas de superloop con duración conocida y compara la carga real del patrón con el
+ * reporte de cpu_load.c. Con wfi en 1 el tiempo idle es sueño en WFI (CPU_LOAD_Sleep) en vez de pasadas
+ * sin trabajo, como con USE_WFI_IDLE_FEATURE.
+ *
+ * Uso: ./build/cpu_load_sim [carga_% [ciclos_pasada_ocupada [ciclos_pasada_idle [cada_n_pico [ciclos_pico [wfi]]]]]]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cpu_load.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU simulada (SYSCLK de Control) */
+#define SIM_CPU_HZ              80000000UL
+
+/** @brief Segundos simulados */
+#define SIM_SECONDS             5U
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    unsigned long load_pct = (argc > 1) ? strtoul(argv[1], NULL, 0) : 30;
+    unsigned long busy_cycles = (argc > 2) ? strtoul(argv[2], NULL, 0) : 4000;
+    unsigned long idle_cycles = (argc > 3) ? strtoul(argv[3], NULL, 0) : 800;
+    unsigned long spike_every = (argc > 4) ? strtoul(argv[4], NULL, 0) : 0;
+    unsigned long spike_cycles = (argc > 5) ? strtoul(argv[5], NULL, 0) : 0;
+    bool wfi = (argc > 6) && (strtoul(argv[6], NULL, 0) != 0);
+
+    uint64_t now = 0;
+    uint64_t busy_total = 0;
+    unsigned long pass = 0;
+    unsigned seconds = 0;
+    cpu_load_report_t report;
+
+    if (load_pct > 100)
+    {
+        fprintf(stderr, "carga debe estar en [0:100]\n");
+        return 1;
+    }
+
+    CPU_LOAD_Init(SIM_CPU_HZ, CPU_LOAD_DEADLINE_US);
+
+    printf("%-4s %8s %8s %8s %10s %10s %10s %8s\n",
+           "seg", "real[%]", "est[%]", "pasadas", "min[us]", "max[us]", "p99[us]", "perdidos");
+
+    while (seconds < SIM_SECONDS)
+    {
+        /* Pasada ocupada cuando la carga acumulada queda bajo la carga objetivo */
+        bool busy = (busy_total * 100U) < (now * load_pct);
+        uint64_t duration = busy ? busy_cycles : idle_cycles;
+
+        if (spike_every != 0 && (pass % spike_every) == spike_every - 1)
+        {
+            duration += spike_cycles;
+        }
+
+        if (wfi && !busy)
+        {
+            /* Idle: dormido hasta la próxima interrupción */
+            CPU_LOAD_Sleep((uint32_t)duration);
+            now += duration;
+        }
+        else
+        {
+            CPU_LOAD_Pass_Begin((uint32_t)now, busy);
+            now += duration;
+            CPU_LOAD_Pass_End((uint32_t)now);
+
+            if (busy)
+            {
+                busy_total += duration;
+            }
+        }
+
+        pass++;
+
+        if (CPU_LOAD_Get_Report(&report))
+        {
+            seconds++;
+
+            printf("%-4u %8.1f %8u %8lu %10lu %10lu %10lu %8lu\n", seconds,
+                   100.0 * (double)busy_total / (double)now, report.load_pct, (unsigned long)report.passes,
+                   (unsigned long)report.period_min_us, (unsigned long)report.period_max_us,
+                   (unsigned long)report.period_p99_us, (unsigned long)report.missed_deadlines);
+        }
+    }
+
+    return 0;
+}
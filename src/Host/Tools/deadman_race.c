@@ -0,0 +1,159 @@
+/**
+ * @file deadman_race.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Prueba de host de la carrera entre RAMPA_PEDAL_Process y el camino rápido de hombre muerto
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * RAMPA_PEDAL_Process calcula la velocidad con el snapshot de la pasada y luego escribe el bus de salida CAN. Si
+ * la trama de hombre muerto presionado llega entre la lectura y la escritura, la ISR deja el corte (velocidad 0,
+ * hombre muerto ON) en el bus de salida y la pasada no debe pisarlo con la velocidad del pedal.
+ *
+ * La prueba define SIM_Irq_Before_Mask_Hook (stm32f4xx_hal.h de Stubs/): la primera vez que RAMPA_PEDAL_Process
+ * enmascara interrupciones, el hook entrega la trama de hombre muerto con CAN_APP_Store_ReceivedMessage, como la
+ * ISR de recepción que entra justo antes. Luego comprueba las tramas del camino rápido y el bus de salida, que es
+ * lo que transmite después la pasada principal.
+ *
+ * Uso: ./build/deadman_race
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+/* Application includes */
+#include "app_control.h"
+#include "can_app.h"
+#include "can_def.h"
+#include "rampa_pedal.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Pedal de la pasada (con rampa NORMAL da velocidad distinta de 0) */
+#define RACE_PEDAL              60.0f
+
+/***********************************************************************************************************************
+ * Private variables
+ **********************************************************************************************************************/
+
+static app_context_t* race_ctx;
+
+/** @brief Inyección pendiente en el próximo __disable_irq */
+static bool race_armed;
+
+/** @brief La inyección ocurrió */
+static bool race_fired;
+
+/** @brief Último payload transmitido de nivel de velocidad y hombre muerto (-1: ninguno) */
+static int last_nivel_velocidad = -1;
+static int last_hombre_muerto = -1;
+
+static unsigned failures;
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+/**
+ * @brief "ISR" de recepción de la trama de hombre muerto, justo antes de enmascarar interrupciones.
+ */
+void SIM_Irq_Before_Mask_Hook(void)
+{
+    can_frame_t frame = {0};
+
+    if (!race_armed)
+    {
+        return;
+    }
+
+    /* Se desarma antes: el camino rápido también enmascara interrupciones */
+    race_armed = false;
+    race_fired = true;
+
+    frame.id = CAN_ID_PERIFERICOS_HOMBRE_MUERTO;
+    frame.DLC = 1;
+    frame.payload_length = 1;
+    frame.payload_buff[0] = CAN_VALUE_HOMBRE_MUERTO_ON;
+
+    CAN_APP_Store_ReceivedMessage(race_ctx, &frame);
+}
+
+static bool Race_Tx_Hook(uint32_t id, const uint8_t* data, uint8_t dlc, uint64_t t_us)
+{
+    if (id == CAN_ID_CONTROL_NIVEL_VELOCIDAD)
+    {
+        last_nivel_velocidad = data[0];
+    }
+    else if (id == CAN_ID_CONTROL_HOMBRE_MUERTO)
+    {
+        last_hombre_muerto = data[0];
+    }
+
+    return true;
+}
+
+static void Race_Check(bool ok, const char* what, int value)
+{
+    printf("%s: %d (%s)\n", what, value, ok ? "OK" : "FALLA");
+
+    if (!ok)
+    {
+        failures++;
+    }
+}
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(void)
+{
+    SIM_Init();
+    SIM_Can_Set_Tx_Hook(Race_Tx_Hook);
+
+    MX_APP_Init();
+    race_ctx = MX_APP_Get_Context();
+
+    /* Snapshot de la pasada: modo NORMAL, pedal pisado, hombre muerto suelto */
+    race_ctx->bus_data.driving_mode = kDRIVING_MODE_NORMAL;
+    race_ctx->bus_data.Rx_Peripherals.pedal = RACE_PEDAL;
+    race_ctx->bus_data.Rx_Peripherals.hombre_muerto = kHOMBRE_MUERTO_OFF;
+
+    /* Pasada sin inyección: el pedal debe dar velocidad, si no la prueba no dice nada */
+    RAMPA_PEDAL_Process(race_ctx);
+    Race_Check(race_ctx->bus_can_output.nivel_velocidad != 0, "Sin hombre muerto: nivel de velocidad",
+               race_ctx->bus_can_output.nivel_velocidad);
+
+    /* Pasada con la trama de hombre muerto entre la lectura del snapshot y la escritura del bus de salida */
+    race_armed = true;
+    RAMPA_PEDAL_Process(race_ctx);
+
+    Race_Check(race_fired, "Trama inyectada durante RAMPA_PEDAL_Process", race_fired);
+    Race_Check(last_nivel_velocidad == 0, "Camino rápido: nivel de velocidad transmitido", last_nivel_velocidad);
+    Race_Check(last_hombre_muerto == CAN_VALUE_HOMBRE_MUERTO_ON, "Camino rápido: hombre muerto transmitido",
+               last_hombre_muerto);
+    Race_Check(race_ctx->bus_can_output.nivel_velocidad == 0, "Bus de salida tras la pasada: nivel de velocidad",
+               race_ctx->bus_can_output.nivel_velocidad);
+    Race_Check(race_ctx->bus_can_output.hombre_muerto == CAN_VALUE_HOMBRE_MUERTO_ON,
+               "Bus de salida tras la pasada: hombre muerto", race_ctx->bus_can_output.hombre_muerto);
+
+    if (failures != 0U)
+    {
+        fprintf(stderr, "FALLA: %u comprobaciones\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
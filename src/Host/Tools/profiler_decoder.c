@@ -0,0 +1,210 @@
+/**
+ * @file profiler_decoder.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para decodificar tramas de diagnóstico del profiler y de latencia
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Lee por entrada estándar la salida de candump o un log ASC (formatos de can_log.h) y al terminar imprime una tabla con las estadísticas
+ * de ciclos de cada etapa (CAN 0x01F) y de latencia pedal-inversor en us (CAN 0x01E). Si el log trae un volcado de
+ * estadísticas de llegada por ID (CAN 0x01D, pedido con "cansend can0 007#01"), imprime además esa tabla, con las
+ * pérdidas, tramas fuera de orden y duplicadas de los IDs que traen contador de secuencia.
+ *
+ * Uso: candump can0,01C:7FC | ./build/profiler_decoder [-c <frecuencia_cpu_hz>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "can_log.h"
+#include "profiler.h"
+#include "rx_timing.h"
+#include "can_def.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU por defecto (SYSCLK de Control) */
+#define DEFAULT_CPU_HZ          80000000UL
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Print_Table(const profiler_stats_t* stats, unsigned long cpu_hz);
+static void Print_Rx_Timing(const rx_timing_stats_t* rx_timing);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    static profiler_stats_t stats[kPROFILER_NUM_OF_STAGES];
+    static profiler_stats_t latency[kPROFILER_NUM_OF_STAGES];
+    static rx_timing_stats_t rx_timing[RX_TIMING_NUM_OF_IDS];
+    unsigned long rx_timing_frames = 0;
+    char line[CAN_LOG_LINE_MAX_LENGTH];
+    unsigned long cpu_hz = DEFAULT_CPU_HZ;
+    unsigned long frames = 0;
+    unsigned long invalid = 0;
+
+    if (argc == 3 && strcmp(argv[1], "-c") == 0)
+    {
+        cpu_hz = strtoul(argv[2], NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "uso: %s [-c <frecuencia_cpu_hz>] < candump.log\n", argv[0]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), stdin) != NULL)
+    {
+        can_log_frame_t frame;
+        profiler_stats_t* target;
+
+        if (!CAN_LOG_Parse_Line(line, &frame))
+        {
+            continue;
+        }
+
+        if (frame.id == CAN_ID_CONTROL_DIAG_RECEPCION)
+        {
+            if (RX_TIMING_Decode_Frame(frame.data, frame.dlc, rx_timing))
+            {
+                rx_timing_frames++;
+            }
+            else
+            {
+                invalid++;
+            }
+
+            continue;
+        }
+
+        if (frame.id == CAN_ID_CONTROL_DIAG_PROFILER)
+        {
+            target = stats;
+        }
+        else if (frame.id == CAN_ID_CONTROL_DIAG_LATENCIA)
+        {
+            target = latency;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (PROFILER_Decode_Frame(frame.data, frame.dlc, target))
+        {
+            frames++;
+        }
+        else
+        {
+            invalid++;
+        }
+    }
+
+    printf("Tramas diagnóstico: %lu (inválidas: %lu)\n\n", frames, invalid);
+
+    Print_Table(stats, cpu_hz);
+
+    printf("\nLatencia pedal-inversor [us]: n %lu, min %lu, media %lu, max %lu\n",
+           (unsigned long)latency[0].count, (unsigned long)latency[0].min,
+           latency[0].count ? (unsigned long)(latency[0].sum / latency[0].count) : 0UL, (unsigned long)latency[0].max);
+
+    if (rx_timing_frames != 0)
+    {
+        Print_Rx_Timing(rx_timing);
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Imprime tabla de estadísticas de cada etapa.
+ *
+ * @param stats     Estadísticas de las etapas
+ * @param cpu_hz    Frecuencia de CPU para convertir ciclos a microsegundos
+ * @retval None
+ */
+static void Print_Table(const profiler_stats_t* stats, unsigned long cpu_hz)
+{
+    printf("%-14s %10s %10s %10s %10s %10s\n", "etapa", "n", "min", "media", "max", "max[us]");
+
+    for (uint8_t i = 0; i < kPROFILER_NUM_OF_STAGES; i++)
+    {
+        const profiler_stats_t* st = &stats[i];
+        unsigned long mean = st->count ? (unsigned long)(st->sum / st->count) : 0;
+
+        /* Anidamiento de ISRs: profundidad, no ciclos */
+        if (i == kPROFILER_STAGE_ISR_NESTING)
+        {
+            printf("%-14s %10lu %10lu %10.2f %10lu %10s\n", PROFILER_Stage_Name(i), (unsigned long)st->count,
+                   (unsigned long)st->min, st->count ? (double)st->sum / (double)st->count : 0.0,
+                   (unsigned long)st->max, "-");
+            continue;
+        }
+
+        printf("%-14s %10lu %10lu %10lu %10lu %10.1f\n", PROFILER_Stage_Name(i), (unsigned long)st->count,
+               (unsigned long)st->min, mean, (unsigned long)st->max, (double)st->max * 1e6 / (double)cpu_hz);
+    }
+
+    printf("\nHistograma log2 (ciclos >= 2^k)\n%-14s", "etapa");
+
+    for (uint8_t b = 0; b < PROFILER_HIST_BINS; b++)
+    {
+        printf(" %6d", b + PROFILER_HIST_MIN_LOG2);
+    }
+
+    printf("\n");
+
+    for (uint8_t i = 0; i < kPROFILER_NUM_OF_STAGES; i++)
+    {
+        printf("%-14s", PROFILER_Stage_Name(i));
+
+        for (uint8_t b = 0; b < PROFILER_HIST_BINS; b++)
+        {
+            printf(" %6u", (unsigned)stats[i].hist[b]);
+        }
+
+        printf("\n");
+    }
+}
+
+/**
+ * @brief Imprime tabla de estadísticas de llegada por ID (último valor recibido de cada campo).
+ *
+ * @param rx_timing Estadísticas de las entradas de la tabla
+ * @retval None
+ */
+static void Print_Rx_Timing(const rx_timing_stats_t* rx_timing)
+{
+    printf("\nLlegada por ID [us]\n%-6s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n", "id", "n",
+           "periodo", "min", "max", "jitter", "edad", "secuencia", "perdidas", "desorden", "duplicadas", "perd[%]");
+
+    for (uint8_t i = 0; i < RX_TIMING_NUM_OF_IDS; i++)
+    {
+        const rx_timing_stats_t* st = &rx_timing[i];
+
+        printf("0x%03lX %10lu %10lu %10lu %10lu %10lu %10lu %10lu %10lu %10lu %10lu %10.2f\n",
+               (unsigned long)RX_TIMING_Get_Id(i), (unsigned long)st->count, (unsigned long)st->period_mean_us,
+               (unsigned long)st->period_min_us, (unsigned long)st->period_max_us, (unsigned long)st->jitter_us,
+               (unsigned long)st->age_us, (unsigned long)st->seq_count, (unsigned long)st->seq_lost,
+               (unsigned long)st->seq_reordered, (unsigned long)st->seq_duplicates, st->loss_rate / 100.0);
+    }
+}
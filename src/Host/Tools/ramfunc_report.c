@@ -0,0 +1,242 @@
+/**
+ * @file ramfunc_report.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para reportar costo en SRAM y ahorro de ciclos de las funciones ejecutadas desde SRAM
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Costo en SRAM: lee la tabla de símbolos del ELF de target (salida de arm-none-eabi-nm -S) e imprime las funciones
+ * ubicadas en SRAM (sección .ramfunc) con su tamaño, el total y los veneers que agregó el linker.
+ *
+ * Ahorro de ciclos: lee dos logs de candump o ASC con tramas del profiler (CAN 0x01F), uno de un build con
+ * USE_RAMFUNC_FEATURE=0 y .ramfunc vacía (todo en flash) y otro del build normal, e imprime para cada etapa la media
+ * de ciclos de ambos y la diferencia.
+ *
+ * Uso: arm-none-eabi-nm -S Control.elf | ./build/ramfunc_report [-f <flash.log> -r <sram.log>] [-c <frecuencia_cpu_hz>]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "can_log.h"
+#include "profiler.h"
+#include "can_def.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Frecuencia de CPU por defecto (SYSCLK de Control) */
+#define DEFAULT_CPU_HZ          80000000UL
+
+/** @brief Inicio de SRAM (STM32F446VETX_FLASH.ld) */
+#define SRAM_START              0x20000000UL
+
+/** @brief Fin de SRAM, excluido (128 KB) */
+#define SRAM_END                0x20020000UL
+
+/** @brief Largo máximo de nombre de símbolo */
+#define SYMBOL_MAX_LENGTH       128
+
+/***********************************************************************************************************************
+ * Private functions prototypes
+ **********************************************************************************************************************/
+
+static void Report_Ram_Cost(FILE* file);
+
+static int Load_Profiler_Log(const char* path, profiler_stats_t* stats);
+
+static void Report_Cycles(const profiler_stats_t* flash, const profiler_stats_t* sram, unsigned long cpu_hz);
+
+static unsigned long Stats_Mean(const profiler_stats_t* stats);
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    static profiler_stats_t flash_stats[kPROFILER_NUM_OF_STAGES];
+    static profiler_stats_t sram_stats[kPROFILER_NUM_OF_STAGES];
+    const char* flash_log = NULL;
+    const char* sram_log = NULL;
+    unsigned long cpu_hz = DEFAULT_CPU_HZ;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        {
+            flash_log = argv[++i];
+        }
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+        {
+            sram_log = argv[++i];
+        }
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+        {
+            cpu_hz = strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "uso: %s [-f <flash.log> -r <sram.log>] [-c <frecuencia_cpu_hz>] < nm.txt\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((flash_log == NULL) != (sram_log == NULL))
+    {
+        fprintf(stderr, "-f y -r van juntos\n");
+        return 1;
+    }
+
+    Report_Ram_Cost(stdin);
+
+    if (flash_log != NULL)
+    {
+        if (Load_Profiler_Log(flash_log, flash_stats) != 0 || Load_Profiler_Log(sram_log, sram_stats) != 0)
+        {
+            return 1;
+        }
+
+        Report_Cycles(flash_stats, sram_stats, cpu_hz);
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Private functions implementation
+ **********************************************************************************************************************/
+
+/**
+ * @brief Imprime las funciones ubicadas en SRAM y los veneers agregados por el linker.
+ *
+ * @param file      Salida de nm -S (dirección, tamaño, tipo y nombre por línea)
+ * @retval None
+ */
+static void Report_Ram_Cost(FILE* file)
+{
+    char line[CAN_LOG_LINE_MAX_LENGTH];
+    unsigned long total = 0;
+    unsigned long functions = 0;
+    unsigned long veneers = 0;
+    unsigned long veneer_bytes = 0;
+
+    printf("%-10s %6s  %s\n", "dirección", "bytes", "función en SRAM");
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[SYMBOL_MAX_LENGTH];
+        unsigned long address;
+        unsigned long size;
+        char type;
+
+        /* Los símbolos sin tamaño (etiquetas de ensamblador) no se cuentan */
+        if (sscanf(line, "%lx %lx %c %127s", &address, &size, &type, name) != 4)
+        {
+            continue;
+        }
+
+        if (type != 't' && type != 'T')
+        {
+            continue;
+        }
+
+        if (strstr(name, "_veneer") != NULL)
+        {
+            veneers++;
+            veneer_bytes += size;
+        }
+        else if (address >= SRAM_START && address < SRAM_END)
+        {
+            printf("0x%08lx %6lu  %s\n", address, size, name);
+            functions++;
+            total += size;
+        }
+    }
+
+    printf("\nFunciones en SRAM: %lu, %lu bytes de SRAM (y de flash para la copia inicial)\n", functions, total);
+    printf("Veneers flash <-> SRAM: %lu, %lu bytes\n", veneers, veneer_bytes);
+}
+
+/**
+ * @brief Acumula las estadísticas del profiler de un log.
+ *
+ * @param path      Log candump o ASC
+ * @param stats     Arreglo de kPROFILER_NUM_OF_STAGES estadísticas a actualizar
+ * @retval 0        Log leído
+ * @retval -1       No se pudo abrir el log
+ */
+static int Load_Profiler_Log(const char* path, profiler_stats_t* stats)
+{
+    char line[CAN_LOG_LINE_MAX_LENGTH];
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        can_log_frame_t frame;
+
+        if (CAN_LOG_Parse_Line(line, &frame) && frame.id == CAN_ID_CONTROL_DIAG_PROFILER)
+        {
+            (void)PROFILER_Decode_Frame(frame.data, frame.dlc, stats);
+        }
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+/**
+ * @brief Imprime media de ciclos de cada etapa en flash y en SRAM y el ahorro.
+ *
+ * @param flash     Estadísticas del build con todo en flash
+ * @param sram      Estadísticas del build con .ramfunc
+ * @param cpu_hz    Frecuencia de CPU para convertir ciclos a microsegundos
+ * @retval None
+ */
+static void Report_Cycles(const profiler_stats_t* flash, const profiler_stats_t* sram, unsigned long cpu_hz)
+{
+    printf("\n%-14s %10s %10s %10s %8s %10s\n", "etapa", "flash", "sram", "ahorro", "%", "ahorro[us]");
+
+    for (uint8_t i = 0; i < kPROFILER_NUM_OF_STAGES; i++)
+    {
+        unsigned long mean_flash = Stats_Mean(&flash[i]);
+        unsigned long mean_sram = Stats_Mean(&sram[i]);
+        long saved = (long)mean_flash - (long)mean_sram;
+
+        if (flash[i].count == 0 || sram[i].count == 0)
+        {
+            printf("%-14s %10s %10s %10s %8s %10s\n", PROFILER_Stage_Name(i), "-", "-", "-", "-", "-");
+            continue;
+        }
+
+        printf("%-14s %10lu %10lu %10ld %7.1f%% %10.2f\n", PROFILER_Stage_Name(i), mean_flash, mean_sram, saved,
+               mean_flash ? 100.0 * (double)saved / (double)mean_flash : 0.0, (double)saved * 1e6 / (double)cpu_hz);
+    }
+}
+
+/**
+ * @brief Media de ciclos de una etapa.
+ *
+ * @param stats     Estadísticas de la etapa
+ * @return unsigned long Media (0 si no hay mediciones)
+ */
+static unsigned long Stats_Mean(const profiler_stats_t* stats)
+{
+    return stats->count ? (unsigned long)(stats->sum / stats->count) : 0UL;
+}
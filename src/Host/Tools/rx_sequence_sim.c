@@ -0,0 +1,225 @@
+/**
+ * @file rx_sequence_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para validar la detección de pérdidas por contador de secuencia de rx_timing.c
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Genera para varios IDs de la tabla un flujo de tramas con contador de secuencia de 8 bits y le inyecta, con
+ * probabilidad distinta por ID, descartes, pares de tramas intercambiadas y duplicados; a un ID además le
+ * reinicia el contador a mitad de la prueba (reinicio del módulo). Entrega el flujo a RX_TIMING_Record_Sequence y
+ * compara perdidas, fuera de orden, duplicadas y tasa de pérdida con lo inyectado, también después de pasar las
+ * estadísticas por las tramas de volcado (RX_TIMING_Encode_Frame / RX_TIMING_Decode_Frame).
+ *
+ * Uso: ./build/rx_sequence_sim [semilla [tramas_por_id]]
+ *
+ * Retorna 1 si algún valor difiere de lo inyectado.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "rx_timing.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief IDs probados (primeras entradas de la tabla) */
+#define SIM_NUM_OF_IDS          6U
+
+/** @brief Entrada cuyo módulo se reinicia a mitad de la prueba */
+#define SIM_RESET_INDEX         5U
+
+/** @brief Contador en el que se reinicia el módulo (lejos de la ventana de desorden y de un salto válido) */
+#define SIM_RESET_AT_SEQUENCE   100U
+
+/** @brief Tramas sin perturbaciones antes y después del reinicio */
+#define SIM_RESET_QUIET         4U
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Perturbaciones de un ID (probabilidades en %) y lo inyectado */
+typedef struct
+{
+    double      drop_pct;               /**< Probabilidad de descarte */
+    double      swap_pct;               /**< Probabilidad de intercambiar una trama con la siguiente */
+    double      dup_pct;                /**< Probabilidad de duplicar una trama entregada en orden */
+    uint32_t    dropped;                /**< Tramas descartadas */
+    uint32_t    swapped;                /**< Pares intercambiados */
+    uint32_t    duplicated;             /**< Tramas duplicadas */
+    uint32_t    delivered;              /**< Tramas distintas entregadas */
+
+} sim_stream_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Perturbaciones por ID */
+static sim_stream_t streams[SIM_NUM_OF_IDS] = {
+    {0.0, 0.0, 0.0, 0, 0, 0, 0},
+    {1.0, 0.0, 0.0, 0, 0, 0, 0},
+    {5.0, 0.0, 0.0, 0, 0, 0, 0},
+    {20.0, 0.0, 0.0, 0, 0, 0, 0},
+    {2.0, 3.0, 1.0, 0, 0, 0, 0},
+    {10.0, 5.0, 5.0, 0, 0, 0, 0},
+};
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+/**
+ * @brief Sorteo con probabilidad en %.
+ *
+ * @return int 1 si ocurre
+ */
+static int Chance(double pct)
+{
+    return ((double)rand() / ((double)RAND_MAX + 1.0)) * 100.0 < pct;
+}
+
+/**
+ * @brief Compara un valor medido con el inyectado.
+ *
+ * @return int 1 si difiere
+ */
+static int Check(uint32_t id, const char* name, uint32_t measured, uint32_t expected)
+{
+    if (measured != expected)
+    {
+        fprintf(stderr, "0x%03lX: %s %lu, esperado %lu\n", (unsigned long)id, name, (unsigned long)measured,
+                (unsigned long)expected);
+        return 1;
+    }
+
+    return 0;
+}
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    unsigned seed = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 0) : 1;
+    unsigned long frames = (argc > 2) ? strtoul(argv[2], NULL, 0) : 20000;
+    static rx_timing_stats_t decoded[RX_TIMING_NUM_OF_IDS];
+    rx_timing_stats_t stats;
+    uint8_t payload[RX_TIMING_FRAME_LENGTH];
+    int errors = 0;
+
+    srand(seed);
+
+    RX_TIMING_Init();
+
+    for (uint8_t i = 0; i < SIM_NUM_OF_IDS; i++)
+    {
+        sim_stream_t* stream = &streams[i];
+        uint32_t id = RX_TIMING_Get_Id(i);
+        uint32_t reset_n = UINT32_MAX;
+
+        if (i == SIM_RESET_INDEX)
+        {
+            /* Primera trama desde la mitad cuyo contador es SIM_RESET_AT_SEQUENCE */
+            reset_n = (uint32_t)(frames / 2U);
+            reset_n += (uint8_t)(SIM_RESET_AT_SEQUENCE - reset_n);
+        }
+
+        for (uint32_t n = 0; n < frames; n++)
+        {
+            /* Tras el reinicio el contador vuelve a 0 */
+            uint8_t sequence = (uint8_t)((n < reset_n) ? n : n - reset_n);
+
+            /* Sin perturbaciones alrededor del reinicio: una pérdida ahí no se distingue del reinicio */
+            bool quiet = (n + SIM_RESET_QUIET >= reset_n) && (n < reset_n + SIM_RESET_QUIET);
+
+            /* La primera y la última trama siempre llegan: un descarte solo se ve entre dos tramas recibidas */
+            if (!quiet && n != 0U && n + 1U < frames && Chance(stream->drop_pct))
+            {
+                stream->dropped++;
+                continue;
+            }
+
+            /* Par intercambiado: la siguiente trama llega antes que esta */
+            if (!quiet && n + 1U < frames && Chance(stream->swap_pct))
+            {
+                RX_TIMING_Record_Sequence(id, (uint8_t)(sequence + 1U));
+                RX_TIMING_Record_Sequence(id, sequence);
+                stream->swapped++;
+                stream->delivered += 2U;
+                n++;
+                continue;
+            }
+
+            RX_TIMING_Record_Sequence(id, sequence);
+            stream->delivered++;
+
+            if (!quiet && Chance(stream->dup_pct))
+            {
+                RX_TIMING_Record_Sequence(id, sequence);
+                stream->duplicated++;
+            }
+        }
+    }
+
+    printf("%-6s %8s %10s %10s %10s %10s %10s %10s %9s %9s\n", "id", "tramas", "descartes", "perdidas",
+           "intercamb", "desorden", "duplicad", "dup_med", "ref[%]", "med[%]");
+
+    for (uint8_t i = 0; i < SIM_NUM_OF_IDS; i++)
+    {
+        const sim_stream_t* stream = &streams[i];
+        uint32_t total = stream->delivered + stream->dropped;
+        double reference = total ? 10000.0 * stream->dropped / total : 0.0;
+
+        RX_TIMING_Get_Stats(i, 0, &stats);
+
+        printf("0x%03lX %8lu %10lu %10lu %10lu %10lu %10lu %10lu %9.2f %9.2f\n", (unsigned long)stats.id,
+               (unsigned long)total, (unsigned long)stream->dropped, (unsigned long)stats.seq_lost,
+               (unsigned long)stream->swapped, (unsigned long)stats.seq_reordered,
+               (unsigned long)stream->duplicated, (unsigned long)stats.seq_duplicates, reference / 100.0,
+               stats.loss_rate / 100.0);
+
+        errors |= Check(stats.id, "perdidas", stats.seq_lost, stream->dropped);
+        errors |= Check(stats.id, "fuera de orden", stats.seq_reordered, stream->swapped);
+        errors |= Check(stats.id, "duplicadas", stats.seq_duplicates, stream->duplicated);
+        errors |= Check(stats.id, "con contador", stats.seq_count, stream->delivered + stream->duplicated);
+
+        if (fabs((double)stats.loss_rate - reference) > 0.5)
+        {
+            fprintf(stderr, "0x%03lX: tasa de pérdida %u, referencia %.2f\n", (unsigned long)stats.id,
+                    stats.loss_rate, reference);
+            errors = 1;
+        }
+
+        /* Mismos valores del lado del decodificador de volcado */
+        for (uint8_t record = 0; record < RX_TIMING_RECORDS_PER_ID; record++)
+        {
+            RX_TIMING_Decode_Frame(payload, RX_TIMING_Encode_Frame(&stats, record, payload), decoded);
+        }
+
+        errors |= Check(stats.id, "perdidas (volcado)", decoded[i].seq_lost, stats.seq_lost);
+        errors |= Check(stats.id, "fuera de orden (volcado)", decoded[i].seq_reordered, stats.seq_reordered);
+        errors |= Check(stats.id, "duplicadas (volcado)", decoded[i].seq_duplicates, stats.seq_duplicates);
+        errors |= Check(stats.id, "tasa de pérdida (volcado)", decoded[i].loss_rate, stats.loss_rate);
+    }
+
+    if (errors)
+    {
+        fprintf(stderr, "estadísticas de secuencia distintas de lo inyectado\n");
+        return 1;
+    }
+
+    return 0;
+}
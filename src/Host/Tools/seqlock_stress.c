@@ -0,0 +1,274 @@
+/**
+ * @file seqlock_stress.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Prueba de host con hilos del bus de recepción CAN compartido (seqlock de buses.c)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Un hilo escritor hace el papel de la ISR de recepción CAN: entre BUSES_Input_Write_Begin y
+ * BUSES_Input_Write_End escribe todos los campos del bus con el mismo número de versión. Un hilo lector
+ * hace el papel del superloop y toma copias con BUSES_Input_Snapshot; una copia es consistente si todos
+ * sus campos tienen la misma versión y las versiones no retroceden. Como control, la misma prueba se
+ * repite con un lector que copia sin seqlock, para mostrar que el escritor sí produce copias rotas.
+ *
+ * Al final se mide el costo de BUSES_Input_Snapshot sin escritor (copia sin reintentos) y con escritor.
+ *
+ * Uso: ./build/seqlock_stress [segundos]
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "buses.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Segundos por fase con escritor por defecto */
+#define STRESS_SECONDS          2U
+
+/** @brief Copias por medición de costo sin escritor */
+#define STRESS_COST_ITERATIONS  10000000UL
+
+/***********************************************************************************************************************
+ * Private typedefs
+ **********************************************************************************************************************/
+
+/** @brief Resultado de una fase con escritor */
+typedef struct
+{
+	unsigned long snapshots;	/**< Copias tomadas por el lector */
+	unsigned long torn;			/**< Copias con campos de versiones distintas */
+	unsigned long backwards;	/**< Copias con versión menor que la anterior */
+	unsigned long writes;		/**< Escrituras completas del escritor */
+	double ns_per_snapshot;		/**< Costo medio de una copia con escritor */
+} stress_result_t;
+
+/***********************************************************************************************************************
+ * Private variables
+ **********************************************************************************************************************/
+
+static typedef_bus3_shared_t bus_shared;
+static atomic_bool stop;
+static unsigned long writes;
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+static uint64_t Stress_Now_Ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Escritor: cada escritura pone la misma versión en todos los campos, campo por campo.
+ */
+static void* Stress_Writer(void* arg)
+{
+	volatile uint8_t* bytes = (volatile uint8_t*)&bus_shared.data;
+	uint32_t version = 0;
+
+	(void)arg;
+
+	while (!atomic_load_explicit(&stop, memory_order_relaxed))
+	{
+		version++;
+
+		BUSES_Input_Write_Begin(&bus_shared);
+
+		for (size_t i = 0; i < offsetof(typedef_bus3_t, pedal_timestamp); i++)
+		{
+			bytes[i] = (uint8_t)version;
+		}
+		*(volatile uint32_t*)&bus_shared.data.pedal_timestamp = version;
+
+		BUSES_Input_Write_End(&bus_shared);
+	}
+
+	writes = version;
+
+	return NULL;
+}
+
+/**
+ * @brief Versión de una copia, o -1 si sus campos no coinciden.
+ */
+static int64_t Stress_Version(const typedef_bus3_t* snapshot)
+{
+	const uint8_t* bytes = (const uint8_t*)snapshot;
+
+	for (size_t i = 0; i < offsetof(typedef_bus3_t, pedal_timestamp); i++)
+	{
+		if (bytes[i] != (uint8_t)snapshot->pedal_timestamp)
+		{
+			return -1;
+		}
+	}
+
+	return (int64_t)snapshot->pedal_timestamp;
+}
+
+/**
+ * @brief Copia sin seqlock, solo como control de que la prueba detecta copias rotas.
+ */
+static void Stress_Unprotected_Copy(const typedef_bus3_shared_t* shared, typedef_bus3_t* snapshot)
+{
+	const volatile uint8_t* src = (const volatile uint8_t*)&shared->data;
+	uint8_t* dst = (uint8_t*)snapshot;
+
+	for (size_t i = 0; i < sizeof(typedef_bus3_t); i++)
+	{
+		dst[i] = src[i];
+	}
+}
+
+static stress_result_t Stress_Run(unsigned seconds, bool protected_copy)
+{
+	stress_result_t result = {0};
+	typedef_bus3_t snapshot;
+	pthread_t writer;
+	int64_t last = 0;
+	uint64_t start;
+	uint64_t end;
+
+	memset(&bus_shared, 0, sizeof(bus_shared));
+	atomic_store(&stop, false);
+
+	if (pthread_create(&writer, NULL, Stress_Writer, NULL) != 0)
+	{
+		perror("pthread_create");
+		exit(EXIT_FAILURE);
+	}
+
+	start = Stress_Now_Ns();
+	end = start + (uint64_t)seconds * 1000000000ULL;
+
+	do
+	{
+		for (unsigned i = 0; i < 1024U; i++)
+		{
+			int64_t version;
+
+			if (protected_copy)
+			{
+				BUSES_Input_Snapshot(&bus_shared, &snapshot);
+			}
+			else
+			{
+				Stress_Unprotected_Copy(&bus_shared, &snapshot);
+			}
+
+			version = Stress_Version(&snapshot);
+
+			if (version < 0)
+			{
+				result.torn++;
+			}
+			else
+			{
+				if (version < last)
+				{
+					result.backwards++;
+				}
+				last = version;
+			}
+		}
+
+		result.snapshots += 1024U;
+
+	} while (Stress_Now_Ns() < end);
+
+	result.ns_per_snapshot = (double)(Stress_Now_Ns() - start) / (double)result.snapshots;
+
+	atomic_store(&stop, true);
+	pthread_join(writer, NULL);
+
+	result.writes = writes;
+
+	return result;
+}
+
+/**
+ * @brief Costo de BUSES_Input_Snapshot sin escritor: una copia de typedef_bus3_t sin reintentos.
+ */
+static double Stress_Cost_Uncontended(void)
+{
+	typedef_bus3_t snapshot;
+	uint64_t start;
+	volatile uint32_t sink = 0;
+
+	memset(&bus_shared, 0, sizeof(bus_shared));
+
+	start = Stress_Now_Ns();
+
+	for (unsigned long i = 0; i < STRESS_COST_ITERATIONS; i++)
+	{
+		BUSES_Input_Snapshot(&bus_shared, &snapshot);
+		sink += snapshot.pedal_timestamp;
+	}
+
+	(void)sink;
+
+	return (double)(Stress_Now_Ns() - start) / (double)STRESS_COST_ITERATIONS;
+}
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+	unsigned seconds = (argc > 1) ? (unsigned)strtoul(argv[1], NULL, 0) : STRESS_SECONDS;
+	stress_result_t locked;
+	stress_result_t unlocked;
+	double cost;
+
+	if (seconds == 0U)
+	{
+		fprintf(stderr, "segundos debe ser mayor que 0\n");
+		return EXIT_FAILURE;
+	}
+
+	cost = Stress_Cost_Uncontended();
+	locked = Stress_Run(seconds, true);
+	unlocked = Stress_Run(seconds, false);
+
+	printf("Bus 3 compartido: %zu bytes de datos\n", sizeof(typedef_bus3_t));
+	printf("Costo de BUSES_Input_Snapshot sin escritor: %.1f ns por copia\n", cost);
+	printf("Con seqlock:  %lu copias, %lu escrituras, %lu rotas, %lu hacia atrás, %.1f ns por copia\n",
+	       locked.snapshots, locked.writes, locked.torn, locked.backwards, locked.ns_per_snapshot);
+	printf("Sin seqlock:  %lu copias, %lu escrituras, %lu rotas (control)\n",
+	       unlocked.snapshots, unlocked.writes, unlocked.torn);
+
+	if (locked.torn != 0U || locked.backwards != 0U)
+	{
+		fprintf(stderr, "FALLA: BUSES_Input_Snapshot entregó copias inconsistentes\n");
+		return EXIT_FAILURE;
+	}
+
+	if (unlocked.torn == 0U)
+	{
+		printf("Aviso: el control sin seqlock no produjo copias rotas, la prueba no ejerció la concurrencia\n");
+	}
+
+	return EXIT_SUCCESS;
+}
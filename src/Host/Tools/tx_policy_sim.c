@@ -0,0 +1,654 @@
+/**
+ * @file tx_policy_sim.c
+ * @author Subgrupo Control y Periféricos - Elektron Motorsports
+ * @brief Herramienta de host para comparar la transmisión por cambio (tx_policy.c) con la rotación por TIM7
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * Reproduce una vuelta (valores de estado_manejo, estado_falla, nivel_velocidad y hombre_muerto en el tiempo) con
+ * pasadas principales cada 500 us, desfasadas de las muestras, y la transmite con dos esquemas:
+ *   actual    Rotación de CAN_APP_Send_BusData con el trigger de TIM7 cada 100 ms (un ID por trigger, ciclo de
+ *             siete triggers) y nivel de velocidad por evento (CAN_APP_Send_Velocidad: cada muestra de pedal con
+ *             CAN_APP_VELOCIDAD_MIN_GAP_US de separación, reenvío cada CAN_APP_VELOCIDAD_KEEPALIVE_US)
+ *   política  CAN_APP_Send_Changes: TX_POLICY_Is_Due por señal en cada pasada, con las políticas de
+ *             app_config_default (o las de -p) y los primeros reenvíos escalonados cada CAN_APP_TX_PHASE_US
+ * En ambos, hombre muerto presionado saca además nivel de velocidad y hombre muerto en el instante por el camino
+ * rápido. Los mailboxes siempre aceptan la trama.
+ *
+ * Reporta por señal y esquema tramas, tramas/s, cambios, cambios reemplazados por otro antes de salir y latencia
+ * cambio-bus (desde el cambio hasta el fin de la primera trama de la señal que lo lleva, con el largo de peor caso
+ * de BUS_LOAD_Frame_Bits), y en total tramas/s y carga de bus.
+ *
+ * Vuelta: CSV de -l con líneas "t_ms,estado_manejo,estado_falla,nivel_velocidad,hombre_muerto" en orden de
+ * tiempo (cada línea es la salida de Control tras una muestra de pedal; líneas que no empiezan con un número se
+ * ignoran), o una vuelta sintética de -s segundos: pedal cada 10 ms con ruido de sensor sobre las rampas de
+ * app_config_default, cambios de modo de manejo, un período en CAUTION1 y una frenada con hombre muerto.
+ *
+ * Uso: ./build/tx_policy_sim [-l <vuelta.csv>] [-s <segundos>] [-b <bitrate>] [-x <semilla>]
+ *                            [-p <señal>,<banda>,<min_us>,<max_us>]...
+ *      <señal>: manejo, falla, nivel o hm
+ *
+ * Retorna 1 si la vuelta no se puede leer o si el esquema por política envía por cambio antes de su intervalo
+ * mínimo o deja pasar más que su intervalo máximo (más una pasada) sin enviar.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/***********************************************************************************************************************
+ * Included files
+ **********************************************************************************************************************/
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Application includes */
+#include "app_context.h"
+#include "bus_load.h"
+#include "can_app.h"
+#include "can_def.h"
+#include "timebase.h"
+#include "tx_policy.h"
+
+/***********************************************************************************************************************
+ * Private macros
+ **********************************************************************************************************************/
+
+/** @brief Período de la pasada principal simulada en us */
+#define SIM_PASS_US             500U
+
+/** @brief Desfase de las pasadas respecto de las muestras de la vuelta en us (llegan entre dos pasadas) */
+#define SIM_PASS_PHASE_US       250U
+
+/** @brief Período del trigger de transmisión (TIM7) en us */
+#define SIM_TIM7_US             100000U
+
+/** @brief Triggers por ciclo de la rotación (seis índices y el que la reinicia) */
+#define SIM_ROTATION_SLOTS      7U
+
+/** @brief Período de las muestras de pedal de la vuelta sintética en ms */
+#define SIM_PEDAL_MS            10U
+
+/** @brief Tiempo entre objetivos de pedal de la vuelta sintética en ms */
+#define SIM_PEDAL_TARGET_MS     2000U
+
+/** @brief Cambio máximo de pedal por muestra en la vuelta sintética */
+#define SIM_PEDAL_SLEW          3
+
+/** @brief Largo de las tramas de Control (con contador de secuencia) */
+#if USE_CAN_TX_SEQUENCE_FEATURE == 1
+#define SIM_FRAME_DLC           CAN_SEQUENCE_LENGTH
+#else
+#define SIM_FRAME_DLC           1U
+#endif /* USE_CAN_TX_SEQUENCE_FEATURE */
+
+/** @brief Máximo de líneas de la vuelta */
+#define SIM_MAX_SAMPLES         1000000U
+
+/***********************************************************************************************************************
+ * Private types declarations
+ **********************************************************************************************************************/
+
+/** @brief Salida de Control en un instante de la vuelta */
+typedef struct
+{
+    uint32_t    t_ms;                               /**< Instante */
+    uint8_t     value[kCAN_TX_NUM_OF_SIGNALS];      /**< Valor por señal (orden de can_tx_signal_t) */
+
+} sim_sample_t;
+
+/** @brief Tramas y latencias de una señal en un esquema */
+typedef struct
+{
+    uint32_t    frames;                 /**< Tramas */
+    uint32_t    changes;                /**< Cambios de valor */
+    uint32_t    replaced;               /**< Cambios reemplazados por otro antes de salir */
+    uint32_t    delivered;              /**< Cambios entregados */
+    uint64_t    latency_sum_us;         /**< Suma de latencias cambio-bus */
+    uint32_t    latency_max_us;         /**< Latencia cambio-bus máxima */
+    bool        pending;                /**< Hay un cambio sin trama */
+    uint32_t    pending_us;             /**< Instante del cambio sin trama */
+
+} sim_signal_stats_t;
+
+/** @brief Esquema de transmisión */
+typedef struct
+{
+    const char*         name;                                   /**< Nombre */
+    sim_signal_stats_t  signal[kCAN_TX_NUM_OF_SIGNALS];         /**< Por señal */
+
+} sim_scheme_t;
+
+/***********************************************************************************************************************
+ * Private variables definitions
+ **********************************************************************************************************************/
+
+/** @brief Nombres de las señales en el orden de can_tx_signal_t (también para -p) */
+static const char* const signal_names[kCAN_TX_NUM_OF_SIGNALS] = {"manejo", "falla", "nivel", "hm"};
+
+/** @brief Señal enviada por cada trigger de la rotación (kCAN_TX_NUM_OF_SIGNALS: ninguna) */
+static const uint8_t rotation[SIM_ROTATION_SLOTS] = {
+    kCAN_TX_NUM_OF_SIGNALS, kCAN_TX_ESTADO_MANEJO, kCAN_TX_ESTADO_FALLA, kCAN_TX_NUM_OF_SIGNALS,
+    kCAN_TX_HOMBRE_MUERTO, kCAN_TX_NUM_OF_SIGNALS, kCAN_TX_NUM_OF_SIGNALS,
+};
+
+/** @brief Vuelta */
+static sim_sample_t* samples;
+static uint32_t num_of_samples;
+
+/** @brief Tiempo de una trama en el bus en us */
+static uint32_t frame_us;
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+/**
+ * @brief Nivel de velocidad de un pedal, como RAMPA_PEDAL_Get_Rampa.
+ *
+ * @return uint8_t
+ */
+static uint8_t Lap_Nivel(const rampa_pedal_map_t* map, int pedal)
+{
+    float velocidad = 0.0f;
+
+    if (pedal >= 0 && pedal < RAMPA_PEDAL_NUM_OF_SEGMENTS * RAMPA_PEDAL_SEGMENT_WIDTH)
+    {
+        const rampa_pedal_segment_t* segment = &map->segment[pedal / RAMPA_PEDAL_SEGMENT_WIDTH];
+
+        velocidad = segment->slope * (float)pedal + segment->offset;
+    }
+
+    return (uint8_t)round(velocidad);
+}
+
+/**
+ * @brief Arma la vuelta sintética.
+ *
+ * Modo NORMAL, SPORT desde el 25 % de la vuelta y ECO desde el 75 %; CAUTION1 entre el 45 y el 50 %; hombre muerto
+ * presionado entre el 85 y el 87 %. El pedal sigue un objetivo nuevo cada SIM_PEDAL_TARGET_MS (cero uno de cada
+ * cuatro) a SIM_PEDAL_SLEW por muestra, con ruido de sensor de ±1.
+ *
+ * @return int 1 sin memoria
+ */
+static int Lap_Synthetic(uint32_t seconds)
+{
+    uint32_t duration_ms = seconds * 1000U;
+    int pedal = 0;
+    int target = 0;
+
+    num_of_samples = duration_ms / SIM_PEDAL_MS;
+    samples = calloc(num_of_samples, sizeof(*samples));
+
+    if (samples == NULL)
+    {
+        return 1;
+    }
+
+    for (uint32_t n = 0; n < num_of_samples; n++)
+    {
+        sim_sample_t* sample = &samples[n];
+        uint32_t t_ms = n * SIM_PEDAL_MS;
+        uint32_t permille = (uint32_t)((uint64_t)t_ms * 1000U / duration_ms);
+        const rampa_pedal_map_t* map = &app_config_default.pedal_normal;
+        int reading;
+
+        sample->t_ms = t_ms;
+        sample->value[kCAN_TX_ESTADO_MANEJO] = CAN_VALUE_DRIVING_MODE_NORMAL;
+        sample->value[kCAN_TX_ESTADO_FALLA] = CAN_VALUE_FAILURE_OK;
+        sample->value[kCAN_TX_HOMBRE_MUERTO] = CAN_VALUE_HOMBRE_MUERTO_OFF;
+
+        if (permille >= 750U)
+        {
+            sample->value[kCAN_TX_ESTADO_MANEJO] = CAN_VALUE_DRIVING_MODE_ECO;
+            map = &app_config_default.pedal_eco;
+        }
+        else if (permille >= 250U)
+        {
+            sample->value[kCAN_TX_ESTADO_MANEJO] = CAN_VALUE_DRIVING_MODE_SPORT;
+            map = &app_config_default.pedal_sport;
+        }
+
+        if (permille >= 450U && permille < 500U)
+        {
+            sample->value[kCAN_TX_ESTADO_FALLA] = CAN_VALUE_FAILURE_CAUTION1;
+        }
+
+        if (t_ms % SIM_PEDAL_TARGET_MS == 0)
+        {
+            target = (rand() % 4 == 0) ? 0 : rand() % 100;
+        }
+
+        pedal += (target > pedal) ? ((target - pedal > SIM_PEDAL_SLEW) ? SIM_PEDAL_SLEW : target - pedal)
+                                  : ((pedal - target > SIM_PEDAL_SLEW) ? -SIM_PEDAL_SLEW : target - pedal);
+
+        reading = pedal + rand() % 3 - 1;
+        reading = (reading < 0) ? 0 : (reading > 99) ? 99 : reading;
+
+        sample->value[kCAN_TX_NIVEL_VELOCIDAD] = Lap_Nivel(map, reading);
+
+        if (permille >= 850U && permille < 870U)
+        {
+            sample->value[kCAN_TX_HOMBRE_MUERTO] = CAN_VALUE_HOMBRE_MUERTO_ON;
+            sample->value[kCAN_TX_NIVEL_VELOCIDAD] = 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Lee la vuelta de un CSV.
+ *
+ * @return int 1 si no se puede abrir, una línea es inválida, el tiempo retrocede o no hay líneas
+ */
+static int Lap_Load(const char* name)
+{
+    FILE* file = fopen(name, "r");
+    char line[256];
+    unsigned line_number = 0;
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "no se pudo abrir %s\n", name);
+        return 1;
+    }
+
+    samples = calloc(SIM_MAX_SAMPLES, sizeof(*samples));
+
+    if (samples == NULL)
+    {
+        fclose(file);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL && num_of_samples < SIM_MAX_SAMPLES)
+    {
+        sim_sample_t* sample = &samples[num_of_samples];
+        unsigned long t_ms;
+        unsigned value[kCAN_TX_NUM_OF_SIGNALS];
+
+        line_number++;
+
+        if (!isdigit((unsigned char)line[0]))
+        {
+            continue;
+        }
+
+        if (sscanf(line, "%lu,%u,%u,%u,%u", &t_ms, &value[0], &value[1], &value[2], &value[3]) != 5 ||
+            value[0] > 255U || value[1] > 255U || value[2] > 255U || value[3] > 255U ||
+            (num_of_samples > 0 && t_ms < samples[num_of_samples - 1U].t_ms))
+        {
+            fprintf(stderr, "%s:%u: línea inválida\n", name, line_number);
+            fclose(file);
+            return 1;
+        }
+
+        sample->t_ms = (uint32_t)t_ms;
+
+        for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+        {
+            sample->value[i] = (uint8_t)value[i];
+        }
+
+        num_of_samples++;
+    }
+
+    fclose(file);
+
+    if (num_of_samples == 0)
+    {
+        fprintf(stderr, "%s: sin líneas\n", name);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Registra un cambio de valor de una señal.
+ *
+ * @return None
+ */
+static void Stats_Change(sim_signal_stats_t* stats, uint32_t now_us)
+{
+    stats->changes++;
+
+    if (stats->pending)
+    {
+        stats->replaced++;
+    }
+
+    stats->pending = true;
+    stats->pending_us = now_us;
+}
+
+/**
+ * @brief Registra una trama de una señal (lleva el valor actual, que entrega el cambio pendiente).
+ *
+ * @return None
+ */
+static void Stats_Frame(sim_signal_stats_t* stats, uint32_t now_us)
+{
+    stats->frames++;
+
+    if (stats->pending)
+    {
+        uint32_t latency_us = now_us - stats->pending_us + frame_us;
+
+        stats->delivered++;
+        stats->latency_sum_us += latency_us;
+        stats->latency_max_us = (latency_us > stats->latency_max_us) ? latency_us : stats->latency_max_us;
+        stats->pending = false;
+    }
+}
+
+/**
+ * @brief Verifica el intervalo entre dos envíos de la política.
+ *
+ * @return int 1 si viola el intervalo mínimo (envío por cambio) o el máximo
+ */
+static int Check_Interval(uint8_t i, const tx_policy_config_t* config, uint32_t gap_us, bool refresh)
+{
+    if (!refresh && gap_us < config->min_interval_us)
+    {
+        fprintf(stderr, "%s: envío por cambio %lu us después del anterior (mínimo %lu us)\n", signal_names[i],
+                (unsigned long)gap_us, (unsigned long)config->min_interval_us);
+        return 1;
+    }
+
+    if (config->max_interval_us != 0U && gap_us > config->max_interval_us + SIM_PASS_US)
+    {
+        fprintf(stderr, "%s: %lu us sin envíos (máximo %lu us)\n", signal_names[i], (unsigned long)gap_us,
+                (unsigned long)config->max_interval_us);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Transmite la vuelta con los dos esquemas.
+ *
+ * @param policy    Política por señal
+ * @param current   Esquema actual
+ * @param changes   Esquema por política
+ * @return int 1 si la política viola sus intervalos
+ */
+static int Simulate(const tx_policy_config_t* policy, sim_scheme_t* current, sim_scheme_t* changes)
+{
+    uint32_t end_us = samples[num_of_samples - 1U].t_ms * 1000U + SIM_PASS_US;
+    uint8_t value[kCAN_TX_NUM_OF_SIGNALS];
+    tx_policy_state_t state[kCAN_TX_NUM_OF_SIGNALS];
+    uint32_t policy_last_us[kCAN_TX_NUM_OF_SIGNALS];
+    uint32_t next_sample = 0;
+    uint32_t next_tim7_us = SIM_TIM7_US;
+    uint32_t rotation_index = 0;
+    uint32_t velocidad_last_us = 0;
+    bool velocidad_pending = false;
+    int violations = 0;
+
+    /* Valores de partida ya en el bus en ambos esquemas */
+    memcpy(value, samples[0].value, sizeof(value));
+
+    for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+    {
+        TX_POLICY_Start(&policy[i], &state[i], value[i], 0, (uint32_t)(i + 1U) * CAN_APP_TX_PHASE_US);
+        policy_last_us[i] = state[i].last_us;
+    }
+
+    for (uint32_t now = SIM_PASS_PHASE_US; now <= end_us; now += SIM_PASS_US)
+    {
+        /* Muestras de pedal llegadas desde la pasada anterior */
+        while (next_sample < num_of_samples && samples[next_sample].t_ms * 1000U <= now)
+        {
+            const sim_sample_t* sample = &samples[next_sample++];
+            uint32_t sample_us = sample->t_ms * 1000U;
+            bool fast_path = false;
+
+            for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+            {
+                if (sample->value[i] == value[i])
+                {
+                    continue;
+                }
+
+                value[i] = sample->value[i];
+
+                Stats_Change(&current->signal[i], sample_us);
+                Stats_Change(&changes->signal[i], sample_us);
+
+                /* Camino rápido de hombre muerto: nivel de velocidad y hombre muerto desde la ISR de recepción */
+                if (i == kCAN_TX_HOMBRE_MUERTO && value[i] == CAN_VALUE_HOMBRE_MUERTO_ON)
+                {
+                    fast_path = true;
+                }
+            }
+
+            if (fast_path)
+            {
+                Stats_Frame(&current->signal[kCAN_TX_NIVEL_VELOCIDAD], sample_us);
+                Stats_Frame(&changes->signal[kCAN_TX_NIVEL_VELOCIDAD], sample_us);
+                Stats_Frame(&current->signal[kCAN_TX_HOMBRE_MUERTO], sample_us);
+                Stats_Frame(&changes->signal[kCAN_TX_HOMBRE_MUERTO], sample_us);
+            }
+
+            velocidad_pending = true;
+        }
+
+        /* Actual: rotación por trigger de TIM7 */
+        if (now >= next_tim7_us)
+        {
+            uint8_t i = rotation[rotation_index];
+
+            if (i != kCAN_TX_NUM_OF_SIGNALS)
+            {
+                Stats_Frame(&current->signal[i], now);
+            }
+
+            rotation_index = (rotation_index + 1U) % SIM_ROTATION_SLOTS;
+            next_tim7_us += SIM_TIM7_US;
+        }
+
+        /* Actual: nivel de velocidad por evento */
+        if (TIMEBASE_IS_EXPIRED(velocidad_last_us, now, velocidad_pending ? CAN_APP_VELOCIDAD_MIN_GAP_US
+                                                                          : CAN_APP_VELOCIDAD_KEEPALIVE_US))
+        {
+            Stats_Frame(&current->signal[kCAN_TX_NIVEL_VELOCIDAD], now);
+
+            velocidad_pending = false;
+            velocidad_last_us = now;
+        }
+
+        /* Política */
+        for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+        {
+            bool refresh;
+
+            if (!TX_POLICY_Is_Due(&policy[i], &state[i], value[i], now))
+            {
+                continue;
+            }
+
+            refresh = (policy[i].max_interval_us != 0U) &&
+                      TIMEBASE_IS_EXPIRED(state[i].last_us, now, policy[i].max_interval_us);
+
+            violations |= Check_Interval(i, &policy[i], now - policy_last_us[i], refresh);
+
+            Stats_Frame(&changes->signal[i], now);
+
+            TX_POLICY_Sent(&state[i], value[i], now);
+            policy_last_us[i] = now;
+        }
+    }
+
+    return violations;
+}
+
+/**
+ * @brief Imprime una señal (o el total) de un esquema.
+ *
+ * @return None
+ */
+static void Print_Row(const char* signal, const char* scheme, const sim_signal_stats_t* stats, double seconds)
+{
+    printf("%-8s %-9s %8lu %9.2f %8lu %8lu", signal, scheme, (unsigned long)stats->frames,
+           stats->frames / seconds, (unsigned long)stats->changes, (unsigned long)stats->replaced);
+
+    if (stats->delivered > 0)
+    {
+        printf(" %10.2f %10.2f\n", stats->latency_sum_us / 1000.0 / stats->delivered, stats->latency_max_us / 1000.0);
+    }
+    else
+    {
+        printf(" %10s %10s\n", "-", "-");
+    }
+}
+
+/***********************************************************************************************************************
+ * Main
+ **********************************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    const char* lap_name = NULL;
+    unsigned long seconds = 120;
+    unsigned long bitrate = 250000;
+    unsigned seed = 1;
+    tx_policy_config_t policy[kCAN_TX_NUM_OF_SIGNALS];
+    sim_scheme_t schemes[2] = {{.name = "actual"}, {.name = "política"}};
+    double duration_s;
+    int violations;
+
+    memcpy(policy, app_config_default.can_tx_policy, sizeof(policy));
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-l") == 0)
+        {
+            lap_name = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            seconds = strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            bitrate = strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-x") == 0)
+        {
+            seed = (unsigned)strtoul(argv[i + 1], NULL, 0);
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            char name[16];
+            unsigned deadband;
+            unsigned long min_us;
+            unsigned long max_us;
+            uint8_t s;
+
+            if (sscanf(argv[i + 1], "%15[^,],%u,%lu,%lu", name, &deadband, &min_us, &max_us) != 4 || deadband > 255U)
+            {
+                fprintf(stderr, "-p %s: se espera <señal>,<banda>,<min_us>,<max_us>\n", argv[i + 1]);
+                return 1;
+            }
+
+            for (s = 0; s < kCAN_TX_NUM_OF_SIGNALS && strcmp(name, signal_names[s]) != 0; s++)
+            {
+            }
+
+            if (s == kCAN_TX_NUM_OF_SIGNALS)
+            {
+                fprintf(stderr, "-p: señal %s desconocida (manejo, falla, nivel o hm)\n", name);
+                return 1;
+            }
+
+            policy[s].deadband = (uint8_t)deadband;
+            policy[s].min_interval_us = (uint32_t)min_us;
+            policy[s].max_interval_us = (uint32_t)max_us;
+        }
+    }
+
+    if (bitrate == 0 || (lap_name == NULL && seconds == 0))
+    {
+        fprintf(stderr, "bitrate y segundos deben ser mayores que 0\n");
+        return 1;
+    }
+
+    srand(seed);
+
+    if ((lap_name != NULL) ? Lap_Load(lap_name) : Lap_Synthetic((uint32_t)seconds))
+    {
+        return 1;
+    }
+
+    frame_us = (uint32_t)((BUS_LOAD_Frame_Bits(SIM_FRAME_DLC) * 1000000ULL + bitrate - 1U) / bitrate);
+
+    violations = Simulate(policy, &schemes[0], &schemes[1]);
+
+    duration_s = (samples[num_of_samples - 1U].t_ms - samples[0].t_ms) / 1000.0 + SIM_PASS_US / 1e6;
+
+    printf("vuelta: %s, %.1f s, %lu muestras; trama %lu us a %lu bit/s\n", (lap_name != NULL) ? lap_name : "sintética",
+           duration_s, (unsigned long)num_of_samples, (unsigned long)frame_us, bitrate);
+
+    printf("política:");
+
+    for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+    {
+        printf(" %s=%u/%lu/%lu", signal_names[i], policy[i].deadband, (unsigned long)policy[i].min_interval_us,
+               (unsigned long)policy[i].max_interval_us);
+    }
+
+    printf(" (banda/min_us/max_us)\n\n");
+
+    printf("%-8s %-9s %8s %9s %8s %8s %10s %10s\n", "señal", "esquema", "tramas", "tramas/s", "cambios", "reempl",
+           "lat_med_ms", "lat_max_ms");
+
+    for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+    {
+        for (uint8_t k = 0; k < 2U; k++)
+        {
+            Print_Row(signal_names[i], schemes[k].name, &schemes[k].signal[i], duration_s);
+        }
+    }
+
+    printf("\n");
+
+    for (uint8_t k = 0; k < 2U; k++)
+    {
+        sim_signal_stats_t total;
+
+        memset(&total, 0, sizeof(total));
+
+        for (uint8_t i = 0; i < kCAN_TX_NUM_OF_SIGNALS; i++)
+        {
+            const sim_signal_stats_t* stats = &schemes[k].signal[i];
+
+            total.frames += stats->frames;
+            total.changes += stats->changes;
+            total.replaced += stats->replaced;
+            total.delivered += stats->delivered;
+            total.latency_sum_us += stats->latency_sum_us;
+            total.latency_max_us = (stats->latency_max_us > total.latency_max_us) ? stats->latency_max_us
+                                                                                   : total.latency_max_us;
+        }
+
+        Print_Row("total", schemes[k].name, &total, duration_s);
+        printf("%-8s %-9s carga de bus %.3f %%\n", "", schemes[k].name,
+               100.0 * total.frames * BUS_LOAD_Frame_Bits(SIM_FRAME_DLC) / (bitrate * duration_s));
+    }
+
+    free(samples);
+
+    if (violations)
+    {
+        fprintf(stderr, "la política no respeta sus intervalos\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -5,98 +5,146 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_context.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_control.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_rtos.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/buses.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/bus_load.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can_app.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can_hw.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/cpu_load.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/decode_data.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/driving_modes.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/failures.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/idle.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/gpio.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/indicators.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/latency.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/main.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/monitoring.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/monitoring_api.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/profiler.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/rampa_pedal.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/rx_timing.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/tx_policy.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/stm32f4xx_hal_msp.c \
 C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/stm32f4xx_it.c \
 ../Application/User/Core/syscalls.c \
 ../Application/User/Core/sysmem.c \
-C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/tim.c 
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/tim.c \
+C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/timebase.c 
 
 OBJS += \
+./Application/User/Core/app_context.o \
 ./Application/User/Core/app_control.o \
+./Application/User/Core/app_rtos.o \
 ./Application/User/Core/buses.o \
+./Application/User/Core/bus_load.o \
 ./Application/User/Core/can.o \
 ./Application/User/Core/can_app.o \
 ./Application/User/Core/can_hw.o \
+./Application/User/Core/cpu_load.o \
 ./Application/User/Core/decode_data.o \
 ./Application/User/Core/driving_modes.o \
 ./Application/User/Core/failures.o \
+./Application/User/Core/idle.o \
 ./Application/User/Core/gpio.o \
 ./Application/User/Core/indicators.o \
+./Application/User/Core/latency.o \
 ./Application/User/Core/main.o \
 ./Application/User/Core/monitoring.o \
 ./Application/User/Core/monitoring_api.o \
+./Application/User/Core/profiler.o \
 ./Application/User/Core/rampa_pedal.o \
+./Application/User/Core/rx_timing.o \
+./Application/User/Core/tx_policy.o \
 ./Application/User/Core/stm32f4xx_hal_msp.o \
 ./Application/User/Core/stm32f4xx_it.o \
 ./Application/User/Core/syscalls.o \
 ./Application/User/Core/sysmem.o \
-./Application/User/Core/tim.o 
+./Application/User/Core/tim.o \
+./Application/User/Core/timebase.o 
 
 C_DEPS += \
+./Application/User/Core/app_context.d \
 ./Application/User/Core/app_control.d \
+./Application/User/Core/app_rtos.d \
 ./Application/User/Core/buses.d \
+./Application/User/Core/bus_load.d \
 ./Application/User/Core/can.d \
 ./Application/User/Core/can_app.d \
 ./Application/User/Core/can_hw.d \
+./Application/User/Core/cpu_load.d \
 ./Application/User/Core/decode_data.d \
 ./Application/User/Core/driving_modes.d \
 ./Application/User/Core/failures.d \
+./Application/User/Core/idle.d \
 ./Application/User/Core/gpio.d \
 ./Application/User/Core/indicators.d \
+./Application/User/Core/latency.d \
 ./Application/User/Core/main.d \
 ./Application/User/Core/monitoring.d \
 ./Application/User/Core/monitoring_api.d \
+./Application/User/Core/profiler.d \
 ./Application/User/Core/rampa_pedal.d \
+./Application/User/Core/rx_timing.d \
+./Application/User/Core/tx_policy.d \
 ./Application/User/Core/stm32f4xx_hal_msp.d \
 ./Application/User/Core/stm32f4xx_it.d \
 ./Application/User/Core/syscalls.d \
 ./Application/User/Core/sysmem.d \
-./Application/User/Core/tim.d 
+./Application/User/Core/tim.d \
+./Application/User/Core/timebase.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
+Application/User/Core/app_context.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_context.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/app_control.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_control.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/app_rtos.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/app_rtos.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/buses.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/buses.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/bus_load.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/bus_load.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/can.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/can_app.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can_app.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/can_hw.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/can_hw.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/cpu_load.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/cpu_load.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/decode_data.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/decode_data.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/driving_modes.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/driving_modes.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/failures.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/failures.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/idle.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/idle.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/gpio.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/gpio.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/indicators.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/indicators.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/latency.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/latency.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/main.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/main.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/monitoring.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/monitoring.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/monitoring_api.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/monitoring_api.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/profiler.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/profiler.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/rampa_pedal.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/rampa_pedal.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/rx_timing.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/rx_timing.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/tx_policy.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/tx_policy.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/stm32f4xx_hal_msp.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/stm32f4xx_hal_msp.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/stm32f4xx_it.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/stm32f4xx_it.c Application/User/Core/subdir.mk
@@ -105,11 +153,13 @@ Application/User/Core/%.o Application/User/Core/%.su: ../Application/User/Core/%
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 Application/User/Core/tim.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/tim.c Application/User/Core/subdir.mk
 	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
+Application/User/Core/timebase.o: C:/Users/PRESTAMO/Downloads/repositorio-control-main/src/Core/Src/timebase.c Application/User/Core/subdir.mk
+	arm-none-eabi-gcc "$<" -mcpu=cortex-m4 -std=gnu11 -g3 -DDEBUG -DUSE_HAL_DRIVER -DSTM32F446xx -c -I../../Core/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc -I../../Drivers/STM32F4xx_HAL_Driver/Inc/Legacy -I../../Drivers/CMSIS/Device/ST/STM32F4xx/Include -I../../Drivers/CMSIS/Include -I../../Drivers/BSP/STM32F4xx-Control -I"../../Drivers/CAN_Driver" -O0 -ffunction-sections -fdata-sections -Wall -fstack-usage -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" --specs=nano.specs -mfpu=fpv4-sp-d16 -mfloat-abi=hard -mthumb -o "$@"
 
 clean: clean-Application-2f-User-2f-Core
 
 clean-Application-2f-User-2f-Core:
-	-$(RM) ./Application/User/Core/app_control.d ./Application/User/Core/app_control.o ./Application/User/Core/app_control.su ./Application/User/Core/buses.d ./Application/User/Core/buses.o ./Application/User/Core/buses.su ./Application/User/Core/can.d ./Application/User/Core/can.o ./Application/User/Core/can.su ./Application/User/Core/can_app.d ./Application/User/Core/can_app.o ./Application/User/Core/can_app.su ./Application/User/Core/can_hw.d ./Application/User/Core/can_hw.o ./Application/User/Core/can_hw.su ./Application/User/Core/decode_data.d ./Application/User/Core/decode_data.o ./Application/User/Core/decode_data.su ./Application/User/Core/driving_modes.d ./Application/User/Core/driving_modes.o ./Application/User/Core/driving_modes.su ./Application/User/Core/failures.d ./Application/User/Core/failures.o ./Application/User/Core/failures.su ./Application/User/Core/gpio.d ./Application/User/Core/gpio.o ./Application/User/Core/gpio.su ./Application/User/Core/indicators.d ./Application/User/Core/indicators.o ./Application/User/Core/indicators.su ./Application/User/Core/main.d ./Application/User/Core/main.o ./Application/User/Core/main.su ./Application/User/Core/monitoring.d ./Application/User/Core/monitoring.o ./Application/User/Core/monitoring.su ./Application/User/Core/monitoring_api.d ./Application/User/Core/monitoring_api.o ./Application/User/Core/monitoring_api.su ./Application/User/Core/rampa_pedal.d ./Application/User/Core/rampa_pedal.o ./Application/User/Core/rampa_pedal.su ./Application/User/Core/stm32f4xx_hal_msp.d ./Application/User/Core/stm32f4xx_hal_msp.o ./Application/User/Core/stm32f4xx_hal_msp.su ./Application/User/Core/stm32f4xx_it.d ./Application/User/Core/stm32f4xx_it.o ./Application/User/Core/stm32f4xx_it.su ./Application/User/Core/syscalls.d ./Application/User/Core/syscalls.o ./Application/User/Core/syscalls.su ./Application/User/Core/sysmem.d ./Application/User/Core/sysmem.o ./Application/User/Core/sysmem.su ./Application/User/Core/tim.d ./Application/User/Core/tim.o ./Application/User/Core/tim.su
+	-$(RM) ./Application/User/Core/app_context.d ./Application/User/Core/app_context.o ./Application/User/Core/app_context.su ./Application/User/Core/app_control.d ./Application/User/Core/app_control.o ./Application/User/Core/app_control.su ./Application/User/Core/app_rtos.d ./Application/User/Core/app_rtos.o ./Application/User/Core/app_rtos.su ./Application/User/Core/buses.d ./Application/User/Core/buses.o ./Application/User/Core/buses.su ./Application/User/Core/bus_load.d ./Application/User/Core/bus_load.o ./Application/User/Core/bus_load.su ./Application/User/Core/can.d ./Application/User/Core/can.o ./Application/User/Core/can.su ./Application/User/Core/can_app.d ./Application/User/Core/can_app.o ./Application/User/Core/can_app.su ./Application/User/Core/can_hw.d ./Application/User/Core/can_hw.o ./Application/User/Core/can_hw.su ./Application/User/Core/cpu_load.d ./Application/User/Core/cpu_load.o ./Application/User/Core/cpu_load.su ./Application/User/Core/decode_data.d ./Application/User/Core/decode_data.o ./Application/User/Core/decode_data.su ./Application/User/Core/driving_modes.d ./Application/User/Core/driving_modes.o ./Application/User/Core/driving_modes.su ./Application/User/Core/failures.d ./Application/User/Core/failures.o ./Application/User/Core/failures.su ./Application/User/Core/idle.d ./Application/User/Core/idle.o ./Application/User/Core/idle.su ./Application/User/Core/gpio.d ./Application/User/Core/gpio.o ./Application/User/Core/gpio.su ./Application/User/Core/indicators.d ./Application/User/Core/indicators.o ./Application/User/Core/indicators.su ./Application/User/Core/latency.d ./Application/User/Core/latency.o ./Application/User/Core/latency.su ./Application/User/Core/main.d ./Application/User/Core/main.o ./Application/User/Core/main.su ./Application/User/Core/monitoring.d ./Application/User/Core/monitoring.o ./Application/User/Core/monitoring.su ./Application/User/Core/monitoring_api.d ./Application/User/Core/monitoring_api.o ./Application/User/Core/monitoring_api.su ./Application/User/Core/profiler.d ./Application/User/Core/profiler.o ./Application/User/Core/profiler.su ./Application/User/Core/rampa_pedal.d ./Application/User/Core/rampa_pedal.o ./Application/User/Core/rampa_pedal.su ./Application/User/Core/rx_timing.d ./Application/User/Core/rx_timing.o ./Application/User/Core/rx_timing.su ./Application/User/Core/tx_policy.d ./Application/User/Core/tx_policy.o ./Application/User/Core/tx_policy.su ./Application/User/Core/stm32f4xx_hal_msp.d ./Application/User/Core/stm32f4xx_hal_msp.o ./Application/User/Core/stm32f4xx_hal_msp.su ./Application/User/Core/stm32f4xx_it.d ./Application/User/Core/stm32f4xx_it.o ./Application/User/Core/stm32f4xx_it.su ./Application/User/Core/syscalls.d ./Application/User/Core/syscalls.o ./Application/User/Core/syscalls.su ./Application/User/Core/sysmem.d ./Application/User/Core/sysmem.o ./Application/User/Core/sysmem.su ./Application/User/Core/tim.d ./Application/User/Core/tim.o ./Application/User/Core/tim.su ./Application/User/Core/timebase.d ./Application/User/Core/timebase.o ./Application/User/Core/timebase.su
 
 .PHONY: clean-Application-2f-User-2f-Core
 